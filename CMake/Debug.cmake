@@ -2,10 +2,8 @@ set(CMAKE_C_STANDARD 11)
 
 add_definitions("-D_DEBUG -D_STATS")
 
-if (MSVC)
-    add_compile_options(/Od /W4)
-endif()
-	
-if(GNU)
-    add_compile_options(-O0 -g3 -pg -pedantic-errors -Wall -Wextra -Wconversion)
-endif()
+# The toolchain file is read before the compiler is identified, so the flags
+# of each compiler are selected when the build files are generated.
+add_compile_options(
+	"$<$<C_COMPILER_ID:MSVC>:/Od;/W4>"
+	"$<$<OR:$<C_COMPILER_ID:GNU>,$<C_COMPILER_ID:Clang>,$<C_COMPILER_ID:AppleClang>>:-O0;-g3;-pg;-pedantic-errors;-Wall;-Wextra;-Wconversion>")
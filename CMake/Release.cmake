@@ -1,9 +1,9 @@
 set(CMAKE_C_STANDARD 11)
 
-if (MSVC)
-    add_compile_options(/O2 /W4)
-endif()
-
-if(GNU)
-    add_compile_options(-O3 -march=native -pedantic-errors -Wextra -Wconversion)
-endif()
+# The toolchain file is read before the compiler is identified, so the flags
+# of each compiler are selected when the build files are generated.
+# The vectorized kernels are selected at runtime, so the binary targets
+# the baseline of its architecture rather than the machine building it.
+add_compile_options(
+	"$<$<C_COMPILER_ID:MSVC>:/O2;/W4>"
+	"$<$<OR:$<C_COMPILER_ID:GNU>,$<C_COMPILER_ID:Clang>,$<C_COMPILER_ID:AppleClang>>:-O3;-pedantic-errors;-Wextra;-Wconversion>")
@@ -0,0 +1,101 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CHECKPOINT_H_
+#define CHECKPOINT_H_
+
+#include "memstructs.h"
+#include "inputstream.h"
+
+/// @brief Periodic checkpoints of a counting run, recording the input offset
+/// reached and the Word Hash Table counted up to it.
+typedef struct Checkpoint Checkpoint;
+
+/**
+ * @brief Allocates a new Checkpoint saved to the specified file.
+ *
+ * @param[in]	path		Pointer to the string containing the path of the file.
+ * @param[in]	interval	The minimum number of words counted between
+ * 							two consecutive checkpoints.
+ * @param[in]	rules		The signature of the token rules of the run,
+ * 							which a restored checkpoint must match.
+ * @return	Return a pointer to the allocated checkpoint.
+ */
+Checkpoint* Checkpoint_create(const char *path, const size_t interval,
+		const uint64_t rules);
+
+/**
+ * @brief Restores the state of an interrupted run from the checkpoint file.
+ * @details If no checkpoint file exists, the table is set to NULL and
+ * the routine succeeds.
+ *
+ * @param[in]	chkp	Pointer to the checkpoint.
+ * @param[out]	whtab	Pointer to the pointer of the restored table.
+ * @param[out]	offset	Pointer to the input offset to resume from.
+ * @param[out]	words	Pointer to the number of words counted up to the offset.
+ * @return	Returns the status of the routine.
+ */
+RetStatus Checkpoint_restore(Checkpoint *chkp, WordHashTable **whtab,
+		uint64_t *offset, size_t *words);
+
+/**
+ * @brief Checks whether enough words were counted since the last checkpoint.
+ *
+ * @param[in]	chkp	Pointer to the checkpoint.
+ * @param[in]	words	The total number of words counted.
+ * @return	Returns true if a new checkpoint should be saved.
+ */
+bool Checkpoint_due(const Checkpoint *chkp, const size_t words);
+
+/**
+ * @brief Saves a new checkpoint of the table and the input offset.
+ * @details On POSIX systems the table is written by a forked process,
+ * so that copy-on-write keeps a consistent snapshot while counting goes on.
+ * The decompression thread of the input is paused while forking, as the
+ * forked process, running only the calling thread, uses the C library.
+ * If the previous checkpoint is still being written, the new one is skipped.
+ *
+ * @param[in, out]	chkp	Pointer to the checkpoint.
+ * @param[in]		whtab	Pointer to the table counted up to the offset.
+ * @param[in, out]	stream	Pointer to the input stream being counted.
+ * @param[in]		offset	The input offset reached.
+ * @param[in]		words	The total number of words counted.
+ * @return	Returns the status of the routine.
+ */
+RetStatus Checkpoint_save(Checkpoint *chkp, const WordHashTable *whtab,
+		InputStream *stream, const uint64_t offset, const size_t words);
+
+/**
+ * @brief Removes the checkpoint file after a completed run.
+ * @details Waits for any checkpoint still being written.
+ *
+ * @param[in, out]	chkp	Pointer to the checkpoint.
+ * @return	Void
+ */
+void Checkpoint_discard(Checkpoint *chkp);
+
+/**
+ * @brief Frees the memory allocated for the Checkpoint.
+ * @details Waits for any checkpoint still being written.
+ *
+ * @param[in, out]	chkp	Pointer to the pointer of the checkpoint.
+ * @return	Void
+ */
+void Checkpoint_destroy(Checkpoint **chkp);
+
+#endif /* CHECKPOINT_H_ */
@@ -0,0 +1,45 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef COUNTDIFF_H_
+#define COUNTDIFF_H_
+
+#include "memstructs.h"
+
+/**
+ * @brief Prints the words whose frequency changed between two sets of counts,
+ * along with their log ratio.
+ * @details Each file is either the output of a run, whose words are printed
+ * in alphabetical order, or an FST written by --export-fst. Both are merged
+ * in a single forward pass, so the output of a run may be a pipe. The totals
+ * of FSTs are known on opening, so two FSTs are printed while merged, while
+ * the words of the output of a run are kept until its total is known at its
+ * end. The log ratio of a word is
+ * the base 2 logarithm of its frequency in the new counts over its frequency
+ * in the old ones, a count of 0 being taken as 0.5 so that words found on
+ * a single side have a finite ratio.
+ *
+ * @param[in]	oldPath		Pointer to the string containing the path of the old counts.
+ * @param[in]	newPath		Pointer to the string containing the path of the new counts.
+ * @param[in]	threshold	The smallest absolute log ratio of the words printed.
+ * @return	Return the status of the routine.
+ */
+RetStatus CountDiff_print(const char *oldPath, const char *newPath, const double threshold);
+
+#endif /* COUNTDIFF_H_ */
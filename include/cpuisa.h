@@ -0,0 +1,89 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef CPUISA_H_
+#define CPUISA_H_
+
+#include "utils.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+/// The vectorized kernels are built for the x86 instruction set extensions.
+#define CPU_ISA_X86
+#endif
+
+/// Builds a function for instruction set extensions beyond those
+/// of the whole binary, so that it is only called once they are detected.
+#if defined(__GNUC__) || defined(__clang__)
+#define ISA_TARGET(features) __attribute__((target(features)))
+#else
+#define ISA_TARGET(features)
+#endif
+
+/// Declares a static function inlined into each function calling it,
+/// so that the kernels it is given are called directly and inlined too.
+#if defined(__GNUC__) || defined(__clang__)
+#define ISA_INLINE static inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define ISA_INLINE static __forceinline
+#else
+#define ISA_INLINE static inline
+#endif
+
+/// @brief The instruction set extensions the vectorized kernels are built for,
+/// from the least to the most capable.
+typedef enum
+{
+	/// No vector instructions, bytes are processed one by one.
+	ISA_SCALAR = 0,
+	/// 16-byte vectors.
+	ISA_SSE2 = 1,
+	/// 32-byte vectors.
+	ISA_AVX2 = 2,
+	/// 64-byte vectors with byte masks.
+	ISA_AVX512BW = 3
+}CpuIsa;
+
+/**
+ * @brief Detects the most capable instruction set extensions supported
+ * by both the CPU and the operating system.
+ *
+ * @return	The extensions detected, ISA_SCALAR on other architectures.
+ */
+CpuIsa CpuIsa_detect(void);
+
+/**
+ * @brief Parses the name of a set of instruction set extensions.
+ *
+ * @param[in]	name	Pointer to the string of the name, one of
+ * 						"scalar", "sse2", "avx2" or "avx512bw".
+ * @param[out]	isa		Pointer to the extensions to be set.
+ * @return	Returns true if the name is valid.
+ */
+bool CpuIsa_parse(const char *name, CpuIsa *isa);
+
+/**
+ * @brief Gets the name of a set of instruction set extensions.
+ *
+ * @param[in]	isa	The extensions.
+ * @return	Returns the name, as parsed by CpuIsa_parse.
+ */
+const char* CpuIsa_name(const CpuIsa isa);
+
+#endif /* CPUISA_H_ */
@@ -0,0 +1,84 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef FILECACHE_H_
+#define FILECACHE_H_
+
+#include "memstructs.h"
+
+/// @brief A directory caching the word counts of each input file, keyed by
+/// the path, the size and the modification time of the file and the token
+/// rules it was counted with.
+typedef struct FileCache FileCache;
+
+/**
+ * @brief Allocates a new File Cache stored in the specified directory.
+ * @details The directory is created if it does not exist.
+ *
+ * @param[in]	dirPath	Pointer to the string containing the path of the directory.
+ * @param[in]	rules	The signature of the token rules the files are counted with.
+ * @return	Return a pointer to the allocated cache.
+ */
+FileCache* FileCache_create(const char *dirPath, const uint64_t rules);
+
+/**
+ * @brief Adds the cached counts of a file to the Hash table,
+ * if the file has not changed since they were cached.
+ * @details The size and modification time of the file are recorded,
+ * so that FileCache_store caches the counts of the file as it was
+ * when looked up.
+ *
+ * @param[in, out]	cache	Pointer to the cache.
+ * @param[in]		path	Pointer to the string containing the path of the file.
+ * @param[in, out]	whtab	Pointer to the table the cached counts are added to.
+ * @param[out]		words	Pointer to the number of words of the file.
+ * @param[out]		found	Pointer to the flag set if the counts were cached.
+ * @return	Returns the status of the routine.
+ */
+RetStatus FileCache_lookup(FileCache *cache, const char *path, WordHashTable *whtab,
+		size_t *words, bool *found);
+
+/**
+ * @brief Caches the counts of the file last looked up.
+ *
+ * @param[in, out]	cache	Pointer to the cache.
+ * @param[in]		path	Pointer to the string containing the path of the file.
+ * @param[in]		whtab	Pointer to the table holding only the counts of the file.
+ * @param[in]		words	The number of words of the file.
+ * @return	Returns the status of the routine.
+ */
+RetStatus FileCache_store(FileCache *cache, const char *path,
+		const WordHashTable *whtab, const size_t words);
+
+/**
+ * @brief Prints in a human-readable way the hits and misses of the cache.
+ *
+ * @param[in]	cache	Pointer to the cache.
+ * @return	Void
+ */
+void FileCache_stats_print(const FileCache *cache);
+
+/**
+ * @brief Frees the memory allocated for the File Cache.
+ *
+ * @param[in, out]	cache	Pointer to the pointer of the cache.
+ * @return	Void
+ */
+void FileCache_destroy(FileCache **cache);
+
+#endif /* FILECACHE_H_ */
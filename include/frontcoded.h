@@ -0,0 +1,128 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef FRONTCODED_H_
+#define FRONTCODED_H_
+
+#include "memstructs.h"
+
+/// @brief The words of a finished table and their counts, sorted and stored
+/// front-coded in blocks, along with the position of each block.
+typedef struct FrontCodedWords FrontCodedWords;
+
+/**
+ * @brief Compacts the words of a table to a new set of Front Coded Words.
+ * @details The words are taken in alphabetical order. Each of them keeps only
+ * the characters following the prefix it shares with the previous word,
+ * except for the first word of each block, which is kept whole so that the
+ * blocks can be searched without decoding the ones before them.
+ *
+ * @param[in]	whtab	Pointer to the table.
+ * @return	Return a pointer to the allocated words.
+ */
+FrontCodedWords* FrontCodedWords_create(const WordHashTable *whtab);
+
+/**
+ * @brief Reads a set of Front Coded Words written by FrontCodedWords_write.
+ *
+ * @param[in, out]	fp	Pointer to the file opened for binary reading.
+ * @return	Return a pointer to the allocated words, NULL if the file is invalid.
+ */
+FrontCodedWords* FrontCodedWords_read(FILE *fp);
+
+/**
+ * @brief Writes a set of Front Coded Words to a binary file, as it is in memory.
+ * @details The lengths are written in the byte order of the host,
+ * so files are not portable across architectures.
+ *
+ * @param[in]		fcw	Pointer to the words.
+ * @param[in, out]	fp	Pointer to the file opened for binary writing.
+ * @return	Return the status of the routine.
+ */
+RetStatus FrontCodedWords_write(const FrontCodedWords *fcw, FILE *fp);
+
+/**
+ * @brief Writes the words of a table and their counts to a binary file,
+ * compacted to Front Coded Words.
+ *
+ * @param[in]		whtab	Pointer to the table.
+ * @param[in, out]	fp		Pointer to the file opened for binary writing.
+ * @return	Return the status of the routine.
+ */
+RetStatus FrontCodedWords_dump(const WordHashTable *whtab, FILE *fp);
+
+/**
+ * @brief Adds the words and counts written by FrontCodedWords_dump to a table.
+ * @details Words already in the table have their counts increased, so
+ * loading several files to the same table merges them.
+ *
+ * @param[in, out]	whtab	Pointer to the table.
+ * @param[in, out]	fp		Pointer to the file opened for binary reading.
+ * @return	Return the status of the routine.
+ */
+RetStatus FrontCodedWords_load(WordHashTable *whtab, FILE *fp);
+
+/**
+ * @brief Adds the words and their counts to a table.
+ * @details Words already in the table have their counts increased.
+ *
+ * @param[in]		fcw		Pointer to the words.
+ * @param[in, out]	whtab	Pointer to the table.
+ * @return	Return the status of the routine.
+ */
+RetStatus FrontCodedWords_merge(const FrontCodedWords *fcw, WordHashTable *whtab);
+
+/**
+ * @brief Looks a word up, by a binary search of the first words of the blocks
+ * followed by decoding the single block which may hold the word.
+ *
+ * @param[in]	fcw		Pointer to the words.
+ * @param[in]	word	Pointer to the characters of the word.
+ * @param[in]	length	The length of the word.
+ * @param[out]	count	Pointer to the count of the word, if found.
+ * @return	Returns true if the word is found.
+ */
+bool FrontCodedWords_find(const FrontCodedWords *fcw, const char *word,
+		const uint32_t length, size_t *count);
+
+/**
+ * @brief Gets the number of words.
+ *
+ * @param[in]	fcw	Pointer to the words.
+ * @return	The number of words.
+ */
+size_t FrontCodedWords_num_words(const FrontCodedWords *fcw);
+
+/**
+ * @brief Gets the number of bytes taken by the blocks and their positions.
+ *
+ * @param[in]	fcw	Pointer to the words.
+ * @return	The number of bytes.
+ */
+size_t FrontCodedWords_bytes(const FrontCodedWords *fcw);
+
+/**
+ * @brief Frees the memory allocated for the Front Coded Words.
+ *
+ * @param[in, out]	fcw	Pointer to the pointer of the words.
+ * @return	Void
+ */
+void FrontCodedWords_destroy(FrontCodedWords **fcw);
+
+#endif /* FRONTCODED_H_ */
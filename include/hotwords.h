@@ -0,0 +1,91 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HOTWORDS_H_
+#define HOTWORDS_H_
+
+#include "memstructs.h"
+
+/// @brief A small direct-mapped cache in front of a Word Hash Table,
+/// gathering the occurrences of the most frequent words before they
+/// are added to the table.
+typedef struct HotWords HotWords;
+
+/**
+ * @brief Allocates a new empty cache of hot words.
+ *
+ * @return	Return a pointer to the allocated cache.
+ */
+HotWords* HotWords_create(void);
+
+/**
+ * @brief Counts an occurrence of a word if the cache holds it.
+ * @details Words are only taken in the cache by HotWords_count_word,
+ * so the rest are left to be counted by it.
+ *
+ * @param[in, out]	hot		Pointer to the cache.
+ * @param[in]		wbuf	Pointer to the buffer of the word.
+ * @return	Returns true if the occurrence was counted.
+ */
+bool HotWords_hit(HotWords *hot, const WordBuffer *wbuf);
+
+/**
+ * @brief Counts the occurrences of a word, either in the cache or in the table.
+ * @details Short words are counted in the slot of their hash, adding the
+ * occurrences gathered by the word previously held in the slot to the table.
+ * Longer words are counted in the table directly, which is expanded as needed.
+ *
+ * @param[in, out]	hot		Pointer to the cache.
+ * @param[in, out]	whtab	Pointer to the Hash table.
+ * @param[in]		wbuf	Pointer to the buffer of the word.
+ * @param[in]		count	The number of occurrences to be added.
+ * @return	Return the status of the routine.
+ */
+RetStatus HotWords_count_word(HotWords *hot, WordHashTable *whtab, const WordBuffer *wbuf,
+		const size_t count);
+
+/**
+ * @brief Adds the occurrences gathered in the cache to the table.
+ * @details The table is only up to date after a flush. The words stay
+ * in the cache, so that their next occurrences are counted in it too.
+ *
+ * @param[in, out]	hot		Pointer to the cache.
+ * @param[in, out]	whtab	Pointer to the Hash table.
+ * @return	Return the status of the routine.
+ */
+RetStatus HotWords_flush(HotWords *hot, WordHashTable *whtab);
+
+/**
+ * @brief Prints the number of words counted and the hit rate of the cache.
+ *
+ * @param[in]	hot	Pointer to the cache.
+ * @return	Void
+ */
+void HotWords_stats_print(const HotWords *hot);
+
+/**
+ * @brief Frees the memory allocated for the cache, dropping any occurrences
+ * not yet flushed.
+ *
+ * @param[in, out]	hot	Pointer to the pointer of the cache.
+ * @return	Void
+ */
+void HotWords_destroy(HotWords **hot);
+
+#endif /* HOTWORDS_H_ */
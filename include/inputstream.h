@@ -0,0 +1,103 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef INPUTSTREAM_H_
+#define INPUTSTREAM_H_
+
+#include "memstructs.h"
+
+/// @brief The bytes of an input file, decompressed on a separate thread
+/// if the file is compressed with gzip, zstd or xz.
+typedef struct InputStream InputStream;
+
+/**
+ * @brief Allocates a new Input Stream reading a file from its current offset.
+ * @details The compression of the file is detected by its magic bytes.
+ * Only the bytes which can still start a magic number are read ahead,
+ * so that a stream of text is not held back.
+ *
+ * @param[in]	fp	Pointer to the input file, which must outlive the stream.
+ * @return	Return a pointer to the allocated stream, NULL if the file is
+ * compressed in a format this build does not support.
+ */
+InputStream* InputStream_open(FILE *fp);
+
+/**
+ * @brief Gets the next bytes of the stream.
+ * @details The bytes are valid until the next call. Reading by line,
+ * at most a line is returned, which is only shorter than a full line
+ * if the line is too long for the buffers.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @param[in]		line	Whether to stop after a new line.
+ * @param[out]		bytes	Pointer to the pointer of the bytes.
+ * @param[out]		length	Pointer to the number of bytes, 0 at the end of the stream.
+ * @return	Return the status of the routine.
+ */
+RetStatus InputStream_next(InputStream *stream, const bool line, const char **bytes,
+		size_t *length);
+
+/**
+ * @brief Moves the stream to an offset of its bytes.
+ * @details Compressed streams can only move forward, by decompressing
+ * the bytes up to the offset.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @param[in]		offset	The offset of the decompressed bytes.
+ * @return	Return the status of the routine.
+ */
+RetStatus InputStream_seek(InputStream *stream, const uint64_t offset);
+
+/**
+ * @brief Gets the offset of the next byte of the stream.
+ * @details The offset refers to the decompressed bytes of compressed files.
+ *
+ * @param[in]	stream	Pointer to the stream.
+ * @return	The offset of the next byte.
+ */
+uint64_t InputStream_offset(const InputStream *stream);
+
+/**
+ * @brief Parks the decompression thread, if any, before its next block.
+ * @details Returns once the thread waits on the stream, holding no other
+ * lock, so that the process can be forked safely. Only the reader
+ * of the stream may pause it, and it must not read until resuming it.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @return	Void
+ */
+void InputStream_pause(InputStream *stream);
+
+/**
+ * @brief Lets the decompression thread paused by InputStream_pause go on.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @return	Void
+ */
+void InputStream_resume(InputStream *stream);
+
+/**
+ * @brief Stops the decompression and frees the memory allocated
+ * for the Input Stream. The file is not closed.
+ *
+ * @param[in, out]	stream	Pointer to the pointer of the stream.
+ * @return	Void
+ */
+void InputStream_close(InputStream **stream);
+
+#endif /* INPUTSTREAM_H_ */
@@ -0,0 +1,94 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LINETABLE_H_
+#define LINETABLE_H_
+
+#include "memstructs.h"
+
+/// @brief A bounded table of the distinct lines of the input,
+/// counting how many times each of them was read.
+typedef struct LineTable LineTable;
+
+/**
+ * @brief Allocates a new empty Line Table.
+ *
+ * @param[in]	maxLines	The maximum number of distinct lines held.
+ * @param[in]	maxBytes	The maximum number of characters of the lines held.
+ * @return	Return a pointer to the allocated table.
+ */
+LineTable* LineTable_create(const size_t maxLines, const size_t maxBytes);
+
+/**
+ * @brief Adds a line to the table or increases its multiplicity
+ * if it was already added.
+ *
+ * @param[in, out]	ltab	Pointer to the table.
+ * @param[in]		line	Pointer to the characters of the line.
+ * @param[in]		len		The length of the line.
+ * @return	Returns the status of the routine, DATA_STRUCT_FULL if the line
+ * is new and does not fit in the table.
+ */
+RetStatus LineTable_add(LineTable *ltab, const char *line, const size_t len);
+
+/**
+ * @brief Gets the number of distinct lines of the table.
+ *
+ * @param[in]	ltab	Pointer to the table.
+ * @return	The number of lines.
+ */
+size_t LineTable_get_size(const LineTable *ltab);
+
+/**
+ * @brief Gets a distinct line of the table, in the order they were added.
+ *
+ * @param[in]	ltab	Pointer to the table.
+ * @param[in]	index	The index of the line.
+ * @param[out]	len		Pointer to the length of the line.
+ * @param[out]	count	Pointer to the number of times the line was added.
+ * @return	Pointer to the characters of the line.
+ */
+const char* LineTable_line_at(const LineTable *ltab, const size_t index, size_t *len,
+		size_t *count);
+
+/**
+ * @brief Removes all the lines of the table.
+ *
+ * @param[in, out]	ltab	Pointer to the table.
+ * @return	Void
+ */
+void LineTable_clear(LineTable *ltab);
+
+/**
+ * @brief Prints the number of lines added to the table
+ * and how many of them were distinct.
+ *
+ * @param[in]	ltab	Pointer to the table.
+ * @return	Void
+ */
+void LineTable_stats_print(const LineTable *ltab);
+
+/**
+ * @brief Frees the memory allocated for the Line Table.
+ *
+ * @param[in, out]	ltab	Pointer to the pointer of the table.
+ * @return	Void
+ */
+void LineTable_destroy(LineTable **ltab);
+
+#endif /* LINETABLE_H_ */
@@ -0,0 +1,67 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef MANIFEST_H_
+#define MANIFEST_H_
+
+#include "utils.h"
+
+/// @brief A list of the paths of the documents counted separately.
+typedef struct Manifest Manifest;
+
+/**
+ * @brief Opens a list of paths, read one path at a time.
+ * @details The paths are separated by new lines, or by null characters
+ * for lists produced by `find -print0` and alike. Empty paths are skipped,
+ * as are the carriage returns ending the lines of Windows lists.
+ *
+ * @param[in]	path			Pointer to the string containing the path of the list,
+ * 								"-" for the standard input.
+ * @param[in]	nulDelimited	Whether the paths are separated by null characters.
+ * @return	Return a pointer to the opened list.
+ */
+Manifest* Manifest_open(const char *path, const bool nulDelimited);
+
+/**
+ * @brief Reads the next path of the list.
+ *
+ * @param[in, out]	manifest	Pointer to the list.
+ * @return	Return a pointer to the string of the path, valid until the next call,
+ * 			or NULL at the end of the list or on failure.
+ */
+const char* Manifest_next(Manifest *manifest);
+
+/**
+ * @brief Checks whether reading the list failed.
+ *
+ * @param[in]	manifest	Pointer to the list.
+ * @return	Returns true if a path could not be read.
+ */
+bool Manifest_failed(const Manifest *manifest);
+
+/**
+ * @brief Closes the list and frees the memory allocated for it.
+ *
+ * @param[in, out]	manifest	Pointer to the pointer of the list.
+ * @return	Void
+ */
+void Manifest_close(Manifest **manifest);
+
+#endif /* MANIFEST_H_ */
@@ -0,0 +1,38 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef MARKUP_H_
+#define MARKUP_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Decodes a character reference of HTML or XML.
+ * @details Numeric references, decimal or hexadecimal, may refer to any
+ * valid code point, while named references are those of HTML 4 and XML.
+ * @param[in]	name	Pointer to the characters between '&' and ';'.
+ * @param[in]	len		The number of characters.
+ * @param[out]	cp		Pointer to the code point of the reference.
+ * @return	Returns true if the reference is valid.
+ */
+bool markup_reference_decode(const char *name, const size_t len, uint32_t *cp);
+
+#endif /* MARKUP_H_ */
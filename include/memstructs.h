@@ -22,6 +22,7 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 
 /// @brief The return status of a routine,
 /// stating the reason of a potential error.
@@ -84,6 +85,44 @@ void WordBuffer_backspace(WordBuffer *wbuf);
  */
 void WordBuffer_clear(WordBuffer *wbuf);
 
+/**
+ * @brief Replaces the contents of the Word Buffer with the specified string.
+ * @details Expands the word's string if needed.
+ *
+ * @param[in, out]	wbuf	Pointer to the buffer.
+ * @param[in]		str		Pointer to the string to be copied.
+ * @param[in]		len		The length of the string, without the terminator.
+ * @return	Returns the status of the routine.
+ */
+RetStatus WordBuffer_set(WordBuffer *wbuf, const char *str, const uint32_t len);
+
+/**
+ * @brief Appends the specified characters to the Word Buffer.
+ * @details Expands the word's string if needed.
+ *
+ * @param[in, out]	wbuf	Pointer to the buffer.
+ * @param[in]		str		Pointer to the characters to be appended.
+ * @param[in]		len		The number of characters to be appended.
+ * @return	Returns the status of the routine.
+ */
+RetStatus WordBuffer_append(WordBuffer *wbuf, const char *str, const uint32_t len);
+
+/**
+ * @brief Gets the word held by the Word Buffer.
+ *
+ * @param[in]	wbuf	Pointer to the buffer.
+ * @return	Pointer to the null-terminated word.
+ */
+const char* WordBuffer_get_word(const WordBuffer *wbuf);
+
+/**
+ * @brief Gets the length of the word held by the Word Buffer.
+ *
+ * @param[in]	wbuf	Pointer to the buffer.
+ * @return	The number of bytes of the word.
+ */
+uint32_t WordBuffer_get_length(const WordBuffer *wbuf);
+
 /**
  * @brief Prints in a user-readable way the state of the Word Buffer.
  *
@@ -165,6 +204,16 @@ char* WordBufferVector_word_at(const WordBufferVector *vec, const size_t index);
  */
 size_t WordBufferVector_get_size(const WordBufferVector *vec);
 
+/**
+ * @brief Removes all the elements of the Word Buffer Vector.
+ * @details The capacity of the vector is retained, so that it can be refilled
+ * without any reallocation.
+ *
+ * @param[in, out]	vec	Pointer to the vector.
+ * @return	Void
+ */
+void WordBufferVector_clear(WordBufferVector *vec);
+
 /**
  * @brief Prints in a user-readable way the elements of the Word Buffer Vector.
  *
@@ -281,6 +330,168 @@ RetStatus WordHashTable_init(WordHashTable *whtab, const size_t initCapacity);
  */
 RetStatus WordHashTable_add_word(WordHashTable *whtab, const WordBuffer *wbuf);
 
+/**
+ * @brief Hashes a new word to the Hash table with the specified count
+ * or increases its counter by that count if the word already exists.
+ * @details Behaves as WordHashTable_add_word otherwise.
+ *
+ * @param[in, out]	whtab	Pointer to the Hash table.
+ * @param[in]		wbuf	The Word Buffer of the word to be added.
+ * @param[in]		count	The number of occurrences to be added.
+ * @return	Returns the status of the routine.
+ */
+RetStatus WordHashTable_add_word_count(WordHashTable *whtab, const WordBuffer *wbuf,
+		const size_t count);
+
+/**
+ * @brief Adds one occurrence of a word to the Hash table as
+ * WordHashTable_count_word does, providing a reference to the word.
+ * @details The reference is the offset of the word's string in the strings
+ * pool, which remains valid until the pool is compacted.
+ *
+ * @param[in, out]	whtab	Pointer to the Hash table.
+ * @param[in]		wbuf	The Word Buffer of the word to be added.
+ * @param[out]		ref		Pointer to the reference of the word.
+ * @return	Returns the status of the routine.
+ */
+RetStatus WordHashTable_count_word_ref(WordHashTable *whtab, const WordBuffer *wbuf,
+		size_t *ref);
+
+/**
+ * @brief Adds one occurrence of a word to the Hash table as
+ * WordHashTable_count_word does, providing the id of the word.
+ * @details Words are assigned sequential ids, starting from 0, in the order
+ * they are first added to the table. An id is never reused, even once its
+ * word is removed from the table.
+ *
+ * @param[in, out]	whtab	Pointer to the Hash table.
+ * @param[in]		wbuf	The Word Buffer of the word to be added.
+ * @param[out]		id		Pointer to the id of the word.
+ * @return	Returns the status of the routine.
+ */
+RetStatus WordHashTable_count_word_id(WordHashTable *whtab, const WordBuffer *wbuf,
+		uint32_t *id);
+
+/**
+ * @brief Gets the number of word ids assigned by the Hash table.
+ *
+ * @param[in]	whtab	Pointer to the Hash table.
+ * @return	Returns the number of ids, one more than the last id assigned.
+ */
+uint32_t WordHashTable_num_ids(const WordHashTable *whtab);
+
+/**
+ * @brief Gets the string and the count of a word from its id.
+ *
+ * @param[in]	whtab	Pointer to the Hash table.
+ * @param[in]	id		The id of the word.
+ * @param[out]	count	Pointer to the count of the word.
+ * @return	Returns a pointer to the null terminated string of the word,
+ * or NULL if the word is no longer in the table.
+ */
+const char* WordHashTable_id_word(const WordHashTable *whtab, const uint32_t id,
+		size_t *count);
+
+/**
+ * @brief Gets the string of a word from its reference.
+ * @details References stay valid until the table is compacted.
+ *
+ * @param[in]	whtab	Pointer to the Hash table.
+ * @param[in]	ref		The reference of the word.
+ * @return	Returns a pointer to the null terminated string of the word.
+ */
+const char* WordHashTable_ref_word(const WordHashTable *whtab, const size_t ref);
+
+/**
+ * @brief Gets the number of positions of the alphabetical order of the table,
+ * including those of the words whose count dropped to 0.
+ *
+ * @param[in]	whtab	Pointer to the Hash table.
+ * @return	Returns the number of positions.
+ */
+size_t WordHashTable_get_size(const WordHashTable *whtab);
+
+/**
+ * @brief Gets the word at a position of the alphabetical order of the table.
+ *
+ * @param[in]	whtab	Pointer to the Hash table.
+ * @param[in]	pos		The position, below the size of the table.
+ * @param[out]	length	Pointer to the length of the word, without the null terminator.
+ * @param[out]	count	Pointer to the count of the word.
+ * @return	Returns a pointer to the null terminated string of the word,
+ * or NULL if its count dropped to 0.
+ */
+const char* WordHashTable_order_word(const WordHashTable *whtab, const size_t pos,
+		uint32_t *length, size_t *count);
+
+/**
+ * @brief Checks whether the characters of the strings pool no longer used
+ * by any entry exceed the specified percentage of the used ones.
+ *
+ * @param[in]	whtab		Pointer to the table.
+ * @param[in]	limitPrc	The limit percentage set.
+ * @return	Returns true if the limit is exceeded.
+ */
+bool WordHashTable_pool_waste_above(const WordHashTable *whtab, const uint32_t limitPrc);
+
+/**
+ * @brief Purges the tombstones of the Hash table and moves the strings
+ * of its entries to a new, compacted strings pool.
+ * @details The specified word references are updated to the new pool.
+ *
+ * @param[in, out]	whtab	Pointer to the table.
+ * @param[in, out]	refs	Pointer to the array of references to be updated.
+ * @param[in]		numRefs	The number of references in the array.
+ * @return	Returns the status of the routine.
+ */
+RetStatus WordHashTable_compact(WordHashTable *whtab, size_t *refs, const size_t numRefs);
+
+/**
+ * @brief Adds the words of a Hash table to another one,
+ * along with their counts.
+ * @details The destination table and its strings pool are expanded as needed.
+ *
+ * @param[in, out]	dst	Pointer to the table the words are added to.
+ * @param[in]		src	Pointer to the table the words are taken from.
+ * @return	Returns the status of the routine.
+ */
+RetStatus WordHashTable_merge(WordHashTable *dst, const WordHashTable *src);
+
+/**
+ * @brief Empties the Hash table, keeping its capacity and its strings pool.
+ * @details Only the entries in use are visited, so clearing a large table
+ * holding a few words is cheap. The hash statistics are kept.
+ *
+ * @param[in, out]	whtab	Pointer to the Hash table.
+ * @return	Void
+ */
+void WordHashTable_clear(WordHashTable *whtab);
+
+/**
+ * @brief Decreases the counter of a word in the Hash table.
+ * @details A word whose count drops to 0 is kept as a tombstone, which is
+ * revived if the word is added again, or reused for another word.
+ * Tombstones are purged when the table is rehashed.
+ *
+ * @param[in, out]	whtab	Pointer to the Hash table.
+ * @param[in]		wbuf	The Word Buffer of the word to be removed.
+ * @param[in]		count	The number of occurrences to be removed.
+ * @return	Returns the status of the routine.
+ */
+RetStatus WordHashTable_remove_word_count(WordHashTable *whtab, const WordBuffer *wbuf,
+		const size_t count);
+
+/**
+ * @brief Decreases by one the counter of the word referenced
+ * by the offset of its string in the strings pool.
+ * @details Behaves as WordHashTable_remove_word_count otherwise.
+ *
+ * @param[in, out]	whtab	Pointer to the Hash table.
+ * @param[in]		ref		The reference of the word, as provided on its addition.
+ * @return	Returns the status of the routine.
+ */
+RetStatus WordHashTable_remove_ref(WordHashTable *whtab, const size_t ref);
+
 /**
  * @brief Checks whether the size of the Hash Table is smaller than
  * the specified capacity limit percentage.
@@ -291,6 +502,20 @@ RetStatus WordHashTable_add_word(WordHashTable *whtab, const WordBuffer *wbuf);
  */
 bool WordHashTable_size_below(const WordHashTable* whtab, const uint32_t limitPrc);
 
+/**
+ * @brief Adds the specified occurrences of a word to the Hash table,
+ * expanding the table and its strings pool as needed.
+ * @details The strings pool is expanded until the word fits and the table
+ * is expanded once it reaches an occupancy of 70%.
+ *
+ * @param[in, out]	whtab	Pointer to the Hash table.
+ * @param[in]		wbuf	The Word Buffer of the word to be added.
+ * @param[in]		count	The number of occurrences to be added.
+ * @return	Returns the status of the routine.
+ */
+RetStatus WordHashTable_count_word(WordHashTable *whtab, const WordBuffer *wbuf,
+		const size_t count);
+
 /**
  * @brief Doubles the size of the strings pool of the table.
  * @details Updates the string pointers of the active entries
@@ -310,6 +535,38 @@ RetStatus WordHashTable_MemoryPool_expand(WordHashTable *whtab);
  */
 RetStatus WordHashTable_expand(WordHashTable *whtab);
 
+/**
+ * @brief Gets the next word of a table of counts being printed.
+ *
+ * @param[in, out]	iter	Pointer to the state of the iteration.
+ * @param[out]		word	Pointer to the bytes of the word, which need not be
+ * 							null terminated, or NULL past the last word.
+ * @param[out]		length	Pointer to the length of the word.
+ * @param[out]		count	Pointer to the count of the word.
+ * @return	Returns the status of the routine.
+ */
+typedef RetStatus (*CountTableNext)(void *iter, const char **word, uint32_t *length,
+		size_t *count);
+
+/**
+ * @brief Prints a table of words and their counts, in the order
+ * they are iterated.
+ * @details The word column is one character wider than the longest word,
+ * as the lengths of the words of the Hash table include the null terminator.
+ * The words are padded by their code points, which never outnumber
+ * their bytes, so the columns line up for words beyond ASCII too.
+ *
+ * @param[in]		item		The name of the items counted, used in the title.
+ * @param[in]		heading		The heading of the column of the items.
+ * @param[in]		maxLength	The length of the longest word.
+ * @param[in]		maxCount	The highest count.
+ * @param[in]		next		The function getting the next word.
+ * @param[in, out]	iter		Pointer to the state of the iteration.
+ * @return	Returns the status of the routine.
+ */
+RetStatus CountTable_print(const char *item, const char *heading, const uint32_t maxLength,
+		const size_t maxCount, CountTableNext next, void *iter);
+
 /**
  * @brief Prints the word in the Hash table in alphabetical order
  * and their count
@@ -0,0 +1,147 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPTIONS_H_
+#define OPTIONS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "cpuisa.h"
+
+/// @brief The options of a WordCounter run, as passed on the command line.
+typedef struct
+{
+	/// Paths of the input text files.
+	const char **inputPaths;
+	/// The number of input text files, 0 if the standard input is to be used.
+	size_t numInputs;
+	/// Path of the checkpoint file, NULL if checkpointing is disabled.
+	const char *checkpointPath;
+	/// The minimum number of words counted between two consecutive checkpoints.
+	size_t checkpointInterval;
+	/// Path of the directory caching the counts of each input file,
+	/// NULL if caching is disabled.
+	const char *cacheDir;
+	/// The maximum number of words of the sliding window, 0 if unlimited.
+	size_t windowWords;
+	/// The maximum age in seconds of the words of the sliding window,
+	/// 0 if unlimited.
+	size_t windowSeconds;
+	/// The number of words counted between two reports of the sliding window,
+	/// 0 to only report at the end of the input.
+	size_t windowReport;
+	/// The length in seconds of the time buckets of timestamped lines,
+	/// 0 if bucketing is disabled.
+	size_t bucketSeconds;
+	/// The number of most common words printed per time bucket, 0 for all.
+	size_t topWords;
+	/// Path of the stream of the word ids of the input,
+	/// NULL if the stream is not written.
+	const char *tokenIdsPath;
+	/// The ASCII symbols counted as word characters, NULL for none.
+	const char *wordChars;
+	/// The ASCII symbols which can appear inside words,
+	/// NULL for the default ones.
+	const char *inwordSymbols;
+	/// The regular expression matching the words,
+	/// NULL to split the words by the types of their characters.
+	const char *tokenRegex;
+	/// Whether words differing in case are counted separately.
+	bool caseSensitive;
+	/// Whether the markup of HTML and XML input is skipped.
+	bool stripMarkup;
+	/// Path of the file of the words excluded from the counts,
+	/// NULL to count all the words.
+	const char *stopwordsPath;
+	/// Whether English words are counted by their stem.
+	bool stem;
+	/// Whether each distinct line is tokenized once, however many times
+	/// it is repeated.
+	bool dedupLines;
+	/// The maximum number of bytes of a word, 0 for no limit.
+	size_t maxTokenLength;
+	/// Whether the words are counted in a radix tree instead of the hash table.
+	bool radixTree;
+	/// Path of the file of the only words counted, NULL to count all the words.
+	const char *vocabPath;
+	/// Whether the vocabulary of the first input path is compiled
+	/// to the second one instead of counting any words.
+	bool compileVocab;
+	/// The characters ending the segments of the words whose counts are
+	/// rolled up per prefix, NULL if they are not rolled up.
+	const char *rollupSeparators;
+	/// Path of the file the final counts are exported to as an FST,
+	/// NULL if they are not exported.
+	const char *fstPath;
+	/// Path of the list of the documents counted and printed separately,
+	/// NULL to count the input paths together.
+	const char *manifestPath;
+	/// Whether the paths of the list are separated by null characters
+	/// rather than new lines.
+	bool manifestNul;
+	/// Whether the kernels of the tokenizer are built for the extensions
+	/// of forcedIsa rather than the best ones of the CPU.
+	bool isaForced;
+	/// The instruction set extensions of the kernels of the tokenizer, if forced.
+	CpuIsa forcedIsa;
+	/// Whether the FST of the first input path is queried
+	/// instead of counting any words.
+	bool queryFst;
+	/// The prefix of the words queried, NULL to query a range.
+	const char *queryPrefix;
+	/// Whether the counts of the first input path are compared to those
+	/// of the second one instead of counting any words.
+	bool diff;
+	/// The smallest absolute log ratio of the frequencies of the words
+	/// printed by the comparison.
+	double diffThreshold;
+	/// The first word of the range queried, NULL for the first word of the FST.
+	const char *rangeFrom;
+	/// The word ending the range queried, excluded from it,
+	/// NULL to query up to the last word of the FST.
+	const char *rangeTo;
+}ProgramOptions;
+
+/**
+ * @brief Parses the command line arguments into the program options.
+ * @details Options not passed are set to their default values.
+ *
+ * @param[out]	opts	Pointer to the options to be set.
+ * @param[in]	argc	The number of command line arguments.
+ * @param[in]	argv	The array of command line arguments.
+ * @return	Returns true if the arguments are valid.
+ */
+bool ProgramOptions_parse(ProgramOptions *opts, const int argc, char *argv[]);
+
+/**
+ * @brief Frees the memory allocated for the program options.
+ *
+ * @param[in, out]	opts	Pointer to the options.
+ * @return	Void
+ */
+void ProgramOptions_free(ProgramOptions *opts);
+
+/**
+ * @brief Prints the accepted command line arguments.
+ *
+ * @param[in]	progName	The name of the executable.
+ * @return	Void
+ */
+void ProgramOptions_print_usage(const char *progName);
+
+#endif /* OPTIONS_H_ */
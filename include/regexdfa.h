@@ -0,0 +1,74 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef REGEXDFA_H_
+#define REGEXDFA_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// The state of a Regex DFA from which no match is possible.
+#define REGEX_DEAD_STATE 0
+
+/// @brief A regular expression compiled into a minimized DFA over bytes.
+/// @details Bytes which no part of the expression tells apart share a class,
+/// so the table holds a column per class rather than per byte.
+typedef struct
+{
+	/// The class of each byte.
+	uint8_t classes[256];
+	/// The number of byte classes.
+	uint32_t numClasses;
+	/// The number of states, including the dead one.
+	uint32_t numStates;
+	/// The state before any byte is matched.
+	uint32_t start;
+	/// The next state of each state for each byte class,
+	/// numClasses entries per state.
+	uint16_t *transitions;
+	/// Whether each state completes a match.
+	bool *accepting;
+}RegexDfa;
+
+/**
+ * @brief Compiles a regular expression into a minimized DFA.
+ * @details The expression matches bytes and supports literals, '.',
+ * bracketed classes of ASCII characters, the classes \d, \w, \s and their
+ * negations, grouping, alternation and the quantifiers *, +, ? and {m,n}.
+ * Anchors and backreferences are not supported. When folding case, each
+ * ASCII letter of the expression matches both its cases, so that both cases
+ * of a letter share a byte class and the DFA reads the input as if it was
+ * folded, while other bytes are matched as they are.
+ *
+ * @param[in]	pattern		Pointer to the string of the expression.
+ * @param[in]	foldCase	Whether the ASCII letters match regardless of their case.
+ * @return	Return a pointer to the compiled DFA, NULL if the expression
+ * is invalid or too complex.
+ */
+RegexDfa* RegexDfa_compile(const char *pattern, const bool foldCase);
+
+/**
+ * @brief Frees the memory allocated for the Regex DFA.
+ *
+ * @param[in, out]	dfa	Pointer to the pointer of the DFA.
+ * @return	Void
+ */
+void RegexDfa_destroy(RegexDfa **dfa);
+
+#endif /* REGEXDFA_H_ */
@@ -0,0 +1,72 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ROLLUP_H_
+#define ROLLUP_H_
+
+#include "memstructs.h"
+
+/// @brief The counts of the words of a table rolled up per prefix,
+/// up to each separator of their segments.
+typedef struct PrefixRollup PrefixRollup;
+
+/**
+ * @brief Rolls up the counts of the words of a table along the boundaries
+ * of their segments, in a single pass over the words in alphabetical order.
+ * @details Each prefix of a word ending at a separator, like `www.` or
+ * `user@`, is counted as many times as the words starting with it. The words
+ * starting with a prefix follow each other in alphabetical order, so a stack
+ * of the prefixes of the last word holds those still receiving counts, each
+ * count being added to the longest one and passed to the shorter one when
+ * it is popped. The prefixes point to the words of the table, which has to
+ * outlive the rollup.
+ *
+ * @param[in]	whtab		Pointer to the table.
+ * @param[in]	separators	Pointer to the string of the characters ending
+ * 							the segments.
+ * @return	Return a pointer to the allocated rollup.
+ */
+PrefixRollup* PrefixRollup_create(const WordHashTable *whtab, const char *separators);
+
+/**
+ * @brief Prints the prefixes in alphabetical order along with their counts,
+ * in the format of WordHashTable_count_print.
+ *
+ * @param[in]	rollup	Pointer to the rollup.
+ * @return	Void
+ */
+void PrefixRollup_print(const PrefixRollup *rollup);
+
+/**
+ * @brief Prints the number of prefixes and the most segments of a word.
+ *
+ * @param[in]	rollup	Pointer to the rollup.
+ * @return	Void
+ */
+void PrefixRollup_stats_print(const PrefixRollup *rollup);
+
+/**
+ * @brief Frees the memory allocated for the rollup.
+ *
+ * @param[in, out]	rollup	Pointer to the pointer of the rollup.
+ * @return	Void
+ */
+void PrefixRollup_destroy(PrefixRollup **rollup);
+
+#endif /* ROLLUP_H_ */
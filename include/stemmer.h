@@ -0,0 +1,67 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef STEMMER_H_
+#define STEMMER_H_
+
+#include "memstructs.h"
+
+/// @brief The Porter stemmer of English words, remembering the stems
+/// of the most recent words in a small cache.
+typedef struct Stemmer Stemmer;
+
+/**
+ * @brief Allocates a new Stemmer with an empty cache.
+ *
+ * @return	Return a pointer to the allocated stemmer.
+ */
+Stemmer* Stemmer_create(void);
+
+/**
+ * @brief Reduces a word to its stem, so that "running" and "runs"
+ * are both counted as "run".
+ * @details Only words of at least 3 lowercase ASCII letters are stemmed,
+ * the rest are returned as they are. The stem of a word found in the cache
+ * is not computed again.
+ *
+ * @param[in, out]	stem	Pointer to the stemmer.
+ * @param[in]		wbuf	Pointer to the buffer of the word.
+ * @param[out]		result	Pointer to the pointer of the buffer of the stem,
+ * 							which is either the word itself or a buffer of the
+ * 							stemmer valid until the next call.
+ * @return	Return the status of the routine.
+ */
+RetStatus Stemmer_stem(Stemmer *stem, const WordBuffer *wbuf, const WordBuffer **result);
+
+/**
+ * @brief Prints the number of words stemmed and the hit rate of the cache.
+ *
+ * @param[in]	stem	Pointer to the stemmer.
+ * @return	Void
+ */
+void Stemmer_stats_print(const Stemmer *stem);
+
+/**
+ * @brief Frees the memory allocated for the Stemmer.
+ *
+ * @param[in, out]	stem	Pointer to the pointer of the stemmer.
+ * @return	Void
+ */
+void Stemmer_destroy(Stemmer **stem);
+
+#endif /* STEMMER_H_ */
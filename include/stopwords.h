@@ -0,0 +1,74 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef STOPWORDS_H_
+#define STOPWORDS_H_
+
+#include "memstructs.h"
+#include "tokenizer.h"
+
+/// @brief A fixed set of words excluded from the counts, looked up
+/// through a minimal perfect hash.
+typedef struct StopWords StopWords;
+
+/**
+ * @brief Allocates a new set of Stop Words from the words of a file.
+ * @details The file is tokenized with the same rules as the input,
+ * so that its words are case folded like the words they exclude.
+ *
+ * @param[in]	path	Pointer to the string containing the path of the file.
+ * @param[in]	rules	Pointer to the rules splitting the input into words.
+ * @return	Return a pointer to the allocated set.
+ */
+StopWords* StopWords_create(const char *path, const TokenRules *rules);
+
+/**
+ * @brief Checks whether a word is one of the Stop Words.
+ *
+ * @param[in, out]	stop	Pointer to the set.
+ * @param[in]		wbuf	Pointer to the buffer of the word.
+ * @return	Returns true if the word is to be excluded.
+ */
+bool StopWords_contains(StopWords *stop, const WordBuffer *wbuf);
+
+/**
+ * @brief Gets a hash identifying the words of the set, so that counts saved
+ * excluding different words are not mixed.
+ *
+ * @param[in]	stop	Pointer to the set.
+ * @return	The signature of the set.
+ */
+uint64_t StopWords_signature(const StopWords *stop);
+
+/**
+ * @brief Prints the number of Stop Words and of the words they excluded.
+ *
+ * @param[in]	stop	Pointer to the set.
+ * @return	Void
+ */
+void StopWords_stats_print(const StopWords *stop);
+
+/**
+ * @brief Frees the memory allocated for the Stop Words.
+ *
+ * @param[in, out]	stop	Pointer to the pointer of the set.
+ * @return	Void
+ */
+void StopWords_destroy(StopWords **stop);
+
+#endif /* STOPWORDS_H_ */
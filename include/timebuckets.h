@@ -0,0 +1,93 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TIMEBUCKETS_H_
+#define TIMEBUCKETS_H_
+
+#include "memstructs.h"
+
+/// @brief The counts of the words per time bucket, kept in a single table
+/// keyed by the bucket and the reference of the word's interned string.
+typedef struct TimeBuckets TimeBuckets;
+
+/**
+ * @brief Allocates a new, empty set of Time Buckets.
+ *
+ * @param[in]	period	The length of each bucket in seconds.
+ * @param[in]	topK	The number of most common words printed per bucket,
+ * 						0 to print all of them.
+ * @return	Return a pointer to the allocated buckets.
+ */
+TimeBuckets* TimeBuckets_create(const int64_t period, const size_t topK);
+
+/**
+ * @brief Parses the timestamp leading a line.
+ * @details Accepted are ISO 8601 dates and times, "YYYY-MM-DD[( |T)hh:mm[:ss[.f]]]"
+ * optionally followed by 'Z' or a "+hh:mm" offset, as well as seconds or
+ * milliseconds since the Epoch. The timestamp may be enclosed in brackets.
+ *
+ * @param[in]	line	Pointer to the start of the line.
+ * @param[in]	len		The number of characters available.
+ * @param[out]	time	Pointer to the parsed time in seconds since the Epoch (UTC).
+ * @param[out]	tsLen	Pointer to the number of characters of the timestamp.
+ * @return	Returns true if the line starts with a timestamp.
+ */
+bool TimeBuckets_parse_timestamp(const char *line, const size_t len,
+		int64_t *time, size_t *tsLen);
+
+/**
+ * @brief Counts a word in the bucket of the specified time.
+ * @details The word's string is interned in the Hash table, which also
+ * keeps its total count over all the buckets.
+ *
+ * @param[in, out]	tbk		Pointer to the buckets.
+ * @param[in, out]	whtab	Pointer to the table interning the words.
+ * @param[in]		wbuf	The Word Buffer of the word.
+ * @param[in]		time	The time of the word in seconds since the Epoch.
+ * @return	Returns the status of the routine.
+ */
+RetStatus TimeBuckets_count_word(TimeBuckets *tbk, WordHashTable *whtab,
+		const WordBuffer *wbuf, const int64_t time);
+
+/**
+ * @brief Prints the counts of each bucket in chronological order,
+ * either all the words alphabetically or the most common ones.
+ *
+ * @param[in]	tbk		Pointer to the buckets.
+ * @param[in]	whtab	Pointer to the table interning the words.
+ * @return	Returns the status of the routine.
+ */
+RetStatus TimeBuckets_print(const TimeBuckets *tbk, const WordHashTable *whtab);
+
+/**
+ * @brief Prints in a human-readable way the statistics of the buckets.
+ *
+ * @param[in]	tbk	Pointer to the buckets.
+ * @return	Void
+ */
+void TimeBuckets_stats_print(const TimeBuckets *tbk);
+
+/**
+ * @brief Frees the memory allocated for the Time Buckets.
+ *
+ * @param[in, out]	tbk	Pointer to the pointer of the buckets.
+ * @return	Void
+ */
+void TimeBuckets_destroy(TimeBuckets **tbk);
+
+#endif /* TIMEBUCKETS_H_ */
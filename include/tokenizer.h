@@ -0,0 +1,251 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TOKENIZER_H_
+#define TOKENIZER_H_
+
+#include "memstructs.h"
+#include "inputstream.h"
+#include "hotwords.h"
+#include "cpuisa.h"
+
+/// @brief The rules splitting the input into words, compiled into a table
+/// of the type of each ASCII character.
+typedef struct TokenRules TokenRules;
+
+/// @brief The state of the tokenization of a UTF-8 stream into words.
+typedef struct Tokenizer Tokenizer;
+
+/// @brief A buffered reader tokenizing an input file in chunks of words.
+typedef struct InputReader InputReader;
+
+/**
+ * @brief Compiles the rules splitting the input into words.
+ * @details Letters and digits of any script are always word characters.
+ * The extra word characters are treated like letters, while in word
+ * symbols can join words but not start or end them. Both must be ASCII
+ * symbols. If an expression is passed, the words are instead the longest
+ * matches of the expression, found by its DFA in a single pass.
+ * Stripping markup, only the text of HTML and XML input is tokenized.
+ * Words longer than the maximum length are cut to it, the rest of their
+ * characters being read without being held.
+ *
+ * @param[in]	wordChars		Pointer to the string of the extra word characters,
+ * 								NULL for none.
+ * @param[in]	inwordSymbols	Pointer to the string of the in word symbols,
+ * 								NULL for the default ones.
+ * @param[in]	tokenRegex		Pointer to the string of the expression matching
+ * 								the words, NULL to split them by character type.
+ * @param[in]	caseSensitive	Whether letters are kept in their case
+ * 								rather than case folded.
+ * @param[in]	stripMarkup		Whether tags, comments and the content of script and
+ * 								style elements are skipped and character references
+ * 								decoded.
+ * @param[in]	maxLength		The maximum number of bytes of a word, 0 for no limit.
+ * @return	Return a pointer to the allocated rules, NULL if they are invalid.
+ */
+TokenRules* TokenRules_create(const char *wordChars, const char *inwordSymbols,
+		const char *tokenRegex, const bool caseSensitive, const bool stripMarkup,
+		const size_t maxLength);
+
+/**
+ * @brief Gets a hash identifying the rules, so that counts saved
+ * under different rules are not mixed.
+ *
+ * @param[in]	rules	Pointer to the rules.
+ * @return	The signature of the rules.
+ */
+uint64_t TokenRules_signature(const TokenRules *rules);
+
+/**
+ * @brief Selects the kernel classifying the bytes of the input
+ * built for the specified instruction set extensions.
+ * @details The rules are created with the most capable extensions of the CPU,
+ * so other ones are only selected to compare the kernels. The words read
+ * are the same whichever the kernel.
+ *
+ * @param[in, out]	rules	Pointer to the rules.
+ * @param[in]		isa		The extensions of the kernel.
+ * @return	Returns the status of the routine, failing if the CPU
+ * 			does not support the extensions.
+ */
+RetStatus TokenRules_set_isa(TokenRules *rules, const CpuIsa isa);
+
+/**
+ * @brief Gets the instruction set extensions of the kernel of the rules.
+ *
+ * @param[in]	rules	Pointer to the rules.
+ * @return	The extensions of the kernel.
+ */
+CpuIsa TokenRules_isa(const TokenRules *rules);
+
+/**
+ * @brief Frees the memory allocated for the Token Rules.
+ *
+ * @param[in, out]	rules	Pointer to the pointer of the rules.
+ * @return	Void
+ */
+void TokenRules_destroy(TokenRules **rules);
+
+/**
+ * @brief Allocates a new Tokenizer, placed between words.
+ *
+ * @param[in]	rules	Pointer to the rules splitting the input into words,
+ * 						which must outlive the tokenizer.
+ * @return	Return a pointer to the allocated tokenizer.
+ */
+Tokenizer* Tokenizer_create(const TokenRules *rules);
+
+/**
+ * @brief Tokenizes the next bytes of the stream, pushing to the vector
+ * the words they conclude.
+ * @details Stops right after a word is pushed if the vector reaches
+ * the maximum number of words, so that the input can be processed
+ * in chunks ending at word boundaries. A character split at the end
+ * of the bytes is completed by the next ones.
+ *
+ * @param[in, out]	tok			Pointer to the tokenizer.
+ * @param[out]		vec			Pointer to the Word Buffer Vector to be filled.
+ * @param[in]		bytes		Pointer to the bytes.
+ * @param[in]		len			The number of bytes.
+ * @param[in]		maxWords	The maximum number of words in the vector, 0 for no limit.
+ * @param[out]		consumed	Pointer to the number of bytes tokenized.
+ * @return	Return the status of the routine.
+ */
+RetStatus Tokenizer_feed(Tokenizer *tok, WordBufferVector *vec, const char *bytes,
+		const size_t len, const size_t maxWords, size_t *consumed);
+
+/**
+ * @brief Concludes the word being read at the end of the stream, pushing it
+ * to the vector, and places the tokenizer between words.
+ *
+ * @param[in, out]	tok	Pointer to the tokenizer.
+ * @param[out]		vec	Pointer to the Word Buffer Vector to be filled.
+ * @return	Return the status of the routine.
+ */
+RetStatus Tokenizer_finish(Tokenizer *tok, WordBufferVector *vec);
+
+/**
+ * @brief Gets the number of words the tokenizer cut at the maximum length.
+ *
+ * @param[in]	tok	Pointer to the tokenizer.
+ * @return	The number of words cut.
+ */
+size_t Tokenizer_truncated(const Tokenizer *tok);
+
+/**
+ * @brief Places the tokenizer between words at the start of a new input,
+ * as if newly allocated, keeping its buffers.
+ *
+ * @param[in, out]	tok	Pointer to the tokenizer.
+ * @return	Void
+ */
+void Tokenizer_reset(Tokenizer *tok);
+
+/**
+ * @brief Frees the memory allocated for the Tokenizer.
+ *
+ * @param[in, out]	tok	Pointer to the pointer of the tokenizer.
+ * @return	Void
+ */
+void Tokenizer_destroy(Tokenizer **tok);
+
+/**
+ * @brief Allocates a new Input Reader for a stream, starting from its current offset.
+ * @details Streamed input is read line by line rather than in full blocks,
+ * so that its words are tokenized as soon as they arrive. The words held
+ * by the cache of hot words are counted in it as soon as they are read,
+ * instead of being pushed to the vector.
+ *
+ * @param[in]	stream		Pointer to the input stream, which must outlive the reader.
+ * @param[in]	streamed	Whether the words are to be tokenized as they arrive.
+ * @param[in]	rules		Pointer to the rules splitting the input into words,
+ * 							which must outlive the reader.
+ * @param[in]	hot			Pointer to the cache of hot words, NULL for none.
+ * @return	Return a pointer to the allocated reader.
+ */
+InputReader* InputReader_create(InputStream *stream, const bool streamed,
+		const TokenRules *rules, HotWords *hot);
+
+/**
+ * @brief Points the Input Reader to another stream, starting from its current offset.
+ * @details The tokenizer is reset and its counters start over, so that
+ * a reader can be reused across many small inputs.
+ *
+ * @param[in, out]	inp		Pointer to the reader.
+ * @param[in]		stream	Pointer to the input stream, which must outlive the reader.
+ * @return	Void
+ */
+void InputReader_reset(InputReader *inp, InputStream *stream);
+
+/**
+ * @brief Tokenization of the next chunk of the input to a vector of Word Buffers.
+ * @details Stops right after a word is pushed if the vector reaches
+ * the maximum number of words, so that the input can be processed
+ * in chunks ending at word boundaries.
+ *
+ * @param[in, out]	inp			Pointer to the reader.
+ * @param[out]		vec			Pointer to the Word Buffer Vector to be filled.
+ * @param[in]		maxWords	The maximum number of words to be pushed, 0 for no limit.
+ * @return	Return the status of the routine.
+ */
+RetStatus InputReader_read(InputReader *inp, WordBufferVector *vec, const size_t maxWords);
+
+/**
+ * @brief Checks whether the whole input has been tokenized.
+ *
+ * @param[in]	inp	Pointer to the reader.
+ * @return	Returns true if the end of the input was reached.
+ */
+bool InputReader_eof(const InputReader *inp);
+
+/**
+ * @brief Gets the offset of the stream up to which the input has been tokenized.
+ * @details At the end of a chunk, this is a word boundary to resume from.
+ *
+ * @param[in]	inp	Pointer to the reader.
+ * @return	The offset of the first byte not yet tokenized.
+ */
+uint64_t InputReader_offset(const InputReader *inp);
+
+/**
+ * @brief Gets the number of words of the input cut at the maximum length.
+ *
+ * @param[in]	inp	Pointer to the reader.
+ * @return	The number of words cut.
+ */
+size_t InputReader_truncated(const InputReader *inp);
+
+/**
+ * @brief Gets the number of words of the input counted in the cache of hot words
+ * instead of being pushed to the vector.
+ *
+ * @param[in]	inp	Pointer to the reader.
+ * @return	The number of words counted in the cache.
+ */
+size_t InputReader_hot_words(const InputReader *inp);
+
+/**
+ * @brief Frees the memory allocated for the Input Reader.
+ *
+ * @param[in, out]	inp	Pointer to the pointer of the reader.
+ * @return	Void
+ */
+void InputReader_destroy(InputReader **inp);
+
+#endif /* TOKENIZER_H_ */
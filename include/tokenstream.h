@@ -0,0 +1,75 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TOKENSTREAM_H_
+#define TOKENSTREAM_H_
+
+#include "memstructs.h"
+
+/// @brief The output of the input text as a binary stream of word ids,
+/// along with the dictionary mapping the ids back to the words.
+typedef struct TokenStream TokenStream;
+
+/**
+ * @brief Creates the files of a new Token Stream.
+ * @details The ids are written to the specified path and the dictionary
+ * to the same path with a ".dict" extension appended.
+ *
+ * @param[in]	path	Pointer to the string containing the path of the stream.
+ * @return	Return a pointer to the allocated stream.
+ */
+TokenStream* TokenStream_create(const char *path);
+
+/**
+ * @brief Counts a word in the Hash table and appends its id to the stream.
+ *
+ * @param[in, out]	ts		Pointer to the stream.
+ * @param[in, out]	whtab	Pointer to the table assigning the ids.
+ * @param[in]		wbuf	The Word Buffer of the word.
+ * @return	Returns the status of the routine.
+ */
+RetStatus TokenStream_count_word(TokenStream *ts, WordHashTable *whtab,
+		const WordBuffer *wbuf);
+
+/**
+ * @brief Completes the stream and writes the dictionary of the ids
+ * assigned by the Hash table.
+ *
+ * @param[in, out]	ts		Pointer to the stream.
+ * @param[in]		whtab	Pointer to the table assigning the ids.
+ * @return	Returns the status of the routine.
+ */
+RetStatus TokenStream_finish(TokenStream *ts, const WordHashTable *whtab);
+
+/**
+ * @brief Prints in a human-readable way the statistics of the stream.
+ *
+ * @param[in]	ts	Pointer to the stream.
+ * @return	Void
+ */
+void TokenStream_stats_print(const TokenStream *ts);
+
+/**
+ * @brief Closes the files of the Token Stream and frees its memory.
+ *
+ * @param[in, out]	ts	Pointer to the pointer of the stream.
+ * @return	Void
+ */
+void TokenStream_destroy(TokenStream **ts);
+
+#endif /* TOKENSTREAM_H_ */
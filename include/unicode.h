@@ -0,0 +1,119 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef UNICODE_H_
+#define UNICODE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/// Marks a byte sequence which is not valid UTF-8.
+#define UNICODE_INVALID 0xFFFFFFFF
+
+/// @brief The class of a code point, as far as words are concerned.
+typedef enum
+{
+	/// The code point can not appear in words.
+	UNICODE_OTHER = 0,
+	/// The code point is a letter or a mark combined with one.
+	UNICODE_LETTER = 1,
+	/// The code point is a digit or any other numeric character.
+	UNICODE_NUMBER = 2
+}UnicodeClass;
+
+/// @brief A range of consecutive code points of the same class.
+typedef struct
+{
+	/// The first code point of the range.
+	uint32_t first;
+	/// The distance of the last code point of the range from the first.
+	uint16_t span;
+	/// The UnicodeClass of the code points of the range.
+	uint8_t cls;
+}UnicodeRange;
+
+/// The version of the Unicode Character Database of the tables.
+extern const char unicodeVersion[];
+/// The classes of the code points below U+0800, packed 4 per byte.
+extern const uint8_t unicodeSmallClasses[512];
+/// The sorted ranges of the letters and numbers from U+0800 onwards.
+extern const UnicodeRange unicodeRanges[];
+/// The number of ranges of unicodeRanges.
+extern const size_t unicodeNumRanges;
+/// The block of unicodeFoldBlocks of each 256 code points.
+extern const uint8_t unicodeFoldIndex[0x1100];
+/// The distance of each code point from its simple case folding.
+extern const int32_t unicodeFoldBlocks[][256];
+
+/**
+ * @brief Classifies a code point as a letter, a number or neither.
+ * @details Code points below U+0800, covering the Latin, Greek, Cyrillic,
+ * Hebrew and Arabic scripts, are looked up directly, while the rest are
+ * searched in the ranges.
+ *
+ * @param[in]	cp	The code point.
+ * @return	The UnicodeClass of the code point.
+ */
+UnicodeClass unicode_class(const uint32_t cp);
+
+/**
+ * @brief Gets the simple case folding of a code point.
+ * @details Maps each code point to a single one, as in the statuses C and S
+ * of the CaseFolding.txt of the Unicode Character Database, so that words
+ * differing only in case are counted together.
+ *
+ * @param[in]	cp	The code point.
+ * @return	The folded code point, the same one if it has no folding.
+ */
+uint32_t unicode_fold(const uint32_t cp);
+
+/**
+ * @brief Decodes the UTF-8 sequence at the start of a byte array.
+ * @details Overlong sequences, surrogates and code points beyond U+10FFFF
+ * are invalid, in which case a single byte is consumed.
+ *
+ * @param[in]	bytes	Pointer to the bytes.
+ * @param[in]	len		The number of bytes available.
+ * @param[out]	cp		Pointer to the decoded code point, UNICODE_INVALID
+ * 						for an invalid sequence.
+ * @return	The number of bytes of the sequence, 0 if the bytes available
+ * end before a possibly valid sequence does.
+ */
+uint32_t utf8_decode(const uint8_t *bytes, const size_t len, uint32_t *cp);
+
+/**
+ * @brief Encodes a code point in UTF-8.
+ *
+ * @param[in]	cp		The code point, which must be valid.
+ * @param[out]	bytes	Pointer to at least 4 bytes for the sequence.
+ * @return	The number of bytes of the sequence.
+ */
+uint32_t utf8_encode(const uint32_t cp, uint8_t *bytes);
+
+/**
+ * @brief Counts the code points of UTF-8 bytes, which is the width
+ * they are printed with in the scripts without wide characters.
+ * @details Every byte which does not continue a sequence counts once.
+ *
+ * @param[in]	bytes	Pointer to the bytes.
+ * @param[in]	len		The number of bytes.
+ * @return	The number of code points.
+ */
+uint32_t utf8_length(const uint8_t *bytes, const size_t len);
+
+#endif /* UNICODE_H_ */
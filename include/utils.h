@@ -46,6 +46,70 @@ bool string_copy(char *dst, const char *src, const size_t cnt);
  */
 bool file_open(FILE **filePointer, const char *path, const char *flags);
 
+/**
+ * @brief Gets the current position of a file.
+ * @details Wrapper of _ftelli64 for compilation on Microsoft
+ * systems and of ftello for the rest, supporting files larger than 2GB.
+ *
+ * @param[in]	filePointer	Pointer to the file.
+ * @param[out]	offset		Pointer to the offset to be set.
+ * @return	Returns true if the process succeeds.
+ */
+bool file_tell(FILE *filePointer, uint64_t *offset);
+
+/**
+ * @brief Sets the current position of a file.
+ * @details Wrapper of _fseeki64 for compilation on Microsoft
+ * systems and of fseeko for the rest, supporting files larger than 2GB.
+ *
+ * @param[in, out]	filePointer	Pointer to the file.
+ * @param[in]		offset		The offset from the beginning of the file.
+ * @return	Returns true if the process succeeds.
+ */
+bool file_seek(FILE *filePointer, const uint64_t offset);
+
+/**
+ * @brief Gets the size and the last modification time of a file.
+ * @details Wrapper of _stat64 for compilation on Microsoft
+ * systems and of stat for the rest.
+ *
+ * @param[in]	path	Pointer to the string containing the path of the file.
+ * @param[out]	size	Pointer to the size of the file in bytes.
+ * @param[out]	mtime	Pointer to the modification time in seconds since the Epoch.
+ * @return	Returns true if the process succeeds.
+ */
+bool file_stats(const char *path, uint64_t *size, int64_t *mtime);
+
+/**
+ * @brief Creates a directory, if it does not already exist.
+ * @details Wrapper of _mkdir for compilation on Microsoft
+ * systems and of mkdir for the rest.
+ *
+ * @param[in]	path	Pointer to the string containing the path of the directory.
+ * @return	Returns true if the directory exists after the call.
+ */
+bool dir_create(const char *path);
+
+/**
+ * @brief Maps the contents of a file to memory.
+ * @details The pages of the file are only read when accessed, so mapping
+ * takes the same time for any size. Windows systems read the whole file.
+ *
+ * @param[in]	path	Pointer to the string containing the path of the file.
+ * @param[in]	length	The number of bytes of the file.
+ * @return	Pointer to the contents of the file, NULL on failure.
+ */
+void* file_map(const char *path, const size_t length);
+
+/**
+ * @brief Releases the contents of a file mapped by file_map.
+ *
+ * @param[in]	mapping	Pointer to the contents of the file.
+ * @param[in]	length	The number of bytes of the file.
+ * @return	Void
+ */
+void file_unmap(void *mapping, const size_t length);
+
 /**
  * @brief Computes a 64-bit hash index of a byte array.
  * @details The function uses the FNV-1a algorithm which except for its
@@ -68,4 +132,22 @@ uint64_t fnvhash(const uint8_t *hword, const uint32_t wlen);
  */
 size_t next_2power(const size_t num);
 
+/**
+ * @brief Computes the number of digits of a decimal number.
+ * @details Computes the number of characters needed to represent a decimal
+ * number in a string.
+ *
+ * @param[in]	num	The decimal number.
+ * @return	The number of digits
+ */
+uint32_t num_of_digits(const size_t num);
+
+/**
+ * @brief Prints the specified number of dashes.
+ *
+ * @param[in]	dashNum	The number of dashes to be printed.
+ * @return	Void
+ */
+void print_dash_line(const uint32_t dashNum);
+
 #endif /* UTILS_H_ */
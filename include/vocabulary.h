@@ -0,0 +1,92 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef VOCABULARY_H_
+#define VOCABULARY_H_
+
+#include "memstructs.h"
+#include "tokenizer.h"
+
+/// @brief The counts of a fixed vocabulary, the rest of the words
+/// being discarded.
+typedef struct Vocabulary Vocabulary;
+
+/**
+ * @brief Allocates a new Vocabulary from the words of a file.
+ * @details The file is tokenized with the same rules as the input.
+ * Its words are mapped to the positions of an array of counts through
+ * a minimal perfect hash, so that counting a word takes a single hash,
+ * a single comparison and an increment. Files written by Vocabulary_compile
+ * are mapped to memory instead.
+ *
+ * @param[in]	path	Pointer to the string containing the path of the file.
+ * @param[in]	rules	Pointer to the rules splitting the input into words.
+ * @return	Return a pointer to the allocated vocabulary.
+ */
+Vocabulary* Vocabulary_create(const char *path, const TokenRules *rules);
+
+/**
+ * @brief Compiles the words of a file to a file which Vocabulary_create
+ * maps to memory in constant time, however many words it holds.
+ *
+ * @param[in]	path	Pointer to the string containing the path of the words.
+ * @param[in]	outPath	Pointer to the string containing the path of the compiled file.
+ * @param[in]	rules	Pointer to the rules splitting the input into words.
+ * @return	Return the status of the routine.
+ */
+RetStatus Vocabulary_compile(const char *path, const char *outPath, const TokenRules *rules);
+
+/**
+ * @brief Adds the occurrences of a word to its count,
+ * if the word is part of the vocabulary.
+ *
+ * @param[in, out]	vocab	Pointer to the vocabulary.
+ * @param[in]		wbuf	Pointer to the buffer of the word.
+ * @param[in]		count	The number of occurrences to be added.
+ * @return	Void
+ */
+void Vocabulary_count_word(Vocabulary *vocab, const WordBuffer *wbuf, const size_t count);
+
+/**
+ * @brief Prints the words of the vocabulary found in the input in alphabetical
+ * order along with their counts, in the format of WordHashTable_count_print.
+ *
+ * @param[in]	vocab	Pointer to the vocabulary.
+ * @return	Return the status of the routine.
+ */
+RetStatus Vocabulary_count_print(const Vocabulary *vocab);
+
+/**
+ * @brief Prints the number of words of the vocabulary and of the words
+ * counted and discarded.
+ *
+ * @param[in]	vocab	Pointer to the vocabulary.
+ * @return	Void
+ */
+void Vocabulary_stats_print(const Vocabulary *vocab);
+
+/**
+ * @brief Frees the memory allocated for the Vocabulary.
+ *
+ * @param[in, out]	vocab	Pointer to the pointer of the vocabulary.
+ * @return	Void
+ */
+void Vocabulary_destroy(Vocabulary **vocab);
+
+#endif /* VOCABULARY_H_ */
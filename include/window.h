@@ -0,0 +1,71 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef WINDOW_H_
+#define WINDOW_H_
+
+#include "memstructs.h"
+
+/// @brief A sliding window over the most recent words of a stream,
+/// limited in number of words, in age, or both.
+typedef struct SlidingWindow SlidingWindow;
+
+/**
+ * @brief Allocates a new Sliding Window with the specified limits.
+ *
+ * @param[in]	maxWords	The maximum number of words in the window, 0 for no limit.
+ * @param[in]	maxSeconds	The maximum age in seconds of the words in the window,
+ * 							0 for no limit.
+ * @return	Return a pointer to the allocated window.
+ */
+SlidingWindow* SlidingWindow_create(const size_t maxWords, const int64_t maxSeconds);
+
+/**
+ * @brief Counts a new word in the Hash table, removing from it the words
+ * falling out of the window.
+ * @details The window keeps the references of its words in a ring,
+ * so expired words are removed from the table without being copied.
+ * The table's strings pool is compacted once most of it is unused,
+ * keeping the memory bounded by the size of the window.
+ *
+ * @param[in, out]	win		Pointer to the window.
+ * @param[in, out]	whtab	Pointer to the table counting the window's words.
+ * @param[in]		wbuf	The Word Buffer of the new word.
+ * @param[in]		now		The arrival time of the word in seconds.
+ * @return	Returns the status of the routine.
+ */
+RetStatus SlidingWindow_push(SlidingWindow *win, WordHashTable *whtab,
+		const WordBuffer *wbuf, const int64_t now);
+
+/**
+ * @brief Prints in a human-readable way the statistics of the window.
+ *
+ * @param[in]	win	Pointer to the window.
+ * @return	Void
+ */
+void SlidingWindow_stats_print(const SlidingWindow *win);
+
+/**
+ * @brief Frees the memory allocated for the Sliding Window.
+ *
+ * @param[in, out]	win	Pointer to the pointer of the window.
+ * @return	Void
+ */
+void SlidingWindow_destroy(SlidingWindow **win);
+
+#endif /* WINDOW_H_ */
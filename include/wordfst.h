@@ -0,0 +1,163 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef WORDFST_H_
+#define WORDFST_H_
+
+#include "memstructs.h"
+
+/// The number of bytes of the magic number starting a transducer file.
+#define WORD_FST_MAGIC_LENGTH 8
+
+/// @brief The final words and counts of a run, stored as a minimal acyclic
+/// automaton whose arcs output the position of each word in alphabetical order.
+typedef struct WordFst WordFst;
+
+/// @brief A position in the words of a transducer, moving forward
+/// in alphabetical order.
+typedef struct WordFstCursor WordFstCursor;
+
+/**
+ * @brief Writes the words of a table and their counts to a file, as
+ * a minimal acyclic finite-state transducer.
+ * @details The words are added in alphabetical order, so that the states
+ * past the prefix shared by consecutive words are final and are merged with
+ * any equal state already built, leaving a minimal automaton at the end.
+ * Each arc outputs the number of words preceding the ones reached through it
+ * from its state, so the sum along the path of a word is its position in
+ * alphabetical order, which indexes an array of counts. The file is written
+ * in the byte order of the host.
+ *
+ * @param[in]	whtab	Pointer to the table.
+ * @param[in]	path	Pointer to the string containing the path of the file.
+ * @return	Return the status of the routine.
+ */
+RetStatus WordFst_export(const WordHashTable *whtab, const char *path);
+
+/**
+ * @brief Checks whether the first bytes of a file are those of a file
+ * written by WordFst_export.
+ * @details Only the bytes are checked, so that a stream whose first bytes
+ * were already read can still be read as another format.
+ *
+ * @param[in]	bytes	Pointer to the first bytes of the file.
+ * @param[in]	length	The number of bytes read.
+ * @return	Returns true if the bytes start with the magic number of the format.
+ */
+bool WordFst_is_magic(const char *bytes, const size_t length);
+
+/**
+ * @brief Opens a file written by WordFst_export.
+ * @details The file is mapped to memory as it is, so it is opened in the same
+ * time for any number of words, apart from checking that its arcs point to
+ * valid states.
+ *
+ * @param[in]	path	Pointer to the string containing the path of the file.
+ * @return	Return a pointer to the allocated transducer, NULL if the file is invalid.
+ */
+WordFst* WordFst_open(const char *path);
+
+/**
+ * @brief Gets the totals of the words of a transducer, reading its counts
+ * but not its words.
+ *
+ * @param[in]	fst			Pointer to the transducer.
+ * @param[out]	total		Pointer to the sum of the counts of the words.
+ * @param[out]	maxCount	Pointer to the highest count.
+ * @param[out]	maxLength	Pointer to the length of the longest word.
+ * @return	Returns the number of words.
+ */
+size_t WordFst_totals(const WordFst *fst, uint64_t *total, uint64_t *maxCount,
+		uint32_t *maxLength);
+
+/**
+ * @brief Prints the words starting with a prefix along with their counts,
+ * in the format of WordHashTable_count_print.
+ *
+ * @param[in]	fst		Pointer to the transducer.
+ * @param[in]	prefix	Pointer to the null terminated string of the prefix.
+ * @return	Return the status of the routine.
+ */
+RetStatus WordFst_print_prefix(const WordFst *fst, const char *prefix);
+
+/**
+ * @brief Prints the words from a word up to, but excluding, another one
+ * along with their counts, in the format of WordHashTable_count_print.
+ *
+ * @param[in]	fst		Pointer to the transducer.
+ * @param[in]	from	Pointer to the null terminated string of the first word.
+ * @param[in]	to		Pointer to the null terminated string of the word ending
+ * 						the range, NULL to print up to the last word.
+ * @return	Return the status of the routine.
+ */
+RetStatus WordFst_print_range(const WordFst *fst, const char *from, const char *to);
+
+/**
+ * @brief Allocates a cursor over the words from a word up to, but excluding,
+ * another one.
+ * @details The cursor starts on the path of the first word, so the words
+ * before it are never visited.
+ *
+ * @param[in]	fst		Pointer to the transducer, which has to outlive the cursor.
+ * @param[in]	from	Pointer to the null terminated string of the first word.
+ * @param[in]	to		Pointer to the null terminated string of the word ending
+ * 						the range, NULL for no end.
+ * @return	Return a pointer to the allocated cursor.
+ */
+WordFstCursor* WordFstCursor_create(const WordFst *fst, const char *from, const char *to);
+
+/**
+ * @brief Moves the cursor to the next word, by a depth-first traversal
+ * of the automaton.
+ *
+ * @param[in, out]	cursor	Pointer to the cursor.
+ * @param[out]		word	Pointer to the characters of the word, which are not
+ * 							null terminated and change on the next call.
+ * @param[out]		length	Pointer to the length of the word.
+ * @param[out]		count	Pointer to the count of the word.
+ * @return	Returns false once the range is exhausted or a path is found invalid.
+ */
+bool WordFstCursor_next(WordFstCursor *cursor, const char **word, uint32_t *length,
+		uint64_t *count);
+
+/**
+ * @brief Checks whether the cursor stopped on an invalid path of the automaton.
+ *
+ * @param[in]	cursor	Pointer to the cursor.
+ * @return	Returns true if a path was found invalid.
+ */
+bool WordFstCursor_failed(const WordFstCursor *cursor);
+
+/**
+ * @brief Frees the memory allocated for the cursor.
+ *
+ * @param[in, out]	cursor	Pointer to the pointer of the cursor.
+ * @return	Void
+ */
+void WordFstCursor_destroy(WordFstCursor **cursor);
+
+/**
+ * @brief Frees the memory allocated for the transducer.
+ *
+ * @param[in, out]	fst	Pointer to the pointer of the transducer.
+ * @return	Void
+ */
+void WordFst_destroy(WordFst **fst);
+
+#endif /* WORDFST_H_ */
@@ -0,0 +1,110 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef WORDSET_H_
+#define WORDSET_H_
+
+#include "memstructs.h"
+#include "tokenizer.h"
+
+/// The index returned for the words missing from a set.
+#define WORD_SET_MISSING UINT32_MAX
+
+/// @brief A fixed set of distinct words, each mapped to an index of its own
+/// through a minimal perfect hash.
+typedef struct WordSet WordSet;
+
+/**
+ * @brief Allocates a new Word Set from the words of a file.
+ * @details The file is tokenized with the same rules as the input,
+ * so that its words are case folded like the words looked up.
+ * Each word is then placed in its own slot of a table of as many slots
+ * as words, found by hashing it with the seed of its bucket.
+ * Files written by WordSet_save are instead mapped to memory as they are,
+ * in constant time, if they were compiled with the same rules.
+ *
+ * @param[in]	path	Pointer to the string containing the path of the file.
+ * @param[in]	rules	Pointer to the rules splitting the input into words.
+ * @param[in]	name	Pointer to the string naming the words in error messages.
+ * @return	Return a pointer to the allocated set.
+ */
+WordSet* WordSet_create(const char *path, const TokenRules *rules, const char *name);
+
+/**
+ * @brief Writes a Word Set to a file, which WordSet_create maps back
+ * to memory without building the set again.
+ * @details The file holds the table of the set as it is in memory,
+ * in the byte order of the host, along with the signature of the rules
+ * its words were read with.
+ *
+ * @param[in]	set		Pointer to the set.
+ * @param[in]	rules	Pointer to the rules the words of the set were read with.
+ * @param[in]	path	Pointer to the string containing the path of the file.
+ * @return	Return the status of the routine.
+ */
+RetStatus WordSet_save(const WordSet *set, const TokenRules *rules, const char *path);
+
+/**
+ * @brief Finds the index of a word in the set.
+ *
+ * @param[in]	set		Pointer to the set.
+ * @param[in]	wbuf	Pointer to the buffer of the word.
+ * @return	The index of the word, below the size of the set,
+ * or WORD_SET_MISSING if the word is not in the set.
+ */
+uint32_t WordSet_find(const WordSet *set, const WordBuffer *wbuf);
+
+/**
+ * @brief Gets the number of words of the set.
+ *
+ * @param[in]	set	Pointer to the set.
+ * @return	The number of words.
+ */
+uint32_t WordSet_size(const WordSet *set);
+
+/**
+ * @brief Gets the word of an index of the set.
+ * @details The word is not null-terminated.
+ *
+ * @param[in]	set		Pointer to the set.
+ * @param[in]	index	The index of the word.
+ * @param[out]	length	Pointer to the length of the word.
+ * @return	Pointer to the characters of the word, NULL if the index
+ * is not below the size of the set.
+ */
+const char* WordSet_word(const WordSet *set, const uint32_t index, uint32_t *length);
+
+/**
+ * @brief Gets a hash identifying the words of the set, so that counts saved
+ * with different sets are not mixed.
+ *
+ * @param[in]	set	Pointer to the set.
+ * @return	The signature of the set, 0 if it is empty.
+ */
+uint64_t WordSet_signature(const WordSet *set);
+
+/**
+ * @brief Frees the memory allocated for the Word Set.
+ *
+ * @param[in, out]	set	Pointer to the pointer of the set.
+ * @return	Void
+ */
+void WordSet_destroy(WordSet **set);
+
+#endif /* WORDSET_H_ */
@@ -0,0 +1,75 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef WORDTREE_H_
+#define WORDTREE_H_
+
+#include "memstructs.h"
+
+/// @brief An adaptive radix tree counting the occurrences of each word,
+/// whose traversal visits the words in alphabetical order.
+typedef struct WordTree WordTree;
+
+/**
+ * @brief Allocates a new empty Word Tree.
+ *
+ * @return	Return a pointer to the allocated tree.
+ */
+WordTree* WordTree_create(void);
+
+/**
+ * @brief Adds the occurrences of a word to the tree.
+ * @details The nodes of the tree grow from 4 to 16, 48 and 256 children
+ * as needed, and the bytes shared by all the words below a node are kept
+ * once, in the node.
+ *
+ * @param[in, out]	tree	Pointer to the tree.
+ * @param[in]		wbuf	Pointer to the buffer of the word.
+ * @param[in]		count	The number of occurrences to be added.
+ * @return	Return the status of the routine.
+ */
+RetStatus WordTree_count_word(WordTree *tree, const WordBuffer *wbuf, const size_t count);
+
+/**
+ * @brief Prints the words of the tree in alphabetical order along with
+ * their counts, in the format of WordHashTable_count_print.
+ *
+ * @param[in, out]	tree	Pointer to the tree.
+ * @return	Return the status of the routine.
+ */
+RetStatus WordTree_count_print(WordTree *tree);
+
+/**
+ * @brief Prints the number of words and nodes of the tree
+ * and the memory they take.
+ *
+ * @param[in]	tree	Pointer to the tree.
+ * @return	Void
+ */
+void WordTree_stats_print(const WordTree *tree);
+
+/**
+ * @brief Frees the memory allocated for the Word Tree.
+ *
+ * @param[in, out]	tree	Pointer to the pointer of the tree.
+ * @return	Void
+ */
+void WordTree_destroy(WordTree **tree);
+
+#endif /* WORDTREE_H_ */
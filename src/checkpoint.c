@@ -0,0 +1,280 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "checkpoint.h"
+#include "utils.h"
+#include "frontcoded.h"
+#include <string.h>
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif //_WIN32
+
+/// The initial capacity of a table restored from a checkpoint.
+#define RESTORED_TABLE_CAPACITY 1024
+
+/// Identifies the checkpoint file format.
+static const char checkpointMagic[8] = {'W', 'C', 'C', 'K', 'P', 'T', '0', '3'};
+
+struct Checkpoint
+{
+	/// The path of the checkpoint file.
+	char *path;
+	/// The path of the file a new checkpoint is written to,
+	/// before replacing the previous one.
+	char *tmpPath;
+	/// The minimum number of words counted between two consecutive checkpoints.
+	size_t interval;
+	/// The signature of the token rules of the run.
+	uint64_t rules;
+	/// The number of words counted when the last checkpoint was saved.
+	size_t lastWords;
+#ifndef _WIN32
+	/// The process writing the last checkpoint, 0 if there is none.
+	pid_t writerPid;
+#endif //_WIN32
+};
+
+Checkpoint* Checkpoint_create(const char *path, const size_t interval,
+		const uint64_t rules)
+{
+	Checkpoint *chkp = (Checkpoint*) calloc(1, sizeof(Checkpoint));
+	if(chkp == NULL)
+	{
+		fprintf(stderr, "Initial allocation for the Checkpoint failed.\n");
+		return NULL;
+	}
+
+	const size_t pathLen = strlen(path) + 1;
+	chkp->path = (char*) calloc(pathLen, sizeof(char));
+	chkp->tmpPath = (char*) calloc(pathLen + 4, sizeof(char));
+	if((chkp->path == NULL) || (chkp->tmpPath == NULL))
+	{
+		fprintf(stderr, "Failed to allocate the paths of the Checkpoint.\n");
+		free(chkp->path);
+		free(chkp->tmpPath);
+		free(chkp);
+		return NULL;
+	}
+	string_copy(chkp->path, path, pathLen);
+	snprintf(chkp->tmpPath, pathLen + 4, "%s.tmp", path);
+	chkp->interval = interval;
+	chkp->rules = rules;
+
+	return chkp;
+}
+
+RetStatus Checkpoint_restore(Checkpoint *chkp, WordHashTable **whtab,
+		uint64_t *offset, size_t *words)
+{
+	*whtab = NULL;
+
+	FILE *fp;
+	/// A missing checkpoint file means that the run starts from scratch.
+	if(!file_open(&fp, chkp->path, "rb")) return SUCCESS;
+
+	char magic[sizeof(checkpointMagic)];
+	uint64_t savedRules = 0;
+	uint64_t savedOffset = 0;
+	uint64_t savedWords = 0;
+	if((fread(magic, sizeof(magic), 1, fp) != 1) ||
+		(memcmp(magic, checkpointMagic, sizeof(checkpointMagic)) != 0) ||
+		(fread(&savedRules, sizeof(savedRules), 1, fp) != 1) ||
+		(fread(&savedOffset, sizeof(savedOffset), 1, fp) != 1) ||
+		(fread(&savedWords, sizeof(savedWords), 1, fp) != 1))
+	{
+		fprintf(stderr, "Invalid checkpoint file: %s\n", chkp->path);
+		fclose(fp);
+		return GEN_FAIL;
+	}
+	/// Words split by other rules would be counted differently.
+	if(savedRules != chkp->rules)
+	{
+		fprintf(stderr, "Checkpoint file %s was saved with different token rules.\n",
+				chkp->path);
+		fclose(fp);
+		return GEN_FAIL;
+	}
+
+	WordHashTable *restored = WordHashTable_create(RESTORED_TABLE_CAPACITY);
+	if(restored == NULL)
+	{
+		fclose(fp);
+		return GEN_FAIL;
+	}
+	if(FrontCodedWords_load(restored, fp) != SUCCESS)
+	{
+		fprintf(stderr, "Failed to restore the table of checkpoint: %s\n",
+				chkp->path);
+		WordHashTable_destroy(&restored);
+		fclose(fp);
+		return GEN_FAIL;
+	}
+	fclose(fp);
+
+	*whtab = restored;
+	*offset = savedOffset;
+	*words = (size_t)savedWords;
+	chkp->lastWords = (size_t)savedWords;
+
+	return SUCCESS;
+}
+
+bool Checkpoint_due(const Checkpoint *chkp, const size_t words)
+{
+	return (words - chkp->lastWords >= chkp->interval);
+}
+
+/**
+ * @brief Writes the checkpoint to a temporary file which then
+ * atomically replaces the checkpoint file.
+ *
+ * @param[in]	chkp	Pointer to the checkpoint.
+ * @param[in]	whtab	Pointer to the table counted up to the offset.
+ * @param[in]	offset	The input offset reached.
+ * @param[in]	words	The total number of words counted.
+ * @return	Returns the status of the routine.
+ */
+static RetStatus checkpoint_write(const Checkpoint *chkp, const WordHashTable *whtab,
+		const uint64_t offset, const size_t words)
+{
+	FILE *fp;
+	if(!file_open(&fp, chkp->tmpPath, "wb"))
+	{
+		fprintf(stderr, "Failed to open checkpoint file: %s\n", chkp->tmpPath);
+		return GEN_FAIL;
+	}
+
+	const uint64_t savedWords = words;
+	if((fwrite(checkpointMagic, sizeof(checkpointMagic), 1, fp) != 1) ||
+		(fwrite(&(chkp->rules), sizeof(chkp->rules), 1, fp) != 1) ||
+		(fwrite(&offset, sizeof(offset), 1, fp) != 1) ||
+		(fwrite(&savedWords, sizeof(savedWords), 1, fp) != 1) ||
+		(FrontCodedWords_dump(whtab, fp) != SUCCESS))
+	{
+		fprintf(stderr, "Failed to write checkpoint file: %s\n", chkp->tmpPath);
+		fclose(fp);
+		remove(chkp->tmpPath);
+		return GEN_FAIL;
+	}
+	if(fclose(fp) != 0)
+	{
+		remove(chkp->tmpPath);
+		return GEN_FAIL;
+	}
+
+#ifdef _WIN32
+	/// rename does not replace existing files on Windows.
+	remove(chkp->path);
+#endif //_WIN32
+	if(rename(chkp->tmpPath, chkp->path) != 0)
+	{
+		fprintf(stderr, "Failed to replace checkpoint file: %s\n", chkp->path);
+		return GEN_FAIL;
+	}
+
+	return SUCCESS;
+}
+
+#ifndef _WIN32
+/**
+ * @brief Collects the process writing the last checkpoint.
+ *
+ * @param[in, out]	chkp	Pointer to the checkpoint.
+ * @param[in]		block	Whether to wait for the process to finish.
+ * @return	Returns true if no checkpoint is being written anymore.
+ */
+static bool checkpoint_writer_collect(Checkpoint *chkp, const bool block)
+{
+	if(chkp->writerPid <= 0) return true;
+
+	int status = 0;
+	const pid_t ret = waitpid(chkp->writerPid, &status, block ? 0 : WNOHANG);
+	if(ret == 0) return false;
+
+	if((ret < 0) || !WIFEXITED(status) || (WEXITSTATUS(status) != EXIT_SUCCESS))
+	{
+		fprintf(stderr, "Writing checkpoint file %s failed.\n", chkp->path);
+	}
+	chkp->writerPid = 0;
+
+	return true;
+}
+#endif //_WIN32
+
+RetStatus Checkpoint_save(Checkpoint *chkp, const WordHashTable *whtab,
+		InputStream *stream, const uint64_t offset, const size_t words)
+{
+#ifndef _WIN32
+	/// Counting is never paused waiting for a previous checkpoint,
+	/// the new one is skipped instead.
+	if(!checkpoint_writer_collect(chkp, false))
+	{
+#ifdef _DEBUG
+		printf("Previous checkpoint still being written. Skipping.\n");
+#endif //_DEBUG
+		return SUCCESS;
+	}
+
+	/// The forked process holds a copy-on-write snapshot of the table,
+	/// so only the pages modified meanwhile are ever copied. It only runs
+	/// this thread, so the decompression thread is parked first, to not
+	/// leave the locks of the allocator or of stdio held in the snapshot.
+	InputStream_pause(stream);
+	const pid_t pid = fork();
+	if(pid == 0)
+	{
+		_exit((checkpoint_write(chkp, whtab, offset, words) == SUCCESS)
+				? EXIT_SUCCESS : EXIT_FAILURE);
+	}
+	InputStream_resume(stream);
+	if(pid > 0)
+	{
+		chkp->writerPid = pid;
+		chkp->lastWords = words;
+		return SUCCESS;
+	}
+	/// If forking fails, the checkpoint is written synchronously.
+#endif //_WIN32
+
+	if(checkpoint_write(chkp, whtab, offset, words) != SUCCESS) return GEN_FAIL;
+	chkp->lastWords = words;
+
+	return SUCCESS;
+}
+
+void Checkpoint_discard(Checkpoint *chkp)
+{
+#ifndef _WIN32
+	checkpoint_writer_collect(chkp, true);
+#endif //_WIN32
+	remove(chkp->path);
+	remove(chkp->tmpPath);
+}
+
+void Checkpoint_destroy(Checkpoint **chkp)
+{
+#ifndef _WIN32
+	checkpoint_writer_collect(*chkp, true);
+#endif //_WIN32
+	free((*chkp)->path);
+	free((*chkp)->tmpPath);
+	free(*chkp);
+	*chkp = NULL;
+}
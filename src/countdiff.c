@@ -0,0 +1,528 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "countdiff.h"
+#include "wordfst.h"
+#include "utils.h"
+#include "unicode.h"
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+
+/// The initial length of the buffers of the lines and words read.
+#define DIFF_LINE_LENGTH 256
+
+/// The initial number of rows kept until the totals are known.
+#define DIFF_INITIAL_ROWS 1024
+
+/// The line starting the counts of the output of a run.
+static const char countsTitle[] = "Number of appearances of each word:";
+
+/// @brief The words of one side of the comparison, read in alphabetical order
+/// from either the output of a run or an FST.
+typedef struct
+{
+	/// Pointer to the string containing the path of the file.
+	const char *path;
+	/// The output of a run, NULL for an FST.
+	FILE *fp;
+	/// The first bytes of the file, read to tell FSTs apart and
+	/// then as the start of the output of a run.
+	char head[WORD_FST_MAGIC_LENGTH];
+	size_t headLength;
+	size_t headPos;
+	/// The current line of the output.
+	char *line;
+	size_t lineCapacity;
+	size_t lineNumber;
+	/// The previous word of the output, to check their order.
+	char *prev;
+	size_t prevCapacity;
+	uint32_t prevLength;
+	bool hasPrev;
+	/// The FST, NULL for the output of a run.
+	WordFst *fst;
+	WordFstCursor *cursor;
+	/// The current word, which changes on the next read.
+	const char *word;
+	uint32_t length;
+	uint64_t count;
+	/// Whether the last word was read.
+	bool ended;
+	/// Whether the file was found invalid.
+	bool failed;
+	/// The number of words, the sum of their counts, the longest word
+	/// and the highest count, known on opening for an FST and
+	/// once all its words are read for the output of a run.
+	size_t numWords;
+	uint64_t total;
+	uint32_t maxLength;
+	uint64_t maxCount;
+}CountReader;
+
+/// @brief A word of the comparison, kept until the totals are known.
+typedef struct
+{
+	/// The offset of the word in the characters of the rows.
+	size_t offset;
+	uint32_t length;
+	uint64_t oldCount;
+	uint64_t newCount;
+}DiffRow;
+
+/// @brief The words of the comparison kept until the totals are known.
+typedef struct
+{
+	DiffRow *rows;
+	size_t numRows;
+	size_t rowCapacity;
+	/// The characters of the words, one after the other.
+	char *letters;
+	size_t numLetters;
+	size_t letterCapacity;
+}DiffRows;
+
+/// @brief The format of the rows of the comparison.
+typedef struct
+{
+	/// The totals the frequencies of each side are relative to.
+	double oldTotal;
+	double newTotal;
+	/// The smallest absolute log ratio of the words printed.
+	double threshold;
+	/// The widths of the columns of the words and counts.
+	int maxWordLength;
+	int maxDigitsCount;
+	uint32_t numOfDashes;
+}DiffFormat;
+
+/**
+ * @brief Makes room for at least two more characters in the line buffer
+ * of the reader.
+ *
+ * @param[in, out]	rd	Pointer to the reader.
+ * @param[in]		len	The number of characters of the line.
+ * @return	Returns false on failure.
+ */
+static bool line_reserve(CountReader *rd, const size_t len)
+{
+	if(rd->lineCapacity - len >= 2) return true;
+	const size_t capacity = (rd->lineCapacity == 0) ? DIFF_LINE_LENGTH : 2 * rd->lineCapacity;
+	char *line = (char*) realloc(rd->line, capacity);
+	if(line == NULL)
+	{
+		fprintf(stderr, "Failed to allocate a line of %s.\n", rd->path);
+		rd->failed = true;
+		return false;
+	}
+	rd->line = line;
+	rd->lineCapacity = capacity;
+	return true;
+}
+
+/**
+ * @brief Reads a line of the output into the buffer of the reader,
+ * without its line terminator.
+ *
+ * @param[in, out]	rd	Pointer to the reader.
+ * @return	Returns false at the end of the file or on failure.
+ */
+static bool read_line(CountReader *rd)
+{
+	size_t len = 0;
+	bool ended = false;
+	/// The bytes read to tell FSTs apart start the first lines.
+	while(!ended && (rd->headPos < rd->headLength))
+	{
+		if(!line_reserve(rd, len)) return false;
+		rd->line[len] = rd->head[rd->headPos++];
+		ended = (rd->line[len++] == '\n');
+	}
+	while(!ended)
+	{
+		if(!line_reserve(rd, len)) return false;
+		const size_t room = rd->lineCapacity - len;
+		if(fgets(rd->line + len, (room > INT_MAX) ? INT_MAX : (int)room, rd->fp) == NULL) break;
+		len += strlen(rd->line + len);
+		ended = (len > 0) && (rd->line[len - 1] == '\n');
+	}
+	if(len == 0) return false;
+	rd->line[len] = '\0';
+	rd->lineNumber++;
+	while((len > 0) && ((rd->line[len - 1] == '\n') || (rd->line[len - 1] == '\r')))
+	{
+		rd->line[--len] = '\0';
+	}
+	return true;
+}
+
+/**
+ * @brief Opens a file of counts, as an FST if it starts with its magic number
+ * or as the output of a run otherwise, and moves the reader before its first word.
+ * @details The output of a run is only read forward, so it may be a pipe.
+ *
+ * @param[out]	rd		Pointer to the reader to be set.
+ * @param[in]	path	Pointer to the string containing the path of the file.
+ * @return	Return the status of the routine.
+ */
+static RetStatus reader_open(CountReader *rd, const char *path)
+{
+	rd->path = path;
+	if(!file_open(&(rd->fp), path, "rb"))
+	{
+		fprintf(stderr, "Failed to open counts file: %s\n", path);
+		return GEN_FAIL;
+	}
+	rd->headLength = fread(rd->head, 1, sizeof(rd->head), rd->fp);
+	if(WordFst_is_magic(rd->head, rd->headLength))
+	{
+		fclose(rd->fp);
+		rd->fp = NULL;
+		rd->fst = WordFst_open(path);
+		if(rd->fst == NULL) return GEN_FAIL;
+		rd->numWords = WordFst_totals(rd->fst, &(rd->total), &(rd->maxCount), &(rd->maxLength));
+		rd->cursor = WordFstCursor_create(rd->fst, "", NULL);
+		return (rd->cursor != NULL) ? SUCCESS : GEN_FAIL;
+	}
+
+	/// The counts follow the title and the two lines heading their columns,
+	/// an empty file holding no words.
+	while(read_line(rd))
+	{
+		if(strcmp(rd->line, countsTitle) != 0) continue;
+		if(!read_line(rd) || !read_line(rd) || (rd->line[0] != '-')) break;
+		return SUCCESS;
+	}
+	if(rd->failed) return GEN_FAIL;
+	if(rd->lineNumber == 0)
+	{
+		rd->ended = true;
+		return SUCCESS;
+	}
+	fprintf(stderr, "No word counts found in %s\n", rd->path);
+	return GEN_FAIL;
+}
+
+/**
+ * @brief Reads the next word of the output of a run, checking that
+ * it follows the previous one in alphabetical order.
+ *
+ * @param[in, out]	rd	Pointer to the reader.
+ * @return	Returns false once the last word was read or on failure.
+ */
+static bool reader_next_line(CountReader *rd)
+{
+	if(!read_line(rd))
+	{
+		if(!rd->failed) fprintf(stderr, "Truncated counts in %s\n", rd->path);
+		rd->failed = true;
+		return false;
+	}
+	/// The counts end with a line of dashes.
+	if(rd->line[0] == '-')
+	{
+		rd->ended = true;
+		return false;
+	}
+	/// Each row holds the word indented by four spaces, the padding
+	/// of its column and the count.
+	char *word = rd->line + 4;
+	char *wordEnd = (strncmp(rd->line, "    ", 4) == 0) ? strchr(word, ' ') : NULL;
+	char *end = NULL;
+	unsigned long long count = 0;
+	if((wordEnd != NULL) && (wordEnd != word))
+	{
+		count = strtoull(wordEnd, &end, 10);
+	}
+	if((end == NULL) || (end == wordEnd) || (*end != '\0'))
+	{
+		fprintf(stderr, "Invalid line %ld of %s\n", rd->lineNumber, rd->path);
+		rd->failed = true;
+		return false;
+	}
+	rd->word = word;
+	rd->length = (uint32_t)(wordEnd - word);
+	rd->count = (uint64_t)count;
+
+	/// The words are merged assuming the order they are printed in.
+	if(rd->hasPrev)
+	{
+		const uint32_t shorter = (rd->length < rd->prevLength) ? rd->length : rd->prevLength;
+		const int cmp = memcmp(rd->prev, rd->word, shorter);
+		if((cmp > 0) || ((cmp == 0) && (rd->prevLength >= rd->length)))
+		{
+			fprintf(stderr, "Words out of order at line %ld of %s\n", rd->lineNumber, rd->path);
+			rd->failed = true;
+			return false;
+		}
+	}
+	if(rd->length > rd->prevCapacity)
+	{
+		char *prev = (char*) realloc(rd->prev, rd->lineCapacity);
+		if(prev == NULL)
+		{
+			fprintf(stderr, "Failed to allocate a word of %s.\n", rd->path);
+			rd->failed = true;
+			return false;
+		}
+		rd->prev = prev;
+		rd->prevCapacity = rd->lineCapacity;
+	}
+	memcpy(rd->prev, rd->word, rd->length);
+	rd->prevLength = rd->length;
+	rd->hasPrev = true;
+
+	rd->numWords++;
+	rd->total += rd->count;
+	if(rd->length > rd->maxLength) rd->maxLength = rd->length;
+	if(rd->count > rd->maxCount) rd->maxCount = rd->count;
+	return true;
+}
+
+/**
+ * @brief Reads the next word of the file of the reader.
+ *
+ * @param[in, out]	rd	Pointer to the reader.
+ * @return	Returns false once the last word was read or on failure.
+ */
+static bool reader_next(CountReader *rd)
+{
+	if(rd->ended || rd->failed) return false;
+	if(rd->fst != NULL)
+	{
+		if(WordFstCursor_next(rd->cursor, &(rd->word), &(rd->length), &(rd->count))) return true;
+		rd->ended = true;
+		rd->failed = WordFstCursor_failed(rd->cursor);
+		return false;
+	}
+	return reader_next_line(rd);
+}
+
+/**
+ * @brief Frees the memory allocated for the reader and closes its file.
+ *
+ * @param[in, out]	rd	Pointer to the reader.
+ * @return	Void
+ */
+static void reader_close(CountReader *rd)
+{
+	if(rd->cursor != NULL) WordFstCursor_destroy(&(rd->cursor));
+	if(rd->fst != NULL) WordFst_destroy(&(rd->fst));
+	if(rd->fp != NULL) fclose(rd->fp);
+	free(rd->line);
+	free(rd->prev);
+}
+
+/**
+ * @brief Adds a word of the comparison to the rows kept.
+ *
+ * @param[in, out]	rows		Pointer to the rows.
+ * @param[in]		word		Pointer to the characters of the word.
+ * @param[in]		length		The length of the word.
+ * @param[in]		oldCount	The count of the word in the old counts.
+ * @param[in]		newCount	The count of the word in the new counts.
+ * @return	Return the status of the routine.
+ */
+static RetStatus rows_add(DiffRows *rows, const char *word, const uint32_t length,
+		const uint64_t oldCount, const uint64_t newCount)
+{
+	if(rows->numRows == rows->rowCapacity)
+	{
+		const size_t capacity = (rows->rowCapacity == 0) ? DIFF_INITIAL_ROWS :
+				2 * rows->rowCapacity;
+		DiffRow *grown = (DiffRow*) realloc(rows->rows, capacity * sizeof(DiffRow));
+		if(grown == NULL)
+		{
+			fprintf(stderr, "Failed to allocate the rows of the comparison.\n");
+			return GEN_FAIL;
+		}
+		rows->rows = grown;
+		rows->rowCapacity = capacity;
+	}
+	if(rows->letterCapacity - rows->numLetters < length)
+	{
+		const size_t capacity = next_2power(rows->numLetters + length);
+		char *grown = (char*) realloc(rows->letters, capacity);
+		if(grown == NULL)
+		{
+			fprintf(stderr, "Failed to allocate the words of the comparison.\n");
+			return GEN_FAIL;
+		}
+		rows->letters = grown;
+		rows->letterCapacity = capacity;
+	}
+	DiffRow *row = &(rows->rows[rows->numRows++]);
+	row->offset = rows->numLetters;
+	row->length = length;
+	row->oldCount = oldCount;
+	row->newCount = newCount;
+	memcpy(rows->letters + rows->numLetters, word, length);
+	rows->numLetters += length;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Sets the totals of the format and prints the title and
+ * the heading of the columns of the comparison.
+ *
+ * @param[out]	format		Pointer to the format to be set.
+ * @param[in]	older		Pointer to the reader of the old counts.
+ * @param[in]	newer		Pointer to the reader of the new counts.
+ * @param[in]	threshold	The smallest absolute log ratio of the words printed.
+ * @return	Void
+ */
+static void diff_header_print(DiffFormat *format, const CountReader *older,
+		const CountReader *newer, const double threshold)
+{
+	/// The frequencies are relative to the total counts, those of an empty
+	/// side to the total of the other one, so that its missing words
+	/// compare as they would to a side of the same size.
+	const uint64_t anyTotal = (older->total != 0) ? older->total :
+			((newer->total != 0) ? newer->total : 1);
+	format->oldTotal = (double)((older->total != 0) ? older->total : anyTotal);
+	format->newTotal = (double)((newer->total != 0) ? newer->total : anyTotal);
+	format->threshold = threshold;
+	const uint32_t maxLength = (older->maxLength > newer->maxLength) ? older->maxLength :
+			newer->maxLength;
+	const uint64_t maxCount = (older->maxCount > newer->maxCount) ? older->maxCount :
+			newer->maxCount;
+	/// The word column is as wide as that of CountTable_print.
+	format->maxWordLength = (int)maxLength + 1;
+	format->maxDigitsCount = (int)num_of_digits((size_t)maxCount);
+	if(format->maxDigitsCount < 3) format->maxDigitsCount = 3;
+
+	printf("Words whose frequency changed by a log ratio of at least %.2f:\n", threshold);
+	printf("    %-*s    %*s    %*s    %s\n", format->maxWordLength, "Word",
+			format->maxDigitsCount, "Old", format->maxDigitsCount, "New", "Log ratio");
+	format->numOfDashes = (uint32_t)snprintf(NULL, 0, "    %-*s    %*s    %*s    %s\n",
+			format->maxWordLength, "Word", format->maxDigitsCount, "Old",
+			format->maxDigitsCount, "New", "Log ratio") + 3;
+	print_dash_line(format->numOfDashes);
+}
+
+/**
+ * @brief Prints the row of a word if the log ratio of its frequencies
+ * reaches the threshold.
+ *
+ * @param[in]	format		Pointer to the format of the rows.
+ * @param[in]	word		Pointer to the characters of the word.
+ * @param[in]	length		The length of the word.
+ * @param[in]	oldCount	The count of the word in the old counts.
+ * @param[in]	newCount	The count of the word in the new counts.
+ * @return	Returns true if the row was printed.
+ */
+static bool diff_row_print(const DiffFormat *format, const char *word, const uint32_t length,
+		const uint64_t oldCount, const uint64_t newCount)
+{
+	const double ratio = log2((((newCount != 0) ? (double)newCount : 0.5) / format->newTotal) /
+			(((oldCount != 0) ? (double)oldCount : 0.5) / format->oldTotal));
+	if(fabs(ratio) < format->threshold) return false;
+	/// The words are padded by their code points, as by CountTable_print.
+	printf("    %.*s%*s    %*ld    %*ld    %+9.2f\n", (int)length, word,
+			format->maxWordLength - (int)utf8_length((const uint8_t*)word, length), "",
+			format->maxDigitsCount, oldCount, format->maxDigitsCount, newCount, ratio);
+	return true;
+}
+
+RetStatus CountDiff_print(const char *oldPath, const char *newPath, const double threshold)
+{
+	CountReader sides[2] = {{0}};
+	CountReader *older = &(sides[0]);
+	CountReader *newer = &(sides[1]);
+	if((reader_open(older, oldPath) != SUCCESS) || (reader_open(newer, newPath) != SUCCESS))
+	{
+		reader_close(older);
+		reader_close(newer);
+		return GEN_FAIL;
+	}
+
+	/// The totals of FSTs are known on opening, so two of them are printed
+	/// while merged. The totals of the output of a run are only known once
+	/// it is read, and even a word whose count did not change may change
+	/// in frequency, so the words are kept until the end of the merge.
+	const bool streamed = (older->fst != NULL) && (newer->fst != NULL);
+	DiffFormat format = {0};
+	DiffRows rows = {0};
+	if(streamed) diff_header_print(&format, older, newer, threshold);
+
+	/// Both sides are in alphabetical order, so each word is found
+	/// on either or both of their current positions.
+	size_t numCompared = 0;
+	size_t numPrinted = 0;
+	bool failed = false;
+	bool hasOld = reader_next(older);
+	bool hasNew = reader_next(newer);
+	while(hasOld || hasNew)
+	{
+		int cmp = 0;
+		if(!hasOld) cmp = 1;
+		else if(!hasNew) cmp = -1;
+		else
+		{
+			const uint32_t shorter = (older->length < newer->length) ? older->length : newer->length;
+			cmp = memcmp(older->word, newer->word, shorter);
+			if(cmp == 0) cmp = (older->length < newer->length) ? -1 : (older->length > newer->length);
+		}
+		const CountReader *side = (cmp <= 0) ? older : newer;
+		const uint64_t oldCount = (cmp <= 0) ? older->count : 0;
+		const uint64_t newCount = (cmp >= 0) ? newer->count : 0;
+		numCompared++;
+		if(streamed)
+		{
+			if(diff_row_print(&format, side->word, side->length, oldCount, newCount)) numPrinted++;
+		}
+		else if(rows_add(&rows, side->word, side->length, oldCount, newCount) != SUCCESS)
+		{
+			failed = true;
+			break;
+		}
+		if(cmp <= 0) hasOld = reader_next(older);
+		if(cmp >= 0) hasNew = reader_next(newer);
+	}
+	failed = failed || older->failed || newer->failed;
+
+	if(!streamed && !failed)
+	{
+		diff_header_print(&format, older, newer, threshold);
+		for(size_t i = 0; i < rows.numRows; i++)
+		{
+			const DiffRow *row = &(rows.rows[i]);
+			if(diff_row_print(&format, rows.letters + row->offset, row->length,
+					row->oldCount, row->newCount)) numPrinted++;
+		}
+	}
+	if(streamed || !failed)
+	{
+		print_dash_line(format.numOfDashes);
+#ifdef _STATS
+		printf("\nDiff statistics:\n");
+		printf("\tOld words: %ld, total count %ld\n", older->numWords, older->total);
+		printf("\tNew words: %ld, total count %ld\n", newer->numWords, newer->total);
+		printf("\tWords compared: %ld\n", numCompared);
+		printf("\tWords printed: %ld\n", numPrinted);
+#endif //_STATS
+	}
+	free(rows.rows);
+	free(rows.letters);
+	reader_close(older);
+	reader_close(newer);
+
+	return failed ? GEN_FAIL : SUCCESS;
+}
@@ -0,0 +1,83 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "cpuisa.h"
+#include <string.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif //_MSC_VER
+
+/// The names of the extensions, in the order of CpuIsa.
+static const char *isaNames[] = {"scalar", "sse2", "avx2", "avx512bw"};
+
+CpuIsa CpuIsa_detect(void)
+{
+#if defined(CPU_ISA_X86) && (defined(__GNUC__) || defined(__clang__))
+	/// The checks include the support of the operating system
+	/// for saving the wider registers.
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx512bw")) return ISA_AVX512BW;
+	if(__builtin_cpu_supports("avx2")) return ISA_AVX2;
+	if(__builtin_cpu_supports("sse2")) return ISA_SSE2;
+	return ISA_SCALAR;
+#elif defined(CPU_ISA_X86) && defined(_MSC_VER)
+	int regs[4];
+	__cpuid(regs, 0);
+	const int maxLeaf = regs[0];
+	__cpuid(regs, 1);
+	const bool sse2 = (regs[3] & (1 << 26)) != 0;
+	/// The operating system saves the AVX registers if it sets
+	/// bits 1 and 2 of XCR0, and the AVX-512 ones if it also sets bits 5 to 7.
+	const unsigned long long xcr0 = ((regs[2] & (1 << 27)) != 0) ? _xgetbv(0) : 0;
+	bool avx2 = false;
+	bool avx512bw = false;
+	if(maxLeaf >= 7)
+	{
+		__cpuidex(regs, 7, 0);
+		avx2 = ((regs[1] & (1 << 5)) != 0) && ((xcr0 & 0x6) == 0x6);
+		avx512bw = ((regs[1] & (1 << 16)) != 0) && ((regs[1] & (1 << 30)) != 0) &&
+				((xcr0 & 0xE6) == 0xE6);
+	}
+	if(avx512bw) return ISA_AVX512BW;
+	if(avx2) return ISA_AVX2;
+	if(sse2) return ISA_SSE2;
+	return ISA_SCALAR;
+#else
+	return ISA_SCALAR;
+#endif
+}
+
+bool CpuIsa_parse(const char *name, CpuIsa *isa)
+{
+	for(size_t i = 0; i < sizeof(isaNames) / sizeof(isaNames[0]); i++)
+	{
+		if(strcmp(name, isaNames[i]) == 0)
+		{
+			*isa = (CpuIsa)i;
+			return true;
+		}
+	}
+	return false;
+}
+
+const char* CpuIsa_name(const CpuIsa isa)
+{
+	return isaNames[isa];
+}
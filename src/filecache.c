@@ -0,0 +1,224 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "filecache.h"
+#include "utils.h"
+#include "frontcoded.h"
+#include <string.h>
+
+/// Identifies the format of the cached counts of a file.
+static const char cacheMagic[8] = {'W', 'C', 'C', 'A', 'C', 'H', 'E', '3'};
+
+/// The length of the name of a cache file: 16 hex digits, ".wcc" and '\0'.
+#define CACHE_FILE_NAME_LENGTH 21
+
+struct FileCache
+{
+	/// The path of the cache directory.
+	char *dirPath;
+	/// The buffer holding the path of the current cache file.
+	char *filePath;
+	/// The buffer holding the path the current cache file is written to,
+	/// before replacing the previous one.
+	char *tmpPath;
+	/// The signature of the token rules the files are counted with.
+	uint64_t rules;
+	/// The size of the file last looked up.
+	uint64_t lastSize;
+	/// The modification time of the file last looked up.
+	int64_t lastMtime;
+	/// The number of files whose counts were found in the cache.
+	size_t hits;
+	/// The number of files whose counts were not found in the cache.
+	size_t misses;
+};
+
+FileCache* FileCache_create(const char *dirPath, const uint64_t rules)
+{
+	if(!dir_create(dirPath))
+	{
+		fprintf(stderr, "Failed to create cache directory: %s\n", dirPath);
+		return NULL;
+	}
+
+	FileCache *cache = (FileCache*) calloc(1, sizeof(FileCache));
+	if(cache == NULL)
+	{
+		fprintf(stderr, "Initial allocation for the File Cache failed.\n");
+		return NULL;
+	}
+
+	const size_t dirLen = strlen(dirPath) + 1;
+	cache->dirPath = (char*) calloc(dirLen, sizeof(char));
+	cache->filePath = (char*) calloc(dirLen + CACHE_FILE_NAME_LENGTH, sizeof(char));
+	cache->tmpPath = (char*) calloc(dirLen + CACHE_FILE_NAME_LENGTH + 4, sizeof(char));
+	if((cache->dirPath == NULL) || (cache->filePath == NULL) || (cache->tmpPath == NULL))
+	{
+		fprintf(stderr, "Failed to allocate the paths of the File Cache.\n");
+		FileCache_destroy(&cache);
+		return NULL;
+	}
+	string_copy(cache->dirPath, dirPath, dirLen);
+	cache->rules = rules;
+
+	return cache;
+}
+
+/**
+ * @brief Sets the path of the cache file of an input file.
+ * @details The cache file is named after the hash of the input path.
+ *
+ * @param[in, out]	cache	Pointer to the cache.
+ * @param[in]		path	Pointer to the string containing the path of the file.
+ * @return	Void
+ */
+static void cache_file_path(FileCache *cache, const char *path)
+{
+	const size_t dirLen = strlen(cache->dirPath) + 1;
+	const uint64_t pathHash = fnvhash((const uint8_t*) path, (uint32_t)strlen(path));
+	snprintf(cache->filePath, dirLen + CACHE_FILE_NAME_LENGTH, "%s/%016llx.wcc",
+			cache->dirPath, (unsigned long long)pathHash);
+	snprintf(cache->tmpPath, dirLen + CACHE_FILE_NAME_LENGTH + 4, "%s.tmp",
+			cache->filePath);
+}
+
+RetStatus FileCache_lookup(FileCache *cache, const char *path, WordHashTable *whtab,
+		size_t *words, bool *found)
+{
+	*found = false;
+	if(!file_stats(path, &(cache->lastSize), &(cache->lastMtime)))
+	{
+		fprintf(stderr, "Failed to get the status of file: %s\n", path);
+		return GEN_FAIL;
+	}
+
+	cache_file_path(cache, path);
+	FILE *fp;
+	if(!file_open(&fp, cache->filePath, "rb"))
+	{
+		cache->misses++;
+		return SUCCESS;
+	}
+
+	/// The cached counts are only valid for the same path, size,
+	/// modification time and token rules, as different paths may share
+	/// a cache file.
+	char magic[sizeof(cacheMagic)];
+	uint64_t rules = 0;
+	uint64_t size = 0;
+	int64_t mtime = 0;
+	uint64_t cachedWords = 0;
+	uint32_t pathLen = 0;
+	const uint32_t expPathLen = (uint32_t)strlen(path);
+	bool valid = (fread(magic, sizeof(magic), 1, fp) == 1) &&
+		(memcmp(magic, cacheMagic, sizeof(cacheMagic)) == 0) &&
+		(fread(&rules, sizeof(rules), 1, fp) == 1) &&
+		(fread(&size, sizeof(size), 1, fp) == 1) &&
+		(fread(&mtime, sizeof(mtime), 1, fp) == 1) &&
+		(fread(&cachedWords, sizeof(cachedWords), 1, fp) == 1) &&
+		(fread(&pathLen, sizeof(pathLen), 1, fp) == 1) &&
+		(rules == cache->rules) &&
+		(size == cache->lastSize) && (mtime == cache->lastMtime) &&
+		(pathLen == expPathLen);
+	for(uint32_t i = 0; valid && (i < pathLen); i++)
+	{
+		valid = (fgetc(fp) == (unsigned char)path[i]);
+	}
+	if(!valid)
+	{
+		fclose(fp);
+		cache->misses++;
+		return SUCCESS;
+	}
+
+	const RetStatus rst = FrontCodedWords_load(whtab, fp);
+	fclose(fp);
+	if(rst != SUCCESS)
+	{
+		fprintf(stderr, "Failed to load cached counts of file: %s\n", path);
+		return GEN_FAIL;
+	}
+
+	*words = (size_t)cachedWords;
+	*found = true;
+	cache->hits++;
+
+	return SUCCESS;
+}
+
+RetStatus FileCache_store(FileCache *cache, const char *path,
+		const WordHashTable *whtab, const size_t words)
+{
+	cache_file_path(cache, path);
+	FILE *fp;
+	if(!file_open(&fp, cache->tmpPath, "wb"))
+	{
+		fprintf(stderr, "Failed to open cache file: %s\n", cache->tmpPath);
+		return GEN_FAIL;
+	}
+
+	const uint64_t cachedWords = words;
+	const uint32_t pathLen = (uint32_t)strlen(path);
+	if((fwrite(cacheMagic, sizeof(cacheMagic), 1, fp) != 1) ||
+		(fwrite(&(cache->rules), sizeof(cache->rules), 1, fp) != 1) ||
+		(fwrite(&(cache->lastSize), sizeof(cache->lastSize), 1, fp) != 1) ||
+		(fwrite(&(cache->lastMtime), sizeof(cache->lastMtime), 1, fp) != 1) ||
+		(fwrite(&cachedWords, sizeof(cachedWords), 1, fp) != 1) ||
+		(fwrite(&pathLen, sizeof(pathLen), 1, fp) != 1) ||
+		(fwrite(path, sizeof(char), pathLen, fp) != pathLen) ||
+		(FrontCodedWords_dump(whtab, fp) != SUCCESS))
+	{
+		fprintf(stderr, "Failed to write cache file: %s\n", cache->tmpPath);
+		fclose(fp);
+		remove(cache->tmpPath);
+		return GEN_FAIL;
+	}
+	if(fclose(fp) != 0)
+	{
+		remove(cache->tmpPath);
+		return GEN_FAIL;
+	}
+
+#ifdef _WIN32
+	/// rename does not replace existing files on Windows.
+	remove(cache->filePath);
+#endif //_WIN32
+	if(rename(cache->tmpPath, cache->filePath) != 0)
+	{
+		fprintf(stderr, "Failed to replace cache file: %s\n", cache->filePath);
+		return GEN_FAIL;
+	}
+
+	return SUCCESS;
+}
+
+void FileCache_stats_print(const FileCache *cache)
+{
+	printf("\nFile Cache statistics:\n");
+	printf("\tFiles found in cache: %ld\n", cache->hits);
+	printf("\tFiles counted: %ld\n", cache->misses);
+}
+
+void FileCache_destroy(FileCache **cache)
+{
+	free((*cache)->dirPath);
+	free((*cache)->filePath);
+	free((*cache)->tmpPath);
+	free(*cache);
+	*cache = NULL;
+}
@@ -0,0 +1,439 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "frontcoded.h"
+#include <string.h>
+
+/// The number of words of each block.
+#define FRONT_BLOCK_WORDS 16
+
+/// Identifies the file format of the front-coded words.
+static const char frontMagic[8] = {'W', 'C', 'F', 'R', 'O', 'N', 'T', '1'};
+
+struct FrontCodedWords
+{
+	/// The encoded words. Each one is written as the length of the prefix it
+	/// shares with the previous word, 0 for the first of a block, the length
+	/// and the characters of the rest of the word, and its count,
+	/// all lengths and counts as variable length integers.
+	uint8_t *data;
+	/// The number of bytes of the encoded words.
+	size_t dataLength;
+	/// The position of each block in the encoded words.
+	uint64_t *blocks;
+	/// The number of blocks.
+	size_t numBlocks;
+	/// The number of words.
+	size_t numWords;
+	/// The length of the longest word.
+	uint32_t maxLength;
+	/// The buffer the words are decoded to.
+	char *scratch;
+};
+
+/// @brief The header of a file of front-coded words, followed by the
+/// positions of the blocks and the encoded words.
+typedef struct
+{
+	/// The magic number of the format.
+	char magic[8];
+	/// The number of words.
+	uint64_t numWords;
+	/// The number of bytes of the encoded words.
+	uint64_t dataLength;
+	/// The length of the longest word.
+	uint32_t maxLength;
+	/// The number of words of each block.
+	uint32_t blockWords;
+}FrontCodedHeader;
+
+/// @brief A position in the encoded words, along with the word decoded there.
+typedef struct
+{
+	/// The position of the next word to be decoded.
+	size_t pos;
+	/// The length of the word last decoded.
+	uint32_t length;
+	/// The count of the word last decoded.
+	size_t count;
+}FrontCursor;
+
+/**
+ * @brief Gets the number of bytes of an integer as a variable length integer.
+ *
+ * @param[in]	val	The integer.
+ * @return	The number of bytes.
+ */
+static inline size_t varint_length(uint64_t val)
+{
+	size_t len = 1;
+	while(val >= 0x80)
+	{
+		val >>= 7;
+		len++;
+	}
+	return len;
+}
+
+/**
+ * @brief Writes an integer as a variable length integer, 7 bits per byte
+ * starting from the lowest ones, the top bit set on all bytes but the last.
+ *
+ * @param[out]	out	Pointer to the bytes to be written.
+ * @param[in]	val	The integer.
+ * @return	Pointer to the byte following the integer.
+ */
+static inline uint8_t* varint_put(uint8_t *out, uint64_t val)
+{
+	while(val >= 0x80)
+	{
+		*(out++) = (uint8_t)(val | 0x80);
+		val >>= 7;
+	}
+	*(out++) = (uint8_t)val;
+	return out;
+}
+
+/**
+ * @brief Reads a variable length integer.
+ *
+ * @param[in]		data	Pointer to the bytes.
+ * @param[in]		end		The number of bytes.
+ * @param[in, out]	pos		Pointer to the position of the integer,
+ * 							moved past it.
+ * @param[out]		val		Pointer to the integer.
+ * @return	Returns true if the integer ends before the bytes.
+ */
+static inline bool varint_get(const uint8_t *data, const size_t end, size_t *pos,
+		uint64_t *val)
+{
+	uint64_t result = 0;
+	for(uint32_t shift = 0; (*pos < end) && (shift < 64); shift += 7)
+	{
+		const uint8_t byte = data[(*pos)++];
+		result |= (uint64_t)(byte & 0x7F) << shift;
+		if((byte & 0x80) == 0)
+		{
+			*val = result;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Decodes the next word to the buffer of the words.
+ *
+ * @param[in]		fcw	Pointer to the words.
+ * @param[in, out]	cur	Pointer to the cursor, holding the previous word.
+ * @return	Returns true if a valid word is decoded.
+ */
+static bool cursor_next(const FrontCodedWords *fcw, FrontCursor *cur)
+{
+	uint64_t shared = 0;
+	uint64_t suffix = 0;
+	uint64_t count = 0;
+	if(!varint_get(fcw->data, fcw->dataLength, &(cur->pos), &shared) ||
+		!varint_get(fcw->data, fcw->dataLength, &(cur->pos), &suffix) ||
+		(shared > cur->length) || (suffix > fcw->maxLength - shared) ||
+		(suffix > fcw->dataLength - cur->pos))
+		return false;
+	memcpy(fcw->scratch + shared, fcw->data + cur->pos, (size_t)suffix);
+	cur->pos += (size_t)suffix;
+	cur->length = (uint32_t)(shared + suffix);
+	if(!varint_get(fcw->data, fcw->dataLength, &(cur->pos), &count)) return false;
+	cur->count = (size_t)count;
+
+	return true;
+}
+
+/**
+ * @brief Orders two words alphabetically, like strcmp orders them.
+ *
+ * @param[in]	a		Pointer to the characters of the first word.
+ * @param[in]	aLen	The length of the first word.
+ * @param[in]	b		Pointer to the characters of the second word.
+ * @param[in]	bLen	The length of the second word.
+ * @return	Negative, zero or positive if the first word precedes, equals
+ * or follows the second.
+ */
+static inline int word_compare(const char *a, const uint32_t aLen, const char *b,
+		const uint32_t bLen)
+{
+	const int cmp = memcmp(a, b, (aLen < bLen) ? aLen : bLen);
+	if(cmp != 0) return cmp;
+	return (aLen > bLen) - (aLen < bLen);
+}
+
+/**
+ * @brief Allocates a set of words without any blocks.
+ *
+ * @param[in]	numWords	The number of words.
+ * @param[in]	dataLength	The number of bytes of the encoded words.
+ * @param[in]	maxLength	The length of the longest word.
+ * @return	Return a pointer to the allocated words.
+ */
+static FrontCodedWords* front_alloc(const size_t numWords, const size_t dataLength,
+		const uint32_t maxLength)
+{
+	FrontCodedWords *fcw = (FrontCodedWords*) calloc(1, sizeof(FrontCodedWords));
+	if(fcw == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the front-coded words.\n");
+		return NULL;
+	}
+	fcw->numWords = numWords;
+	fcw->numBlocks = (numWords + FRONT_BLOCK_WORDS - 1) / FRONT_BLOCK_WORDS;
+	fcw->dataLength = dataLength;
+	fcw->maxLength = maxLength;
+	fcw->data = (uint8_t*) malloc(dataLength + 1);
+	fcw->blocks = (uint64_t*) malloc((fcw->numBlocks + 1) * sizeof(uint64_t));
+	fcw->scratch = (char*) malloc((size_t)maxLength + 1);
+	if((fcw->data == NULL) || (fcw->blocks == NULL) || (fcw->scratch == NULL))
+	{
+		fprintf(stderr, "Failed to allocate the front-coded words.\n");
+		FrontCodedWords_destroy(&fcw);
+		return NULL;
+	}
+
+	return fcw;
+}
+
+FrontCodedWords* FrontCodedWords_create(const WordHashTable *whtab)
+{
+	/// The size of the encoded words is found by a first pass over the table,
+	/// so that they are written in place by a second one.
+	const size_t size = WordHashTable_get_size(whtab);
+	size_t numWords = 0;
+	size_t dataLength = 0;
+	uint32_t maxLength = 0;
+	const char *prev = NULL;
+	uint32_t prevLength = 0;
+	for(size_t i = 0; i < size; i++)
+	{
+		uint32_t length = 0;
+		size_t count = 0;
+		const char *word = WordHashTable_order_word(whtab, i, &length, &count);
+		if(word == NULL) continue;
+		uint32_t shared = 0;
+		if(numWords % FRONT_BLOCK_WORDS != 0)
+		{
+			const uint32_t common = (length < prevLength) ? length : prevLength;
+			while((shared < common) && (word[shared] == prev[shared])) shared++;
+		}
+		dataLength += varint_length(shared) + varint_length(length - shared) +
+				(length - shared) + varint_length(count);
+		if(length > maxLength) maxLength = length;
+		prev = word;
+		prevLength = length;
+		numWords++;
+	}
+
+	FrontCodedWords *fcw = front_alloc(numWords, dataLength, maxLength);
+	if(fcw == NULL) return NULL;
+
+	uint8_t *out = fcw->data;
+	size_t index = 0;
+	for(size_t i = 0; i < size; i++)
+	{
+		uint32_t length = 0;
+		size_t count = 0;
+		const char *word = WordHashTable_order_word(whtab, i, &length, &count);
+		if(word == NULL) continue;
+		uint32_t shared = 0;
+		if(index % FRONT_BLOCK_WORDS == 0) fcw->blocks[index / FRONT_BLOCK_WORDS] =
+				(uint64_t)(out - fcw->data);
+		else
+		{
+			const uint32_t common = (length < prevLength) ? length : prevLength;
+			while((shared < common) && (word[shared] == prev[shared])) shared++;
+		}
+		out = varint_put(out, shared);
+		out = varint_put(out, length - shared);
+		memcpy(out, word + shared, length - shared);
+		out += length - shared;
+		out = varint_put(out, count);
+		prev = word;
+		prevLength = length;
+		index++;
+	}
+
+	return fcw;
+}
+
+FrontCodedWords* FrontCodedWords_read(FILE *fp)
+{
+	FrontCodedHeader header;
+	if((fread(&header, sizeof(header), 1, fp) != 1) ||
+		(memcmp(header.magic, frontMagic, sizeof(frontMagic)) != 0) ||
+		(header.blockWords != FRONT_BLOCK_WORDS) || (header.numWords > SIZE_MAX / 2) ||
+		(header.dataLength > SIZE_MAX / 2) || (header.maxLength == UINT32_MAX))
+	{
+		fprintf(stderr, "Invalid front-coded words.\n");
+		return NULL;
+	}
+
+	FrontCodedWords *fcw = front_alloc((size_t)header.numWords, (size_t)header.dataLength,
+			header.maxLength);
+	if(fcw == NULL) return NULL;
+	bool valid = (fread(fcw->blocks, sizeof(uint64_t), fcw->numBlocks, fp) == fcw->numBlocks) &&
+			(fread(fcw->data, sizeof(uint8_t), fcw->dataLength, fp) == fcw->dataLength);
+	/// The blocks are checked to lie in order within the encoded words,
+	/// while the words themselves are checked as they are decoded.
+	for(size_t b = 0; valid && (b < fcw->numBlocks); b++)
+	{
+		valid = (fcw->blocks[b] < fcw->dataLength) &&
+				((b == 0) ? (fcw->blocks[b] == 0) : (fcw->blocks[b] > fcw->blocks[b - 1]));
+	}
+	if(!valid)
+	{
+		fprintf(stderr, "Invalid or truncated front-coded words.\n");
+		FrontCodedWords_destroy(&fcw);
+		return NULL;
+	}
+
+	return fcw;
+}
+
+RetStatus FrontCodedWords_write(const FrontCodedWords *fcw, FILE *fp)
+{
+	FrontCodedHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, frontMagic, sizeof(frontMagic));
+	header.numWords = fcw->numWords;
+	header.dataLength = fcw->dataLength;
+	header.maxLength = fcw->maxLength;
+	header.blockWords = FRONT_BLOCK_WORDS;
+	if((fwrite(&header, sizeof(header), 1, fp) != 1) ||
+		(fwrite(fcw->blocks, sizeof(uint64_t), fcw->numBlocks, fp) != fcw->numBlocks) ||
+		(fwrite(fcw->data, sizeof(uint8_t), fcw->dataLength, fp) != fcw->dataLength))
+	{
+		fprintf(stderr, "Failed to write the front-coded words.\n");
+		return GEN_FAIL;
+	}
+
+	return SUCCESS;
+}
+
+RetStatus FrontCodedWords_merge(const FrontCodedWords *fcw, WordHashTable *whtab)
+{
+	/// The counts of an empty input hold no words to be read.
+	if(fcw->numWords == 0) return SUCCESS;
+
+	WordBuffer *wbuf = WordBuffer_create(fcw->maxLength + 1);
+	if(wbuf == NULL) return GEN_FAIL;
+
+	FrontCursor cur = {0};
+	RetStatus rst = SUCCESS;
+	for(size_t i = 0; (rst == SUCCESS) && (i < fcw->numWords); i++)
+	{
+		/// The first word of each block shares no prefix with the previous one.
+		if(i % FRONT_BLOCK_WORDS == 0) cur.length = 0;
+		if(!cursor_next(fcw, &cur))
+		{
+			fprintf(stderr, "Corrupted front-coded word %ld.\n", i);
+			rst = GEN_FAIL;
+			break;
+		}
+		rst = WordBuffer_set(wbuf, fcw->scratch, cur.length);
+		if(rst == SUCCESS) rst = WordHashTable_count_word(whtab, wbuf, cur.count);
+		if(rst != SUCCESS)
+		{
+			fprintf(stderr, "Failed to insert word '%s' of the front-coded words.\n",
+					WordBuffer_get_word(wbuf));
+		}
+	}
+	WordBuffer_destroy(&wbuf);
+
+	return rst;
+}
+
+RetStatus FrontCodedWords_dump(const WordHashTable *whtab, FILE *fp)
+{
+	FrontCodedWords *fcw = FrontCodedWords_create(whtab);
+	if(fcw == NULL) return GEN_FAIL;
+	const RetStatus rst = FrontCodedWords_write(fcw, fp);
+	FrontCodedWords_destroy(&fcw);
+
+	return rst;
+}
+
+RetStatus FrontCodedWords_load(WordHashTable *whtab, FILE *fp)
+{
+	FrontCodedWords *fcw = FrontCodedWords_read(fp);
+	if(fcw == NULL) return GEN_FAIL;
+	const RetStatus rst = FrontCodedWords_merge(fcw, whtab);
+	FrontCodedWords_destroy(&fcw);
+
+	return rst;
+}
+
+bool FrontCodedWords_find(const FrontCodedWords *fcw, const char *word,
+		const uint32_t length, size_t *count)
+{
+	if(fcw->numBlocks == 0) return false;
+
+	/// Finds the last block whose first word does not follow the word.
+	size_t low = 0;
+	size_t high = fcw->numBlocks;
+	while(high - low > 1)
+	{
+		const size_t mid = low + (high - low) / 2;
+		FrontCursor cur = {(size_t)fcw->blocks[mid], 0, 0};
+		if(!cursor_next(fcw, &cur)) return false;
+		if(word_compare(fcw->scratch, cur.length, word, length) <= 0) low = mid;
+		else high = mid;
+	}
+
+	/// The words of the block are decoded until one no longer precedes the word.
+	FrontCursor cur = {(size_t)fcw->blocks[low], 0, 0};
+	const size_t blockEnd = (low + 1) * FRONT_BLOCK_WORDS;
+	for(size_t i = low * FRONT_BLOCK_WORDS; (i < blockEnd) && (i < fcw->numWords); i++)
+	{
+		if(!cursor_next(fcw, &cur)) return false;
+		const int cmp = word_compare(fcw->scratch, cur.length, word, length);
+		if(cmp > 0) return false;
+		if(cmp == 0)
+		{
+			*count = cur.count;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+size_t FrontCodedWords_num_words(const FrontCodedWords *fcw)
+{
+	return fcw->numWords;
+}
+
+size_t FrontCodedWords_bytes(const FrontCodedWords *fcw)
+{
+	return fcw->dataLength + fcw->numBlocks * sizeof(uint64_t);
+}
+
+void FrontCodedWords_destroy(FrontCodedWords **fcw)
+{
+	free((*fcw)->data);
+	free((*fcw)->blocks);
+	free((*fcw)->scratch);
+	free(*fcw);
+	*fcw = NULL;
+}
@@ -0,0 +1,228 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "hotwords.h"
+#include <string.h>
+
+/// The number of slots of the cache as a power of 2, enough for the
+/// vocabulary of most texts while the cache fits in the L2 data cache.
+#define HOT_WORDS_BITS 14
+#define HOT_WORDS_SLOTS (1 << HOT_WORDS_BITS)
+/// The maximum length of a word held by the cache, packed in two 64-bit words.
+#define HOT_WORD_LENGTH 16
+/// The maximum score of a word, bounding the misses it takes to replace it.
+#define HOT_WORD_MAX_SCORE 4
+/// The initial capacity of the buffer of the words added to the table.
+#define INITIAL_HOT_WORD_LENGTH 32
+
+/// @brief A slot of the cache, holding a word and the occurrences
+/// not yet added to the table.
+typedef struct
+{
+	/// The characters of the word, padded with zeros.
+	uint64_t packed[2];
+	/// The number of occurrences not yet added to the table.
+	size_t delta;
+	/// The length of the word, 0 if the slot is empty.
+	uint32_t length;
+	/// The hits of the word less the misses of other words in its slot,
+	/// the word giving up its slot once it reaches 0.
+	uint32_t score;
+}HotSlot;
+
+struct HotWords
+{
+	/// The slots of the cache, each word taking the slot of its hash.
+	HotSlot *slots;
+	/// The buffer the words of the cache are added to the table from.
+	WordBuffer *evicted;
+	/// The number of words counted in the cache.
+	size_t hits;
+	/// The number of words missing from the cache.
+	size_t misses;
+	/// The number of words too long for the cache.
+	size_t bypassed;
+	/// The number of times the cache was flushed.
+	size_t flushes;
+};
+
+HotWords* HotWords_create(void)
+{
+	HotWords *hot = (HotWords*) calloc(1, sizeof(HotWords));
+	if(hot == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the cache of hot words.\n");
+		return NULL;
+	}
+
+	hot->slots = (HotSlot*) calloc(HOT_WORDS_SLOTS, sizeof(HotSlot));
+	hot->evicted = WordBuffer_create(INITIAL_HOT_WORD_LENGTH);
+	if((hot->slots == NULL) || (hot->evicted == NULL))
+	{
+		fprintf(stderr, "Failed to allocate the cache of hot words.\n");
+		HotWords_destroy(&hot);
+		return NULL;
+	}
+
+	return hot;
+}
+
+/**
+ * @brief Adds the occurrences gathered by the word of a slot to the table,
+ * the word staying in the slot.
+ *
+ * @param[in, out]	hot		Pointer to the cache.
+ * @param[in, out]	whtab	Pointer to the Hash table.
+ * @param[in, out]	slot	Pointer to the slot.
+ * @return	Return the status of the routine.
+ */
+static RetStatus slot_flush(HotWords *hot, WordHashTable *whtab, HotSlot *slot)
+{
+	if(slot->delta == 0) return SUCCESS;
+	if((WordBuffer_set(hot->evicted, (const char*) slot->packed, slot->length) != SUCCESS) ||
+		(WordHashTable_count_word(whtab, hot->evicted, slot->delta) != SUCCESS))
+	{
+		fprintf(stderr, "Failed to add the occurrences of a hot word to the table.\n");
+		return GEN_FAIL;
+	}
+	slot->delta = 0;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Packs a word in two 64-bit words and finds the slot of its hash.
+ * @details The padding is part of the comparison, so two words of different
+ * length never match even if one of them contains zeros.
+ *
+ * @param[in]	hot		Pointer to the cache.
+ * @param[in]	letters	Pointer to the characters of the word.
+ * @param[in]	len		The length of the word, at most HOT_WORD_LENGTH.
+ * @param[out]	packed	The packed characters of the word.
+ * @return	Pointer to the slot of the word.
+ */
+static inline HotSlot* slot_find(const HotWords *hot, const char *letters, const uint32_t len,
+		uint64_t packed[2])
+{
+	packed[0] = 0;
+	packed[1] = 0;
+	memcpy(packed, letters, len);
+	const uint64_t hash = (packed[0] ^ (packed[1] * 0x9E3779B97F4A7C15ULL))
+			* 0xBF58476D1CE4E5B9ULL;
+	return &(hot->slots[hash >> (64 - HOT_WORDS_BITS)]);
+}
+
+/**
+ * @brief Evaluates whether a slot holds the specified packed word.
+ *
+ * @param[in]	slot	Pointer to the slot.
+ * @param[in]	packed	The packed characters of the word.
+ * @param[in]	len		The length of the word.
+ * @return	Returns true if the slot holds the word.
+ */
+static inline bool slot_matches(const HotSlot *slot, const uint64_t packed[2],
+		const uint32_t len)
+{
+	return (slot->packed[0] == packed[0]) && (slot->packed[1] == packed[1]) &&
+			(slot->length == len);
+}
+
+bool HotWords_hit(HotWords *hot, const WordBuffer *wbuf)
+{
+	const uint32_t len = WordBuffer_get_length(wbuf);
+	if(len > HOT_WORD_LENGTH) return false;
+
+	uint64_t packed[2];
+	HotSlot *slot = slot_find(hot, WordBuffer_get_word(wbuf), len, packed);
+	if(!slot_matches(slot, packed, len)) return false;
+	hot->hits++;
+	slot->delta++;
+	if(slot->score < HOT_WORD_MAX_SCORE) slot->score++;
+
+	return true;
+}
+
+RetStatus HotWords_count_word(HotWords *hot, WordHashTable *whtab, const WordBuffer *wbuf,
+		const size_t count)
+{
+	const uint32_t len = WordBuffer_get_length(wbuf);
+	/// Longer words are rarely frequent enough to be worth caching.
+	if(len > HOT_WORD_LENGTH)
+	{
+		hot->bypassed++;
+		return WordHashTable_count_word(whtab, wbuf, count);
+	}
+
+	uint64_t packed[2];
+	HotSlot *slot = slot_find(hot, WordBuffer_get_word(wbuf), len, packed);
+	if(slot_matches(slot, packed, len))
+	{
+		hot->hits++;
+		slot->delta += count;
+		if(slot->score < HOT_WORD_MAX_SCORE) slot->score++;
+		return SUCCESS;
+	}
+
+	/// A frequent word keeps its slot while a few rarer words pass through,
+	/// which are counted in the table directly.
+	hot->misses++;
+	if(slot->score != 0)
+	{
+		slot->score--;
+		return WordHashTable_count_word(whtab, wbuf, count);
+	}
+	if((slot->length != 0) && (slot_flush(hot, whtab, slot) != SUCCESS)) return GEN_FAIL;
+	slot->packed[0] = packed[0];
+	slot->packed[1] = packed[1];
+	slot->delta = count;
+	slot->length = len;
+
+	return SUCCESS;
+}
+
+RetStatus HotWords_flush(HotWords *hot, WordHashTable *whtab)
+{
+	for(size_t i = 0; i < HOT_WORDS_SLOTS; i++)
+	{
+		HotSlot *slot = &(hot->slots[i]);
+		if((slot->length != 0) && (slot_flush(hot, whtab, slot) != SUCCESS)) return GEN_FAIL;
+	}
+	hot->flushes++;
+
+	return SUCCESS;
+}
+
+void HotWords_stats_print(const HotWords *hot)
+{
+	const size_t lookups = hot->hits + hot->misses + hot->bypassed;
+	printf("\nHot words statistics:\n");
+	printf("\tWords counted: %ld\n", lookups);
+	printf("\tWords found in cache: %ld (%.2f%%)\n", hot->hits,
+			(lookups != 0) ? 100.0 * (double)hot->hits / (double)lookups : 0.0);
+	printf("\tWords too long for the cache: %ld\n", hot->bypassed);
+	printf("\tFlushes: %ld\n", hot->flushes);
+}
+
+void HotWords_destroy(HotWords **hot)
+{
+	free((*hot)->slots);
+	if((*hot)->evicted != NULL) WordBuffer_destroy(&((*hot)->evicted));
+	free(*hot);
+	*hot = NULL;
+}
@@ -0,0 +1,920 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "inputstream.h"
+#include "utils.h"
+#include <string.h>
+#ifdef _MSC_VER
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#endif //_MSC_VER
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif //HAVE_ZLIB
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif //HAVE_ZSTD
+#ifdef HAVE_LZMA
+#include <lzma.h>
+#endif //HAVE_LZMA
+
+/// The length of the buffer of the bytes of plain files,
+/// which is also the maximum length of a line.
+#define PLAIN_BUFFER_LENGTH (1 << 16)
+/// The length of the buffer of the bytes read from compressed files.
+#define COMPRESSED_BUFFER_LENGTH (1 << 16)
+/// The length of each block of decompressed bytes.
+#define DECOMPRESSED_BLOCK_LENGTH (1 << 18)
+/// The number of blocks of decompressed bytes, so that the next blocks
+/// are decompressed while one is being tokenized.
+#define DECOMPRESSED_BLOCKS 4
+/// The maximum length of the magic numbers of the compression formats.
+#define MAGIC_MAX_LENGTH 6
+
+#ifdef _MSC_VER
+typedef HANDLE Thread;
+typedef SRWLOCK Mutex;
+typedef CONDITION_VARIABLE Condition;
+#else
+typedef pthread_t Thread;
+typedef pthread_mutex_t Mutex;
+typedef pthread_cond_t Condition;
+#endif //_MSC_VER
+
+/// @brief The compression formats of the input.
+typedef enum
+{
+	COMPRESSION_NONE = 0,
+	COMPRESSION_GZIP,
+	COMPRESSION_ZSTD,
+	COMPRESSION_XZ
+}Compression;
+
+/// @brief The magic number starting the files of a compression format.
+typedef struct
+{
+	/// The compression format.
+	Compression compression;
+	/// The name of the format.
+	const char *name;
+	/// The number of bytes of the magic number.
+	size_t length;
+	/// The bytes of the magic number.
+	uint8_t bytes[MAGIC_MAX_LENGTH];
+}Magic;
+
+/// The magic numbers of the supported compression formats.
+static const Magic magics[] =
+{
+	{COMPRESSION_GZIP, "gzip", 2, {0x1F, 0x8B}},
+	{COMPRESSION_ZSTD, "zstd", 4, {0x28, 0xB5, 0x2F, 0xFD}},
+	{COMPRESSION_XZ, "xz", 6, {0xFD, '7', 'z', 'X', 'Z', 0x00}}
+};
+
+/// The number of the supported compression formats.
+#define NUM_MAGICS (sizeof(magics) / sizeof(magics[0]))
+
+struct InputStream
+{
+	/// Pointer to the input file.
+	FILE *fp;
+	/// The compression format of the file.
+	Compression compression;
+	/// The bytes read to detect the compression.
+	uint8_t magic[MAGIC_MAX_LENGTH];
+	/// The number of bytes read to detect the compression,
+	/// which plain files return before the rest.
+	size_t magicLen;
+	/// The buffer of the bytes of plain files,
+	/// and of the lines of compressed files split between blocks.
+	char *buffer;
+	/// The bytes being returned.
+	const char *block;
+	/// The number of bytes being returned.
+	size_t blockLen;
+	/// The position of the next byte to be returned.
+	size_t blockPos;
+	/// The offset of the next byte to be returned.
+	uint64_t offset;
+
+	/// The buffer of the bytes read from compressed files.
+	uint8_t *compressed;
+	/// The blocks of decompressed bytes, used as a ring.
+	char *blocks[DECOMPRESSED_BLOCKS];
+	/// The number of bytes of each block.
+	size_t lengths[DECOMPRESSED_BLOCKS];
+	/// The first decompressed block not yet released by the reader.
+	uint32_t head;
+	/// The number of decompressed blocks not yet released by the reader.
+	uint32_t filled;
+	/// Whether the reader is returning the bytes of the first block.
+	bool held;
+	/// Whether the decompression thread has ended.
+	bool finished;
+	/// Whether the decompression failed.
+	bool failed;
+	/// Whether the decompression thread is asked to stop.
+	bool stopped;
+	/// Whether the decompression thread is asked to wait before the next block.
+	bool paused;
+	/// Whether the decompression thread is waiting for a block to be released
+	/// or for the stream to be resumed.
+	bool parked;
+	/// The lock of the ring of blocks.
+	Mutex mutex;
+	/// Signaled when a block is decompressed or the decompression ends.
+	Condition filledCond;
+	/// Signaled when a block is released or the thread is asked to stop.
+	Condition freedCond;
+	/// The decompression thread.
+	Thread thread;
+	/// Whether the decompression thread was started.
+	bool threadStarted;
+};
+
+/// The threading primitives of Windows and POSIX behind a common interface.
+static void mutex_init(Mutex *mutex)
+{
+#ifdef _MSC_VER
+	InitializeSRWLock(mutex);
+#else
+	pthread_mutex_init(mutex, NULL);
+#endif //_MSC_VER
+}
+
+static void mutex_lock(Mutex *mutex)
+{
+#ifdef _MSC_VER
+	AcquireSRWLockExclusive(mutex);
+#else
+	pthread_mutex_lock(mutex);
+#endif //_MSC_VER
+}
+
+static void mutex_unlock(Mutex *mutex)
+{
+#ifdef _MSC_VER
+	ReleaseSRWLockExclusive(mutex);
+#else
+	pthread_mutex_unlock(mutex);
+#endif //_MSC_VER
+}
+
+static void mutex_destroy(Mutex *mutex)
+{
+#ifndef _MSC_VER
+	pthread_mutex_destroy(mutex);
+#else
+	(void)mutex;
+#endif //_MSC_VER
+}
+
+static void condition_init(Condition *cond)
+{
+#ifdef _MSC_VER
+	InitializeConditionVariable(cond);
+#else
+	pthread_cond_init(cond, NULL);
+#endif //_MSC_VER
+}
+
+static void condition_wait(Condition *cond, Mutex *mutex)
+{
+#ifdef _MSC_VER
+	SleepConditionVariableSRW(cond, mutex, INFINITE, 0);
+#else
+	pthread_cond_wait(cond, mutex);
+#endif //_MSC_VER
+}
+
+static void condition_broadcast(Condition *cond)
+{
+#ifdef _MSC_VER
+	WakeAllConditionVariable(cond);
+#else
+	pthread_cond_broadcast(cond);
+#endif //_MSC_VER
+}
+
+static void condition_destroy(Condition *cond)
+{
+#ifndef _MSC_VER
+	pthread_cond_destroy(cond);
+#else
+	(void)cond;
+#endif //_MSC_VER
+}
+
+/**
+ * @brief Reads the first bytes of the file to detect its compression.
+ * @details Bytes are read one at a time and only while they can
+ * still start a magic number.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @return	The index of the magic number of the file, NUM_MAGICS if it is plain.
+ */
+static size_t magic_detect(InputStream *stream)
+{
+	bool candidate[NUM_MAGICS];
+	for(size_t i = 0; i < NUM_MAGICS; i++) candidate[i] = true;
+
+	bool any = true;
+	while(any && (stream->magicLen < MAGIC_MAX_LENGTH))
+	{
+		const int ch = fgetc(stream->fp);
+		if(ch == EOF) break;
+		const size_t pos = stream->magicLen++;
+		stream->magic[pos] = (uint8_t)ch;
+
+		any = false;
+		for(size_t i = 0; i < NUM_MAGICS; i++)
+		{
+			candidate[i] = candidate[i] && (magics[i].bytes[pos] == (uint8_t)ch);
+			if(candidate[i] && (pos + 1 == magics[i].length)) return i;
+			any = any || candidate[i];
+		}
+	}
+
+	return NUM_MAGICS;
+}
+
+/**
+ * @brief Checks whether the program was built with the library
+ * of a compression format.
+ *
+ * @param[in]	compression	The compression format.
+ * @return	Returns true if the format can be decompressed.
+ */
+static bool compression_supported(const Compression compression)
+{
+	switch(compression)
+	{
+#ifdef HAVE_ZLIB
+	case COMPRESSION_GZIP: return true;
+#endif //HAVE_ZLIB
+#ifdef HAVE_ZSTD
+	case COMPRESSION_ZSTD: return true;
+#endif //HAVE_ZSTD
+#ifdef HAVE_LZMA
+	case COMPRESSION_XZ: return true;
+#endif //HAVE_LZMA
+	case COMPRESSION_NONE: return true;
+	default: return false;
+	}
+}
+
+/**
+ * @brief Reads the next bytes of a compressed file, starting with
+ * the magic number read to detect the compression.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @param[out]		length	Pointer to the number of bytes read, 0 at the end of the file.
+ * @return	Return the status of the routine.
+ */
+static RetStatus compressed_read(InputStream *stream, size_t *length)
+{
+	size_t len = stream->magicLen;
+	memcpy(stream->compressed, stream->magic, len);
+	stream->magicLen = 0;
+	len += fread(stream->compressed + len, sizeof(uint8_t), COMPRESSED_BUFFER_LENGTH - len,
+			stream->fp);
+	if(ferror(stream->fp))
+	{
+		fprintf(stderr, "Error while reading the input stream.\n");
+		return GEN_FAIL;
+	}
+	*length = len;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Waits for a block of the ring to be released by the reader.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @return	Return a pointer to the block to be decompressed to,
+ * NULL if the thread is asked to stop.
+ */
+static char* block_acquire(InputStream *stream)
+{
+	mutex_lock(&(stream->mutex));
+	while(((stream->filled == DECOMPRESSED_BLOCKS) || stream->paused) && !stream->stopped)
+	{
+		stream->parked = true;
+		/// The reader pausing the stream waits for the thread to be parked.
+		if(stream->paused) condition_broadcast(&(stream->filledCond));
+		condition_wait(&(stream->freedCond), &(stream->mutex));
+	}
+	stream->parked = false;
+	char *block = stream->stopped ? NULL
+			: stream->blocks[(stream->head + stream->filled) % DECOMPRESSED_BLOCKS];
+	mutex_unlock(&(stream->mutex));
+
+	return block;
+}
+
+/**
+ * @brief Passes the block last acquired to the reader.
+ * @details The reader only releases blocks from the head of the ring,
+ * so the block is still the one after the filled ones.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @param[in]		length	The number of decompressed bytes of the block.
+ * @return	Void
+ */
+static void block_publish(InputStream *stream, const size_t length)
+{
+	mutex_lock(&(stream->mutex));
+	stream->lengths[(stream->head + stream->filled) % DECOMPRESSED_BLOCKS] = length;
+	stream->filled++;
+	condition_broadcast(&(stream->filledCond));
+	mutex_unlock(&(stream->mutex));
+}
+
+#ifdef HAVE_ZLIB
+/**
+ * @brief Decompresses a gzip file, which may hold several members.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @return	Return the status of the routine.
+ */
+static RetStatus gzip_decompress(InputStream *stream)
+{
+	z_stream zs;
+	memset(&zs, 0, sizeof(zs));
+	/// Adding 32 to the window bits detects the gzip header.
+	if(inflateInit2(&zs, 15 + 32) != Z_OK)
+	{
+		fprintf(stderr, "Failed to initialize the gzip decompression.\n");
+		return GEN_FAIL;
+	}
+
+	RetStatus rst = SUCCESS;
+	char *block = NULL;
+	bool inputEnd = false;
+	bool outputFull = false;
+	bool memberEnd = false;
+	while(rst == SUCCESS)
+	{
+		if((zs.avail_in == 0) && !inputEnd)
+		{
+			size_t len = 0;
+			rst = compressed_read(stream, &len);
+			zs.next_in = stream->compressed;
+			zs.avail_in = (uInt)len;
+			inputEnd = (len == 0);
+			continue;
+		}
+		if((zs.avail_in == 0) && !outputFull)
+		{
+			if(!memberEnd)
+			{
+				fprintf(stderr, "The gzip input is truncated.\n");
+				rst = GEN_FAIL;
+			}
+			break;
+		}
+		/// Concatenated members are decompressed one after the other.
+		if(memberEnd && (zs.avail_in != 0))
+		{
+			inflateReset(&zs);
+			memberEnd = false;
+		}
+
+		if(block == NULL)
+		{
+			block = block_acquire(stream);
+			if(block == NULL) break;
+			zs.next_out = (Bytef*)block;
+			zs.avail_out = DECOMPRESSED_BLOCK_LENGTH;
+		}
+		const int ret = inflate(&zs, Z_NO_FLUSH);
+		if(ret == Z_STREAM_END) memberEnd = true;
+		else if((ret != Z_OK) && (ret != Z_BUF_ERROR))
+		{
+			fprintf(stderr, "Invalid gzip input: %s\n",
+					(zs.msg != NULL) ? zs.msg : "corrupted data");
+			rst = GEN_FAIL;
+		}
+
+		outputFull = (zs.avail_out == 0);
+		if(outputFull)
+		{
+			block_publish(stream, DECOMPRESSED_BLOCK_LENGTH);
+			block = NULL;
+		}
+	}
+	if((rst == SUCCESS) && (block != NULL) && (zs.avail_out != DECOMPRESSED_BLOCK_LENGTH))
+		block_publish(stream, DECOMPRESSED_BLOCK_LENGTH - zs.avail_out);
+	inflateEnd(&zs);
+
+	return rst;
+}
+#endif //HAVE_ZLIB
+
+#ifdef HAVE_ZSTD
+/**
+ * @brief Decompresses a zstd file, which may hold several frames.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @return	Return the status of the routine.
+ */
+static RetStatus zstd_decompress(InputStream *stream)
+{
+	ZSTD_DStream *ds = ZSTD_createDStream();
+	if((ds == NULL) || ZSTD_isError(ZSTD_initDStream(ds)))
+	{
+		fprintf(stderr, "Failed to initialize the zstd decompression.\n");
+		if(ds != NULL) ZSTD_freeDStream(ds);
+		return GEN_FAIL;
+	}
+
+	RetStatus rst = SUCCESS;
+	ZSTD_inBuffer in = {stream->compressed, 0, 0};
+	ZSTD_outBuffer out = {NULL, 0, 0};
+	bool inputEnd = false;
+	bool outputFull = false;
+	/// Zero once a frame is complete.
+	size_t hint = 1;
+	while(rst == SUCCESS)
+	{
+		if((in.pos == in.size) && !inputEnd)
+		{
+			size_t len = 0;
+			rst = compressed_read(stream, &len);
+			in.size = len;
+			in.pos = 0;
+			inputEnd = (len == 0);
+			continue;
+		}
+		if((in.pos == in.size) && !outputFull)
+		{
+			if(hint != 0)
+			{
+				fprintf(stderr, "The zstd input is truncated.\n");
+				rst = GEN_FAIL;
+			}
+			break;
+		}
+
+		if(out.dst == NULL)
+		{
+			out.dst = block_acquire(stream);
+			if(out.dst == NULL) break;
+			out.size = DECOMPRESSED_BLOCK_LENGTH;
+			out.pos = 0;
+		}
+		hint = ZSTD_decompressStream(ds, &out, &in);
+		if(ZSTD_isError(hint))
+		{
+			fprintf(stderr, "Invalid zstd input: %s\n", ZSTD_getErrorName(hint));
+			rst = GEN_FAIL;
+		}
+
+		outputFull = (out.pos == out.size);
+		if(outputFull)
+		{
+			block_publish(stream, out.pos);
+			out.dst = NULL;
+		}
+	}
+	if((rst == SUCCESS) && (out.dst != NULL) && (out.pos != 0))
+		block_publish(stream, out.pos);
+	ZSTD_freeDStream(ds);
+
+	return rst;
+}
+#endif //HAVE_ZSTD
+
+#ifdef HAVE_LZMA
+/**
+ * @brief Decompresses an xz file, which may hold several streams.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @return	Return the status of the routine.
+ */
+static RetStatus xz_decompress(InputStream *stream)
+{
+	lzma_stream ls = LZMA_STREAM_INIT;
+	if(lzma_stream_decoder(&ls, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK)
+	{
+		fprintf(stderr, "Failed to initialize the xz decompression.\n");
+		return GEN_FAIL;
+	}
+
+	RetStatus rst = SUCCESS;
+	char *block = NULL;
+	bool inputEnd = false;
+	while(rst == SUCCESS)
+	{
+		if((ls.avail_in == 0) && !inputEnd)
+		{
+			size_t len = 0;
+			rst = compressed_read(stream, &len);
+			ls.next_in = stream->compressed;
+			ls.avail_in = len;
+			inputEnd = (len == 0);
+			continue;
+		}
+
+		if(block == NULL)
+		{
+			block = block_acquire(stream);
+			if(block == NULL) break;
+			ls.next_out = (uint8_t*)block;
+			ls.avail_out = DECOMPRESSED_BLOCK_LENGTH;
+		}
+		/// The concatenated streams only end once the decoder is told
+		/// that the input ended.
+		const lzma_ret ret = lzma_code(&ls, inputEnd ? LZMA_FINISH : LZMA_RUN);
+		if(ret == LZMA_STREAM_END) break;
+		if((ret == LZMA_BUF_ERROR) && inputEnd)
+		{
+			fprintf(stderr, "The xz input is truncated.\n");
+			rst = GEN_FAIL;
+		}
+		else if((ret != LZMA_OK) && (ret != LZMA_BUF_ERROR))
+		{
+			fprintf(stderr, "Invalid xz input, error code %d.\n", (int)ret);
+			rst = GEN_FAIL;
+		}
+
+		if(ls.avail_out == 0)
+		{
+			block_publish(stream, DECOMPRESSED_BLOCK_LENGTH);
+			block = NULL;
+		}
+	}
+	if((rst == SUCCESS) && (block != NULL) && (ls.avail_out != DECOMPRESSED_BLOCK_LENGTH))
+		block_publish(stream, DECOMPRESSED_BLOCK_LENGTH - ls.avail_out);
+	lzma_end(&ls);
+
+	return rst;
+}
+#endif //HAVE_LZMA
+
+/**
+ * @brief Runs the decompression of the file on its own thread,
+ * until the end of the file or until the stream is closed.
+ *
+ * @param[in, out]	arg	Pointer to the stream.
+ * @return	Always 0.
+ */
+#ifdef _MSC_VER
+static unsigned __stdcall decompress_thread(void *arg)
+#else
+static void* decompress_thread(void *arg)
+#endif //_MSC_VER
+{
+	InputStream *stream = (InputStream*)arg;
+	RetStatus rst = GEN_FAIL;
+	switch(stream->compression)
+	{
+#ifdef HAVE_ZLIB
+	case COMPRESSION_GZIP: rst = gzip_decompress(stream); break;
+#endif //HAVE_ZLIB
+#ifdef HAVE_ZSTD
+	case COMPRESSION_ZSTD: rst = zstd_decompress(stream); break;
+#endif //HAVE_ZSTD
+#ifdef HAVE_LZMA
+	case COMPRESSION_XZ: rst = xz_decompress(stream); break;
+#endif //HAVE_LZMA
+	default: break;
+	}
+
+	mutex_lock(&(stream->mutex));
+	stream->finished = true;
+	stream->failed = (rst != SUCCESS);
+	condition_broadcast(&(stream->filledCond));
+	mutex_unlock(&(stream->mutex));
+
+	return 0;
+}
+
+/**
+ * @brief Allocates the buffers of a compressed file and starts
+ * its decompression thread.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @return	Return the status of the routine.
+ */
+static RetStatus decompression_start(InputStream *stream)
+{
+	mutex_init(&(stream->mutex));
+	condition_init(&(stream->filledCond));
+	condition_init(&(stream->freedCond));
+
+	stream->compressed = (uint8_t*) malloc(COMPRESSED_BUFFER_LENGTH * sizeof(uint8_t));
+	if(stream->compressed == NULL) return GEN_FAIL;
+	for(uint32_t i = 0; i < DECOMPRESSED_BLOCKS; i++)
+	{
+		stream->blocks[i] = (char*) malloc(DECOMPRESSED_BLOCK_LENGTH * sizeof(char));
+		if(stream->blocks[i] == NULL) return GEN_FAIL;
+	}
+#ifdef _MSC_VER
+	stream->thread = (HANDLE)_beginthreadex(NULL, 0, decompress_thread, stream, 0, NULL);
+	stream->threadStarted = (stream->thread != 0);
+#else
+	stream->threadStarted =
+			(pthread_create(&(stream->thread), NULL, decompress_thread, stream) == 0);
+#endif //_MSC_VER
+	if(!stream->threadStarted)
+	{
+		fprintf(stderr, "Failed to start the decompression thread.\n");
+		return GEN_FAIL;
+	}
+
+	return SUCCESS;
+}
+
+InputStream* InputStream_open(FILE *fp)
+{
+	InputStream *stream = (InputStream*) calloc(1, sizeof(InputStream));
+	if(stream == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the input stream.\n");
+		return NULL;
+	}
+	stream->fp = fp;
+	/// Streams which can not tell their offset start at 0.
+	if(!file_tell(fp, &(stream->offset))) stream->offset = 0;
+
+	const size_t magic = magic_detect(stream);
+	if(ferror(fp))
+	{
+		fprintf(stderr, "Error while reading the input stream.\n");
+		InputStream_close(&stream);
+		return NULL;
+	}
+	stream->buffer = (char*) malloc(PLAIN_BUFFER_LENGTH * sizeof(char));
+	if(stream->buffer == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the buffer of the input stream.\n");
+		InputStream_close(&stream);
+		return NULL;
+	}
+	if(magic == NUM_MAGICS) return stream;
+
+	if(!compression_supported(magics[magic].compression))
+	{
+		fprintf(stderr, "The input is compressed with %s, which this build "
+				"does not support.\n", magics[magic].name);
+		InputStream_close(&stream);
+		return NULL;
+	}
+	/// Offsets of compressed files refer to their decompressed bytes.
+	stream->compression = magics[magic].compression;
+	stream->offset = 0;
+	if(decompression_start(stream) != SUCCESS)
+	{
+		fprintf(stderr, "Failed to start the decompression of the input.\n");
+		InputStream_close(&stream);
+		return NULL;
+	}
+
+	return stream;
+}
+
+/**
+ * @brief Reads the next bytes of a plain file to the buffer.
+ * @details Reading by line, a line is read as soon as it arrives.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @param[in]		line	Whether to stop after a new line.
+ * @return	Return the status of the routine.
+ */
+static RetStatus plain_read(InputStream *stream, const bool line)
+{
+	/// The bytes read to detect the compression come first. Only their
+	/// last byte can be a new line, as no magic number holds one.
+	size_t len = stream->magicLen;
+	memcpy(stream->buffer, stream->magic, len);
+	stream->magicLen = 0;
+	if(!line) len += fread(stream->buffer + len, sizeof(char), PLAIN_BUFFER_LENGTH - len,
+			stream->fp);
+	else if(((len == 0) || (stream->buffer[len - 1] != '\n')) &&
+			(fgets(stream->buffer + len, (int)(PLAIN_BUFFER_LENGTH - len), stream->fp) != NULL))
+		len += strlen(stream->buffer + len);
+
+	if(ferror(stream->fp))
+	{
+		fprintf(stderr, "Error while reading the input stream.\n");
+		return GEN_FAIL;
+	}
+	stream->block = stream->buffer;
+	stream->blockLen = len;
+	stream->blockPos = 0;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Releases the block of decompressed bytes being returned
+ * and waits for the next one.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @return	Return the status of the routine.
+ */
+static RetStatus decompressed_read(InputStream *stream)
+{
+	RetStatus rst = SUCCESS;
+	mutex_lock(&(stream->mutex));
+	if(stream->held)
+	{
+		stream->head = (stream->head + 1) % DECOMPRESSED_BLOCKS;
+		stream->filled--;
+		stream->held = false;
+		condition_broadcast(&(stream->freedCond));
+	}
+	while((stream->filled == 0) && !stream->finished)
+		condition_wait(&(stream->filledCond), &(stream->mutex));
+
+	stream->blockPos = 0;
+	stream->blockLen = 0;
+	if(stream->filled != 0)
+	{
+		stream->held = true;
+		stream->block = stream->blocks[stream->head];
+		stream->blockLen = stream->lengths[stream->head];
+	}
+	else if(stream->failed) rst = GEN_FAIL;
+	mutex_unlock(&(stream->mutex));
+
+	return rst;
+}
+
+/**
+ * @brief Joins in the buffer the parts of a line of a compressed file
+ * which continues in the next blocks.
+ *
+ * @param[in, out]	stream	Pointer to the stream.
+ * @param[out]		bytes	Pointer to the pointer of the bytes of the line.
+ * @param[out]		length	Pointer to the number of bytes of the line.
+ * @return	Return the status of the routine.
+ */
+static RetStatus line_join(InputStream *stream, const char **bytes, size_t *length)
+{
+	size_t len = 0;
+	bool lineEnd = false;
+	while(!lineEnd && (len < PLAIN_BUFFER_LENGTH))
+	{
+		if((stream->blockPos == stream->blockLen) && (decompressed_read(stream) != SUCCESS))
+			return GEN_FAIL;
+		if(stream->blockLen == 0) break;
+
+		const char *start = stream->block + stream->blockPos;
+		size_t part = stream->blockLen - stream->blockPos;
+		const char *newLine = (const char*) memchr(start, '\n', part);
+		if(newLine != NULL) part = (size_t)(newLine - start) + 1;
+		if(part > PLAIN_BUFFER_LENGTH - len) part = PLAIN_BUFFER_LENGTH - len;
+		else lineEnd = (newLine != NULL);
+
+		memcpy(stream->buffer + len, start, part);
+		len += part;
+		stream->blockPos += part;
+		stream->offset += part;
+	}
+	*bytes = stream->buffer;
+	*length = len;
+
+	return SUCCESS;
+}
+
+RetStatus InputStream_next(InputStream *stream, const bool line, const char **bytes,
+		size_t *length)
+{
+	if(stream->blockPos == stream->blockLen)
+	{
+		const RetStatus rst = (stream->compression == COMPRESSION_NONE)
+				? plain_read(stream, line) : decompressed_read(stream);
+		if(rst != SUCCESS) return GEN_FAIL;
+	}
+
+	const char *start = stream->block + stream->blockPos;
+	size_t len = stream->blockLen - stream->blockPos;
+	if(line)
+	{
+		const char *lineEnd = (const char*) memchr(start, '\n', len);
+		if(lineEnd != NULL) len = (size_t)(lineEnd - start) + 1;
+		/// Lines are only split between blocks if they are too long.
+		else if(stream->compression != COMPRESSION_NONE) return line_join(stream, bytes, length);
+	}
+	stream->blockPos += len;
+	stream->offset += len;
+	*bytes = start;
+	*length = len;
+
+	return SUCCESS;
+}
+
+RetStatus InputStream_seek(InputStream *stream, const uint64_t offset)
+{
+	if(stream->compression == COMPRESSION_NONE)
+	{
+		if(!file_seek(stream->fp, offset))
+		{
+			fprintf(stderr, "Failed to seek the input stream.\n");
+			return GEN_FAIL;
+		}
+		stream->magicLen = 0;
+		stream->blockLen = 0;
+		stream->blockPos = 0;
+		stream->offset = offset;
+		return SUCCESS;
+	}
+
+	if(offset < stream->offset)
+	{
+		fprintf(stderr, "Compressed input can not be read backwards.\n");
+		return GEN_FAIL;
+	}
+	while(stream->offset < offset)
+	{
+		if((stream->blockPos == stream->blockLen) && (decompressed_read(stream) != SUCCESS))
+			return GEN_FAIL;
+		if(stream->blockLen == 0)
+		{
+			fprintf(stderr, "The compressed input ends before the offset to seek.\n");
+			return GEN_FAIL;
+		}
+		const uint64_t left = offset - stream->offset;
+		const size_t skip = (left < stream->blockLen - stream->blockPos)
+				? (size_t)left : stream->blockLen - stream->blockPos;
+		stream->blockPos += skip;
+		stream->offset += skip;
+	}
+
+	return SUCCESS;
+}
+
+uint64_t InputStream_offset(const InputStream *stream)
+{
+	return stream->offset;
+}
+
+void InputStream_pause(InputStream *stream)
+{
+	if(!stream->threadStarted) return;
+
+	mutex_lock(&(stream->mutex));
+	stream->paused = true;
+	while(!stream->parked && !stream->finished)
+		condition_wait(&(stream->filledCond), &(stream->mutex));
+	mutex_unlock(&(stream->mutex));
+}
+
+void InputStream_resume(InputStream *stream)
+{
+	if(!stream->threadStarted) return;
+
+	mutex_lock(&(stream->mutex));
+	stream->paused = false;
+	condition_broadcast(&(stream->freedCond));
+	mutex_unlock(&(stream->mutex));
+}
+
+void InputStream_close(InputStream **stream)
+{
+	InputStream *s = *stream;
+	if(s->threadStarted)
+	{
+		mutex_lock(&(s->mutex));
+		s->stopped = true;
+		condition_broadcast(&(s->freedCond));
+		mutex_unlock(&(s->mutex));
+#ifdef _MSC_VER
+		WaitForSingleObject(s->thread, INFINITE);
+		CloseHandle(s->thread);
+#else
+		pthread_join(s->thread, NULL);
+#endif //_MSC_VER
+	}
+	if(s->compression != COMPRESSION_NONE)
+	{
+		condition_destroy(&(s->freedCond));
+		condition_destroy(&(s->filledCond));
+		mutex_destroy(&(s->mutex));
+	}
+	for(uint32_t i = 0; i < DECOMPRESSED_BLOCKS; i++) free(s->blocks[i]);
+	free(s->compressed);
+	free(s->buffer);
+	free(s);
+	*stream = NULL;
+}
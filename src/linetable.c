@@ -0,0 +1,184 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "linetable.h"
+#include "utils.h"
+#include <string.h>
+
+/// The initial capacity of the pool of characters of the lines.
+#define INITIAL_LINE_POOL_BYTES (1 << 16)
+
+/// @brief A distinct line of the table.
+typedef struct
+{
+	/// The hash of the line.
+	uint64_t hash;
+	/// The offset of the line in the pool of characters.
+	size_t offset;
+	/// The length of the line.
+	size_t length;
+	/// The number of times the line was added.
+	size_t count;
+}LineEntry;
+
+struct LineTable
+{
+	/// The slots of the hash table, holding the index of a line plus one,
+	/// or 0 if empty.
+	uint32_t *slots;
+	/// The number of slots, a power of 2.
+	size_t numSlots;
+	/// The distinct lines, in the order they were added.
+	LineEntry *lines;
+	/// The number of distinct lines.
+	size_t numLines;
+	/// The maximum number of distinct lines.
+	size_t maxLines;
+	/// The characters of the lines.
+	char *pool;
+	/// The number of characters of the pool used.
+	size_t poolLen;
+	/// The capacity of the pool.
+	size_t poolCapacity;
+	/// The maximum capacity of the pool.
+	size_t maxBytes;
+	/// The number of lines added since the table was created.
+	size_t added;
+	/// The number of distinct lines since the table was created,
+	/// counting those of each clearing of the table.
+	size_t distinct;
+};
+
+LineTable* LineTable_create(const size_t maxLines, const size_t maxBytes)
+{
+	if((maxLines == 0) || (maxLines >= UINT32_MAX) || (maxBytes == 0))
+	{
+		fprintf(stderr, "Invalid size of the line table.\n");
+		return NULL;
+	}
+
+	LineTable *ltab = (LineTable*) calloc(1, sizeof(LineTable));
+	if(ltab == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the line table.\n");
+		return NULL;
+	}
+	/// At most half of the slots are used, keeping the probes short.
+	ltab->numSlots = next_2power(maxLines * 2);
+	ltab->maxLines = maxLines;
+	ltab->maxBytes = maxBytes;
+	ltab->poolCapacity = (maxBytes < INITIAL_LINE_POOL_BYTES) ? maxBytes : INITIAL_LINE_POOL_BYTES;
+	ltab->slots = (uint32_t*) calloc(ltab->numSlots, sizeof(uint32_t));
+	ltab->lines = (LineEntry*) malloc(maxLines * sizeof(LineEntry));
+	ltab->pool = (char*) malloc(ltab->poolCapacity);
+	if((ltab->slots == NULL) || (ltab->lines == NULL) || (ltab->pool == NULL))
+	{
+		fprintf(stderr, "Failed to allocate the line table.\n");
+		LineTable_destroy(&ltab);
+		return NULL;
+	}
+
+	return ltab;
+}
+
+RetStatus LineTable_add(LineTable *ltab, const char *line, const size_t len)
+{
+	const uint64_t hash = fnvhash((const uint8_t*) line, (uint32_t)len);
+	const size_t mask = ltab->numSlots - 1;
+	size_t slot = (size_t)(hash ^ (hash >> 32)) & mask;
+	for(; ltab->slots[slot] != 0; slot = (slot + 1) & mask)
+	{
+		LineEntry *entry = &(ltab->lines[ltab->slots[slot] - 1]);
+		if((entry->hash == hash) && (entry->length == len) &&
+			(memcmp(ltab->pool + entry->offset, line, len) == 0))
+		{
+			entry->count++;
+			ltab->added++;
+			return SUCCESS;
+		}
+	}
+
+	if((ltab->numLines == ltab->maxLines) || (ltab->poolLen + len > ltab->maxBytes))
+		return DATA_STRUCT_FULL;
+	if(ltab->poolLen + len > ltab->poolCapacity)
+	{
+		size_t newCapacity = ltab->poolCapacity;
+		while(newCapacity < ltab->poolLen + len) newCapacity *= 2;
+		if(newCapacity > ltab->maxBytes) newCapacity = ltab->maxBytes;
+		char *newPool = (char*) realloc(ltab->pool, newCapacity);
+		if(newPool == NULL)
+		{
+			fprintf(stderr, "Failed to grow the line table.\n");
+			return GEN_FAIL;
+		}
+		ltab->pool = newPool;
+		ltab->poolCapacity = newCapacity;
+	}
+
+	LineEntry *entry = &(ltab->lines[ltab->numLines]);
+	entry->hash = hash;
+	entry->offset = ltab->poolLen;
+	entry->length = len;
+	entry->count = 1;
+	memcpy(ltab->pool + ltab->poolLen, line, len);
+	ltab->poolLen += len;
+	ltab->numLines++;
+	ltab->slots[slot] = (uint32_t)ltab->numLines;
+	ltab->added++;
+	ltab->distinct++;
+
+	return SUCCESS;
+}
+
+size_t LineTable_get_size(const LineTable *ltab)
+{
+	return ltab->numLines;
+}
+
+const char* LineTable_line_at(const LineTable *ltab, const size_t index, size_t *len,
+		size_t *count)
+{
+	const LineEntry *entry = &(ltab->lines[index]);
+	*len = entry->length;
+	*count = entry->count;
+	return ltab->pool + entry->offset;
+}
+
+void LineTable_clear(LineTable *ltab)
+{
+	memset(ltab->slots, 0, ltab->numSlots * sizeof(uint32_t));
+	ltab->numLines = 0;
+	ltab->poolLen = 0;
+}
+
+void LineTable_stats_print(const LineTable *ltab)
+{
+	printf("\nLine Table statistics:\n");
+	printf("\tLines read: %ld\n", ltab->added);
+	printf("\tLines tokenized: %ld (%.2f%%)\n", ltab->distinct,
+			(ltab->added != 0) ? 100.0 * (double)ltab->distinct / (double)ltab->added : 0.0);
+}
+
+void LineTable_destroy(LineTable **ltab)
+{
+	free((*ltab)->slots);
+	free((*ltab)->lines);
+	free((*ltab)->pool);
+	free(*ltab);
+	*ltab = NULL;
+}
@@ -0,0 +1,130 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "manifest.h"
+#include <stdlib.h>
+#include <string.h>
+
+/// The initial capacity of the buffer of a path.
+#define INITIAL_PATH_LENGTH 256
+
+struct Manifest
+{
+	/// The file holding the list.
+	FILE *file;
+	/// Whether the list is read from the standard input, which is left open.
+	bool isStdin;
+	/// The character separating the paths.
+	int delimiter;
+	/// The buffer of the path being read.
+	char *path;
+	/// The capacity of the buffer of the path.
+	size_t capacity;
+	/// Whether reading the list failed.
+	bool failed;
+};
+
+Manifest* Manifest_open(const char *path, const bool nulDelimited)
+{
+	Manifest *manifest = (Manifest*) calloc(1, sizeof(Manifest));
+	if(manifest == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the manifest.\n");
+		return NULL;
+	}
+	manifest->delimiter = nulDelimited ? '\0' : '\n';
+	manifest->capacity = INITIAL_PATH_LENGTH;
+	manifest->path = (char*) malloc(manifest->capacity);
+	if(manifest->path == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the manifest.\n");
+		Manifest_close(&manifest);
+		return NULL;
+	}
+
+	if(strcmp(path, "-") == 0)
+	{
+		manifest->file = stdin;
+		manifest->isStdin = true;
+	}
+	else if(!file_open(&(manifest->file), path, "rb"))
+	{
+		fprintf(stderr, "Failed to open manifest: %s\n", path);
+		Manifest_close(&manifest);
+		return NULL;
+	}
+
+	return manifest;
+}
+
+const char* Manifest_next(Manifest *manifest)
+{
+	if(manifest->failed) return NULL;
+
+	size_t len = 0;
+	int ch = 0;
+	do
+	{
+		len = 0;
+		while(((ch = getc(manifest->file)) != EOF) && (ch != manifest->delimiter))
+		{
+			/// One more character is kept for the null terminator.
+			if(len + 1 == manifest->capacity)
+			{
+				char *extPath = (char*) realloc(manifest->path, 2 * manifest->capacity);
+				if(extPath == NULL)
+				{
+					fprintf(stderr, "Failed to extend the path of the manifest.\n");
+					manifest->failed = true;
+					return NULL;
+				}
+				manifest->path = extPath;
+				manifest->capacity *= 2;
+			}
+			manifest->path[len++] = (char)ch;
+		}
+		if((manifest->delimiter == '\n') && (len != 0) && (manifest->path[len - 1] == '\r'))
+			len--;
+	} while((len == 0) && (ch != EOF));
+
+	if(ferror(manifest->file))
+	{
+		fprintf(stderr, "Failed to read the manifest.\n");
+		manifest->failed = true;
+		return NULL;
+	}
+	if(len == 0) return NULL;
+	manifest->path[len] = '\0';
+
+	return manifest->path;
+}
+
+bool Manifest_failed(const Manifest *manifest)
+{
+	return manifest->failed;
+}
+
+void Manifest_close(Manifest **manifest)
+{
+	if(((*manifest)->file != NULL) && !(*manifest)->isStdin) fclose((*manifest)->file);
+	free((*manifest)->path);
+	free(*manifest);
+	*manifest = NULL;
+}
@@ -18,6 +18,7 @@
 
 #include "memstructs.h"
 #include "utils.h"
+#include "unicode.h"
 #include <string.h>
 #ifdef _DEBUG
 #include <assert.h>
@@ -137,6 +138,67 @@ void WordBuffer_clear(WordBuffer *wbuf)
 	wbuf->letters[0] = '\0';
 }
 
+/**
+ * @brief Ensures that the Word Buffer can hold a string of the specified
+ * length along with its null terminator.
+ * @details Expands the buffer to the next power of 2 fitting the string.
+ *
+ * @param[in, out]	wbuf	Pointer to the buffer.
+ * @param[in]		len		The length of the string, without the terminator.
+ * @return	Returns the status of the routine.
+ */
+static RetStatus WordBuffer_reserve(WordBuffer *wbuf, const uint32_t len)
+{
+	if(len < wbuf->capacity) return SUCCESS;
+
+	const uint32_t newLen = (uint32_t)next_2power((size_t)len + 1);
+	char *ext_letters = (char*)realloc(wbuf->letters, newLen * sizeof(char));
+	if(ext_letters == NULL)
+	{
+		fprintf(stderr,"String Expansion failed "
+				"for a %d characters long Word Buffer.\n", newLen);
+		return GEN_FAIL;
+	}
+	wbuf->letters = ext_letters;
+	wbuf->capacity = newLen;
+
+	return SUCCESS;
+}
+
+RetStatus WordBuffer_set(WordBuffer *wbuf, const char *str, const uint32_t len)
+{
+	if(WordBuffer_reserve(wbuf, len) != SUCCESS) return GEN_FAIL;
+
+	memcpy(wbuf->letters, str, len);
+	wbuf->curPosition = len;
+	/// ensures that the string is null-terminated and printable.
+	wbuf->letters[len] = '\0';
+
+	return SUCCESS;
+}
+
+RetStatus WordBuffer_append(WordBuffer *wbuf, const char *str, const uint32_t len)
+{
+	if(WordBuffer_reserve(wbuf, wbuf->curPosition + len) != SUCCESS) return GEN_FAIL;
+
+	memcpy(wbuf->letters + wbuf->curPosition, str, len);
+	wbuf->curPosition += len;
+	/// ensures that the string is null-terminated and printable.
+	wbuf->letters[wbuf->curPosition] = '\0';
+
+	return SUCCESS;
+}
+
+const char* WordBuffer_get_word(const WordBuffer *wbuf)
+{
+	return wbuf->letters;
+}
+
+uint32_t WordBuffer_get_length(const WordBuffer *wbuf)
+{
+	return wbuf->curPosition;
+}
+
 void WordBuffer_print(const WordBuffer *wbuf)
 {
 	printf("%d bytes allocated and %d used for Word Buffer: %s\n",
@@ -271,6 +333,15 @@ size_t WordBufferVector_get_size(const WordBufferVector *vec)
 	return vec->curPosition;
 }
 
+void WordBufferVector_clear(WordBufferVector *vec)
+{
+	for(size_t i=0; i<vec->curPosition; i++)
+	{
+		WordBuffer_free(&(vec->buffers[i]));
+	}
+	vec->curPosition = 0;
+}
+
 void WordBufferVector_print(const WordBufferVector *vec)
 {
 	printf("%ld entries allocated and %ld used for Word Buffer Vector. "
@@ -424,6 +495,8 @@ typedef struct
 	uint32_t length;
 	/// The relative displacement to the initial value of its hash index.
 	int displacement;
+	/// The sequential id of the word, assigned when first added to the table.
+	uint32_t id;
 }WordHashTabEntry;
 
 struct WordHashTable
@@ -434,7 +507,7 @@ struct WordHashTable
 	size_t *alphOrderArray;
 	/// The current capacity of the table.
 	size_t capacity;
-	/// The current size of the table.
+	/// The current size of the table, including tombstones.
 	size_t size;
 	/// A pool of characters for the strings of the words
 	/// to avoid frequent dynamic allocations
@@ -443,8 +516,25 @@ struct WordHashTable
 	HashStats hstats;
 	/// Statistics related to the output format of the table.
 	PrintFormatStats pfstats;
+	/// Whether removals may have invalidated the output format statistics.
+	bool pfstatsStale;
+	/// The number of entries whose count dropped to 0. Tombstones keep their
+	/// string, so that the probing sequences passing over them stay intact.
+	size_t numTombstones;
+	/// The number of characters of the pool no longer used by any entry.
+	size_t deadChars;
+	/// The index of the entry holding each word id, or ID_RETIRED
+	/// once the word has left the table.
+	size_t *idIndices;
+	/// The number of word ids assigned.
+	uint32_t numIds;
+	/// The capacity of the array of the entry indices of the ids.
+	size_t idCapacity;
 };
 
+/// Marks a word id whose word is no longer in the table.
+#define ID_RETIRED SIZE_MAX
+
 WordHashTable* WordHashTable_create(const size_t initCapacity)
 {
 	WordHashTable *newTable = (WordHashTable*) calloc(1, sizeof(WordHashTable));
@@ -559,184 +649,291 @@ static void orderArray_insert(WordHashTable *whtab, const char *newWord, const s
 	}
 }
 
-RetStatus WordHashTable_add_word(WordHashTable* whtab, const WordBuffer* buf)
+/**
+ * @brief Removes the index of an entry from the alphabetically ordered array.
+ * @details The position of the index is found using binary search
+ * on the string of the entry.
+ *
+ * @param[in, out]	whtab	Pointer to the Hash table.
+ * @param[in]		ind		The index of the Hash table entry to be removed.
+ * @return	Void
+ */
+static void orderArray_remove(WordHashTable *whtab, const size_t ind)
 {
-	WordHashTabEntry* curEntry = NULL;
+	const char *word = whtab->entries[ind].letters;
+	size_t low = 0;
+	size_t high = whtab->size;
+	while(low < high)
+	{
+		const size_t mid = low + (high - low) / 2;
+		if(strcmp(whtab->entries[whtab->alphOrderArray[mid]].letters, word) < 0)
+			low = mid + 1;
+		else high = mid;
+	}
 
-	/// The hash index computed is shortened to the capacity of the table
+	memmove(&(whtab->alphOrderArray[low]), &(whtab->alphOrderArray[low + 1]),
+			(whtab->size - low - 1) * sizeof(size_t));
+	whtab->size--;
+}
+
+/**
+ * @brief Moves to the next position of the probing sequence of a hash index.
+ * @details The table is iterated in both directions starting from the
+ * hash index, so the displacements are 0, +1, -1, +2, -2 and so on,
+ * skipping those outside the table.
+ *
+ * @param[in]		hashIndex	The shortened hash index of the word.
+ * @param[in]		capacity	The capacity of the table.
+ * @param[in, out]	displ		Pointer to the current displacement.
+ * @return	Returns false if the table is exhausted.
+ */
+static inline bool probe_next(const int64_t hashIndex, const size_t capacity, int *displ)
+{
+	for(;;)
+	{
+		*displ = (*displ > 0) ? -(*displ) : 1 - *displ;
+		const int64_t magnitude = (*displ > 0) ? *displ : -(*displ);
+		if(((size_t)(hashIndex + magnitude) >= capacity) && (hashIndex < magnitude))
+			return false;
+		const int64_t curIndex = hashIndex + *displ;
+		if((curIndex >= 0) && ((size_t)curIndex < capacity)) return true;
+	}
+}
+
+/**
+ * @brief Evaluates whether an entry holds the specified word.
+ * @details The displacement is compared first, as the same word
+ * always has the same hash index.
+ *
+ * @param[in]	curEntry	Pointer to the entry.
+ * @param[in]	letters		Pointer to the string of the word.
+ * @param[in]	length		The length of the string, including the terminator.
+ * @param[in]	displ		The displacement of the entry from the word's hash index.
+ * @return	Returns true if the entry holds the word.
+ */
+static inline bool entry_matches(const WordHashTabEntry *curEntry, const char *letters,
+		const uint32_t length, const int displ)
+{
+	return (curEntry->length == length) && (curEntry->displacement == displ) &&
+			(memcmp(curEntry->letters, letters, length - 1) == 0);
+}
+
+/**
+ * @brief Searches the table for the entry holding the specified word.
+ * @details Tombstones are iterated over, so the entry is found even if
+ * entries before it in its probing sequence were emptied.
+ *
+ * @param[in]	whtab	Pointer to the Hash table.
+ * @param[in]	letters	Pointer to the string of the word.
+ * @param[in]	length	The length of the string, including the terminator.
+ * @return	Returns the index of the entry, -1 if the word is not on the table.
+ */
+static int64_t entry_find(const WordHashTable *whtab, const char *letters,
+		const uint32_t length)
+{
 	const int64_t hashIndex = (int64_t)
-			(fnvhash((uint8_t*) buf->letters, buf->curPosition + 1) % whtab->capacity);
-	int newDispl = 0;
+			(fnvhash((const uint8_t*) letters, length) % whtab->capacity);
+	int displ = 0;
 	do
 	{
-		/// Starting from the shortened hash index, the table is iterated
-		/// in both directions until either the word is found in the table,
-		/// if it exists already, or an empty slot is found.
-		size_t curIndex =(size_t)(hashIndex + newDispl);
-		if(curIndex < whtab->capacity)
-		{
-			curEntry = &(whtab->entries[curIndex]);
-			if(curEntry->count == 0)
-			{
-				curEntry->letters =
-					MemoryPool_alloc_block(&(whtab->stringsPool),
-							(buf->curPosition + 1) * sizeof(char));
-				if(curEntry->letters == NULL)
-				{
-#ifdef _DEBUG
-					printf("String Pool is full. "
-							"Allocation for new entry failed!\n");
-#endif //_DEBUG
-					return DATA_STRUCT_FULL;
-				}
-				curEntry->length = buf->curPosition + 1;
-				if(!string_copy(curEntry->letters, buf->letters, curEntry->length))
-				{
-					fprintf(stderr, "Failed to copy word \"%s\" "
-							"to a new entry", buf->letters);
-					return GEN_FAIL;
-				}
-				curEntry->count++;
-				curEntry->displacement = newDispl;
+		const WordHashTabEntry* curEntry = &(whtab->entries[hashIndex + displ]);
+		if(curEntry->letters == NULL) return -1;
+		if(entry_matches(curEntry, letters, length, displ)) return hashIndex + displ;
+	} while(probe_next(hashIndex, whtab->capacity, &displ));
 
-				/// The index is also appended to the alphabetically order array.
-				orderArray_insert(whtab, curEntry->letters, curIndex);
-
-				whtab->hstats.totalInsertions++;
-				/// Absolute displacements larger than 0 for new entries
-				/// mean that collisions occurred.
-				if(newDispl>0) whtab->hstats.totalCollisions +=
-						(uint64_t)newDispl;
+	return -1;
+}
 
-				if(whtab->size == 0)
-				{
-					/// If the table is empty, the word is both the
-					/// longest and the most frequently occurring.
-					whtab->pfstats.maxCountWordIndex = curIndex;
-					whtab->pfstats.maxLengthWordIndex = curIndex;
-				}
-				else
-				{
-					/// if the table is not empty, it is not possible
-					/// for the word to be the most frequently occurring.
-					WordHashTabEntry* maxLengthWord =
-							&(whtab->entries[whtab->pfstats.maxLengthWordIndex]);
-					if(curEntry->length > maxLengthWord->length)
-						whtab->pfstats.maxLengthWordIndex = curIndex;
-				}
+/**
+ * @brief Places a new word to an empty or a tombstone entry of the table.
+ * @details The string of a reused tombstone is left unreferenced in the pool.
+ * If there is not enough space in the strings pool for the word,
+ * it fails with DATA_STRUCT_FULL leaving the table unchanged.
+ *
+ * @param[in, out]	whtab		Pointer to the Hash table.
+ * @param[in]		curIndex	The index of the entry.
+ * @param[in]		displ		The displacement of the entry from the word's hash index.
+ * @param[in]		buf			The Word Buffer of the word to be added.
+ * @param[in]		count		The number of occurrences of the word.
+ * @return	Returns the status of the routine.
+ */
+static RetStatus entry_insert(WordHashTable *whtab, const size_t curIndex, const int displ,
+		const WordBuffer *buf, const size_t count)
+{
+	WordHashTabEntry* curEntry = &(whtab->entries[curIndex]);
 
-				whtab->size++;
-				return SUCCESS;
-			}
-			else
-			{
-				if((curEntry->length == buf->curPosition + 1) &&
-					(curEntry->displacement == newDispl) &&
-					(curEntry->letters[0] == buf->letters[0])
-					&& curEntry->letters[curEntry->length - 2]
-					== buf->letters[buf->curPosition - 1])
-				{
-					curEntry->count++;
-
-					WordHashTabEntry* maxCountWord =
-							&(whtab->entries[whtab->pfstats.maxCountWordIndex]);
-					/// If the word is already on the table, its length
-					/// was already evaluated and thus only its count is
-					/// compared to the max.
-					if(curEntry->count > maxCountWord->count)
-					{
-						whtab->pfstats.maxCountWordIndex = curIndex;
-					}
-
-					return SUCCESS;
-				}
-			}
+	/// Ids are dense, so their array grows along with the words added.
+	if(whtab->numIds == whtab->idCapacity)
+	{
+		if(whtab->numIds == UINT32_MAX)
+		{
+			fprintf(stderr, "Word ids are exhausted after %u words.\n", whtab->numIds);
+			return GEN_FAIL;
 		}
-
-		if((hashIndex >= newDispl) &&(newDispl > 0))
+		size_t newIdCapacity = (whtab->idCapacity != 0) ? 2 * whtab->idCapacity
+				: whtab->capacity;
+		if(newIdCapacity > UINT32_MAX) newIdCapacity = UINT32_MAX;
+		size_t *newIdIndices = (size_t*) realloc(whtab->idIndices,
+				newIdCapacity * sizeof(size_t));
+		if(newIdIndices == NULL)
 		{
-			curIndex =(size_t)(hashIndex - newDispl);
-			curEntry = &(whtab->entries[curIndex]);
-			if(curEntry->count == 0)
-			{
-				curEntry->letters =
-					MemoryPool_alloc_block(&(whtab->stringsPool),
-							(buf->curPosition + 1) * sizeof(char));
-				if(curEntry->letters == NULL)
-				{
+			fprintf(stderr, "Failed to expand the word ids for %ld words\n",
+					newIdCapacity);
+			return GEN_FAIL;
+		}
+		whtab->idIndices = newIdIndices;
+		whtab->idCapacity = newIdCapacity;
+	}
+
+	char *letters = MemoryPool_alloc_block(&(whtab->stringsPool),
+			(buf->curPosition + 1) * sizeof(char));
+	if(letters == NULL)
+	{
 #ifdef _DEBUG
-					printf("String Pool is full. Allocation for new entry failed!\n");
+		printf("String Pool is full. Allocation for new entry failed!\n");
 #endif //_DEBUG
-					return DATA_STRUCT_FULL;
-				}
-				curEntry->length = buf->curPosition + 1;
-				if(!string_copy(curEntry->letters, buf->letters, curEntry->length))
-				{
-					fprintf(stderr, "Failed to copy word \"%s\" to a new entry",
-						buf->letters);
-					return GEN_FAIL;
-				}
-				curEntry->count++;
-				curEntry->displacement = -newDispl;
+		return DATA_STRUCT_FULL;
+	}
+	if(!string_copy(letters, buf->letters, buf->curPosition + 1))
+	{
+		fprintf(stderr, "Failed to copy word \"%s\" to a new entry", buf->letters);
+		return GEN_FAIL;
+	}
 
-				/// The index is also appended to the alphabetically order array.
-				orderArray_insert(whtab, curEntry->letters, curIndex);
+	if(curEntry->letters != NULL)
+	{
+		orderArray_remove(whtab, curIndex);
+		whtab->deadChars += curEntry->length;
+		whtab->numTombstones--;
+		whtab->idIndices[curEntry->id] = ID_RETIRED;
+	}
+	curEntry->letters = letters;
+	curEntry->length = buf->curPosition + 1;
+	curEntry->count = count;
+	curEntry->displacement = displ;
+	curEntry->id = whtab->numIds++;
+	whtab->idIndices[curEntry->id] = curIndex;
+
+	/// The index is also appended to the alphabetically order array.
+	orderArray_insert(whtab, curEntry->letters, curIndex);
+
+	whtab->hstats.totalInsertions++;
+	/// Absolute displacements larger than 0 for new entries
+	/// mean that collisions occurred.
+	if(displ != 0) whtab->hstats.totalCollisions += (uint64_t)abs(displ);
+
+	if(whtab->size == 0)
+	{
+		/// If the table is empty, the word is both the
+		/// longest and the most frequently occurring.
+		whtab->pfstats.maxCountWordIndex = curIndex;
+		whtab->pfstats.maxLengthWordIndex = curIndex;
+	}
+	else
+	{
+		/// A new word may only be the most frequently occurring
+		/// if it was added with a count larger than 1.
+		WordHashTabEntry* maxLengthWord =
+				&(whtab->entries[whtab->pfstats.maxLengthWordIndex]);
+		if(curEntry->length > maxLengthWord->length)
+		{
+			whtab->pfstats.maxLengthWordIndex = curIndex;
+		}
+		if(curEntry->count >
+			whtab->entries[whtab->pfstats.maxCountWordIndex].count)
+		{
+			whtab->pfstats.maxCountWordIndex = curIndex;
+		}
+	}
 
-				whtab->hstats.totalInsertions++;
-				/// Absolute displacements larger than 0 for new entries
-				/// mean that collisions occurred.
-				if(newDispl>0) whtab->hstats.totalCollisions +=
-						(uint64_t)newDispl;
+	whtab->size++;
+	return SUCCESS;
+}
 
-				if(whtab->size == 0)
-				{
-					/// If the table is empty, the word is both the
-					/// longest and the most frequently occurring.
-					whtab->pfstats.maxCountWordIndex = curIndex;
-					whtab->pfstats.maxLengthWordIndex = curIndex;
-				}
-				else
-				{
-					/// if the table is not empty, it is not possible
-					/// for the word to be the most frequently occurring.
-					WordHashTabEntry* maxLengthWord =
-							&(whtab->entries[whtab->pfstats.maxLengthWordIndex]);
-					if(curEntry->length > maxLengthWord->length)
-					{
-						whtab->pfstats.maxLengthWordIndex = curIndex;
-					}
-				}
+/**
+ * @brief Increases the counter of an entry already holding a word.
+ * @details A tombstone holding the word is revived in place.
+ *
+ * @param[in, out]	whtab		Pointer to the Hash table.
+ * @param[in]		curIndex	The index of the entry.
+ * @param[in]		count		The number of occurrences to be added.
+ * @return	Void
+ */
+static void entry_increment(WordHashTable *whtab, const size_t curIndex, const size_t count)
+{
+	WordHashTabEntry* curEntry = &(whtab->entries[curIndex]);
+	if(curEntry->count == 0) whtab->numTombstones--;
+	curEntry->count += count;
+
+	WordHashTabEntry* maxCountWord =
+			&(whtab->entries[whtab->pfstats.maxCountWordIndex]);
+	/// If the word is already on the table, its length
+	/// was already evaluated and thus only its count is
+	/// compared to the max.
+	if(curEntry->count > maxCountWord->count)
+	{
+		whtab->pfstats.maxCountWordIndex = curIndex;
+	}
+}
 
-				whtab->size++;
-				return SUCCESS;
-			}
-			else
+/**
+ * @brief Adds the occurrences of a word to the Hash table and provides
+ * the index of the entry holding it.
+ *
+ * @param[in, out]	whtab	Pointer to the Hash table.
+ * @param[in]		buf		The Word Buffer of the word to be added.
+ * @param[in]		count	The number of occurrences to be added.
+ * @param[out]		index	Pointer to the index of the entry holding the word.
+ * @return	Returns the status of the routine.
+ */
+static RetStatus WordHashTable_add_entry(WordHashTable* whtab, const WordBuffer* buf,
+		const size_t count, size_t *index)
+{
+	const uint32_t length = buf->curPosition + 1;
+	/// The hash index computed is shortened to the capacity of the table
+	const int64_t hashIndex = (int64_t)
+			(fnvhash((uint8_t*) buf->letters, length) % whtab->capacity);
+	/// The first tombstone met, to be reused if the word is not on the table.
+	int64_t tombIndex = -1;
+	int tombDispl = 0;
+	int newDispl = 0;
+	do
+	{
+		/// Starting from the shortened hash index, the table is iterated
+		/// in both directions until either the word is found in the table,
+		/// if it exists already, or an empty slot is found.
+		/// Tombstones do not stop the iteration, as the word may have been
+		/// placed after them before they were emptied.
+		const size_t curIndex = (size_t)(hashIndex + newDispl);
+		WordHashTabEntry* curEntry = &(whtab->entries[curIndex]);
+		if(curEntry->letters == NULL)
+		{
+			if(tombIndex >= 0)
 			{
-				if((curEntry->length == buf->curPosition + 1) &&
-					(curEntry->displacement == -newDispl) &&
-					(curEntry->letters[0] == buf->letters[0]) &&
-					curEntry->letters[curEntry->length - 2]
-					== buf->letters[buf->curPosition - 1])
-				{
-					curEntry->count++;
-
-					WordHashTabEntry* maxCountWord =
-						&(whtab->entries[whtab->pfstats.maxCountWordIndex]);
-					/// If the word is already on the table, its length
-					/// was already evaluated and thus only its count is
-					/// compared to the max.
-					if(curEntry->count > maxCountWord->count)
-					{
-						whtab->pfstats.maxCountWordIndex = curIndex;
-					}
-
-					return SUCCESS;
-				}
+				*index = (size_t)tombIndex;
+				return entry_insert(whtab, *index, tombDispl, buf, count);
 			}
+			*index = curIndex;
+			return entry_insert(whtab, curIndex, newDispl, buf, count);
+		}
+		if(entry_matches(curEntry, buf->letters, length, newDispl))
+		{
+			*index = curIndex;
+			entry_increment(whtab, curIndex, count);
+			return SUCCESS;
 		}
-		newDispl++;
+		if((curEntry->count == 0) && (tombIndex < 0))
+		{
+			tombIndex = (int64_t)curIndex;
+			tombDispl = newDispl;
+		}
+	} while(probe_next(hashIndex, whtab->capacity, &newDispl));
 
-	} while(((size_t)(hashIndex + newDispl) < whtab->capacity) ||(hashIndex >= newDispl));
+	if(tombIndex >= 0)
+	{
+		*index = (size_t)tombIndex;
+		return entry_insert(whtab, *index, tombDispl, buf, count);
+	}
 
 	/// If the table is exhausted without finding the entry
 	/// or an empty slot to insert it, the process fails.
@@ -748,11 +945,217 @@ RetStatus WordHashTable_add_word(WordHashTable* whtab, const WordBuffer* buf)
 	return GEN_FAIL;
 }
 
+RetStatus WordHashTable_add_word(WordHashTable* whtab, const WordBuffer* buf)
+{
+	return WordHashTable_add_word_count(whtab, buf, 1);
+}
+
+RetStatus WordHashTable_add_word_count(WordHashTable* whtab, const WordBuffer* buf,
+		const size_t count)
+{
+	size_t index;
+	return WordHashTable_add_entry(whtab, buf, count, &index);
+}
+
+/**
+ * @brief Decreases the counter of an entry, turning it into a tombstone
+ * once it reaches 0.
+ *
+ * @param[in, out]	whtab		Pointer to the Hash table.
+ * @param[in]		curIndex	The index of the entry.
+ * @param[in]		count		The number of occurrences to be removed.
+ * @return	Returns the status of the routine.
+ */
+static RetStatus entry_decrement(WordHashTable *whtab, const size_t curIndex,
+		const size_t count)
+{
+	WordHashTabEntry* curEntry = &(whtab->entries[curIndex]);
+	if(curEntry->count < count)
+	{
+		fprintf(stderr, "Failed to remove %ld occurrences of word '%s' "
+				"counted %ld times.\n", count, curEntry->letters, curEntry->count);
+		return GEN_FAIL;
+	}
+
+	curEntry->count -= count;
+	if(curEntry->count == 0) whtab->numTombstones++;
+	/// The maximum count may now belong to any other word.
+	whtab->pfstatsStale = true;
+
+	return SUCCESS;
+}
+
+RetStatus WordHashTable_remove_word_count(WordHashTable* whtab, const WordBuffer* buf,
+		const size_t count)
+{
+	const int64_t index = entry_find(whtab, buf->letters, buf->curPosition + 1);
+	if(index < 0)
+	{
+		fprintf(stderr, "Failed to remove word '%s' missing from the table.\n",
+				buf->letters);
+		return GEN_FAIL;
+	}
+
+	return entry_decrement(whtab, (size_t)index, count);
+}
+
+RetStatus WordHashTable_remove_ref(WordHashTable* whtab, const size_t ref)
+{
+	const char *letters = whtab->stringsPool.memSpace + ref;
+	const int64_t index = entry_find(whtab, letters, (uint32_t)strlen(letters) + 1);
+	if(index < 0)
+	{
+		fprintf(stderr, "Failed to remove word '%s' missing from the table.\n",
+				letters);
+		return GEN_FAIL;
+	}
+
+	return entry_decrement(whtab, (size_t)index, 1);
+}
+
 bool WordHashTable_size_below(const WordHashTable* whtab, const uint32_t limitPrc)
 {
 	return (whtab->size < whtab->capacity * limitPrc / 100);
 }
 
+bool WordHashTable_pool_waste_above(const WordHashTable* whtab, const uint32_t limitPrc)
+{
+	return (whtab->deadChars * 100 > whtab->stringsPool.nextChar * limitPrc);
+}
+
+static RetStatus WordHashTable_rebuild(WordHashTable* whtab, const size_t newCapacity);
+
+/**
+ * @brief Adds the occurrences of a word to the Hash table, expanding the table
+ * and its strings pool as needed, and provides the index of its entry.
+ *
+ * @param[in, out]	whtab	Pointer to the Hash table.
+ * @param[in]		buf		The Word Buffer of the word to be added.
+ * @param[in]		count	The number of occurrences to be added.
+ * @param[out]		ref		Pointer to the offset of the word's string in the pool.
+ * @param[out]		id		Pointer to the id of the word.
+ * @return	Returns the status of the routine.
+ */
+static RetStatus WordHashTable_count_entry(WordHashTable* whtab, const WordBuffer* buf,
+		const size_t count, size_t *ref, uint32_t *id)
+{
+	RetStatus rst = SUCCESS;
+	size_t index = 0;
+	/// The memory pool used by the Table to allocate new strings,
+	/// keeps expanding if the insertion process failed due to
+	/// limited pool space.
+	while((rst = WordHashTable_add_entry(whtab, buf, count, &index)) == DATA_STRUCT_FULL)
+	{
+		if(WordHashTable_MemoryPool_expand(whtab) != SUCCESS)
+		{
+			fprintf(stderr, "Hash Table's String Pool is out of memory.\n");
+			return GEN_FAIL;
+		}
+	}
+	if(rst != SUCCESS) return rst;
+	/// Offsets in the pool are not affected by the rehashing below.
+	*ref = (size_t)(whtab->entries[index].letters - whtab->stringsPool.memSpace);
+	*id = whtab->entries[index].id;
+
+	/// If the Hash table reaches an occupancy percentage of at least 70%,
+	/// the table expands to avoid an increased collision rate
+	/// slowing down the insertions. If at least half of the occupied
+	/// entries are tombstones, they are purged instead.
+	if(!WordHashTable_size_below(whtab, 70))
+	{
+		const RetStatus est = ((whtab->numTombstones > 0) &&
+				(whtab->numTombstones >= whtab->size / 2))
+				? WordHashTable_rebuild(whtab, whtab->capacity)
+				: WordHashTable_expand(whtab);
+		if(est != SUCCESS)
+		{
+			fprintf(stderr, "Hash Table Expansion failed!\n");
+			return GEN_FAIL;
+		}
+	}
+
+	return SUCCESS;
+}
+
+RetStatus WordHashTable_count_word(WordHashTable* whtab, const WordBuffer* buf,
+		const size_t count)
+{
+	size_t ref;
+	uint32_t id;
+	return WordHashTable_count_entry(whtab, buf, count, &ref, &id);
+}
+
+RetStatus WordHashTable_count_word_ref(WordHashTable* whtab, const WordBuffer* buf,
+		size_t *ref)
+{
+	uint32_t id;
+	return WordHashTable_count_entry(whtab, buf, 1, ref, &id);
+}
+
+RetStatus WordHashTable_count_word_id(WordHashTable* whtab, const WordBuffer* buf,
+		uint32_t *id)
+{
+	size_t ref;
+	return WordHashTable_count_entry(whtab, buf, 1, &ref, id);
+}
+
+uint32_t WordHashTable_num_ids(const WordHashTable* whtab)
+{
+	return whtab->numIds;
+}
+
+const char* WordHashTable_id_word(const WordHashTable* whtab, const uint32_t id,
+		size_t *count)
+{
+	if((id >= whtab->numIds) || (whtab->idIndices[id] == ID_RETIRED)) return NULL;
+
+	const WordHashTabEntry* curEntry = &(whtab->entries[whtab->idIndices[id]]);
+	*count = curEntry->count;
+	return curEntry->letters;
+}
+
+const char* WordHashTable_ref_word(const WordHashTable* whtab, const size_t ref)
+{
+	return whtab->stringsPool.memSpace + ref;
+}
+
+size_t WordHashTable_get_size(const WordHashTable* whtab)
+{
+	return whtab->size;
+}
+
+const char* WordHashTable_order_word(const WordHashTable* whtab, const size_t pos,
+		uint32_t *length, size_t *count)
+{
+	const WordHashTabEntry* curEntry = &(whtab->entries[whtab->alphOrderArray[pos]]);
+	*count = curEntry->count;
+	if(curEntry->count == 0) return NULL;
+	*length = curEntry->length - 1;
+	return curEntry->letters;
+}
+
+RetStatus WordHashTable_merge(WordHashTable* dst, const WordHashTable* src)
+{
+	/// Iterating in alphabetical order keeps the insertions to the
+	/// order array of an empty destination table at its end.
+	for(size_t i = 0; i < src->size; i++)
+	{
+		const WordHashTabEntry* srcEntry = &(src->entries[src->alphOrderArray[i]]);
+		if(srcEntry->count == 0) continue;
+		/// The entry's string is wrapped in a Word Buffer without copying it.
+		const WordBuffer wbuf = {srcEntry->letters, srcEntry->length - 1,
+				srcEntry->length};
+		if(WordHashTable_count_word(dst, &wbuf, srcEntry->count) != SUCCESS)
+		{
+			fprintf(stderr, "Failed to merge word '%s' in the table.\n",
+					srcEntry->letters);
+			return GEN_FAIL;
+		}
+	}
+
+	return SUCCESS;
+}
+
 /**
  * @brief Updates the string pointers of the Hash Table, possibly moved
  * by a pool expansion.
@@ -792,6 +1195,8 @@ RetStatus WordHashTable_MemoryPool_expand(WordHashTable* whtab)
 
 /**
  * @brief Rehashes the entries of the old Hash Table to the expanded one.
+ * @details Tombstones are dropped, leaving their strings unreferenced
+ * in the pool.
  *
  * @param[in, out]	whtab			Pointer to the Hash table.
  * @param[in, out]	extEntTab		Pointer to the extended array of entries.
@@ -799,12 +1204,18 @@ RetStatus WordHashTable_MemoryPool_expand(WordHashTable* whtab)
  */
 static void WordHashTable_migrate(WordHashTable* whtab, WordHashTabEntry* extEntTab)
 {
-	WordHashTabEntry* curEntry = NULL;
+	size_t liveSize = 0;
 	for(size_t i = 0; i < whtab->size; i++)
 	{
 		/// Only the indices stored in the Order Array are valid.
 		size_t oldIndex = whtab->alphOrderArray[i];
-		WordHashTabEntry* oldEntry = &(whtab->entries[whtab->alphOrderArray[i]]);
+		WordHashTabEntry* oldEntry = &(whtab->entries[oldIndex]);
+		if(oldEntry->count == 0)
+		{
+			whtab->deadChars += oldEntry->length;
+			whtab->idIndices[oldEntry->id] = ID_RETIRED;
+			continue;
+		}
 
 		const int64_t hashIndex =
 			(int64_t) (fnvhash((uint8_t*) oldEntry->letters, oldEntry->length) % whtab->capacity);
@@ -817,91 +1228,42 @@ static void WordHashTable_migrate(WordHashTable* whtab, WordHashTabEntry* extEnt
 		do
 		{
 			size_t curIndex =(size_t)(hashIndex + newDispl);
-			if(curIndex < whtab->capacity)
+			WordHashTabEntry* curEntry = &(extEntTab[curIndex]);
+			if(curEntry->letters == NULL)
 			{
-				curEntry = &(extEntTab[curIndex]);
-				if(curEntry->count == 0)
+				*curEntry = *oldEntry;
+				curEntry->displacement = newDispl;
+
+				/// The order does not change when rehashing,
+				/// so the old index is replaced with the
+				/// rehashed one on the order array.
+				whtab->alphOrderArray[liveSize] = curIndex;
+				whtab->idIndices[curEntry->id] = curIndex;
+
+				/// If the word is the one with the max occurencies
+				/// or count, the print format stats should be updated
+				/// as well.
+				if(oldIndex == whtab->pfstats.maxCountWordIndex)
 				{
-					curEntry->letters = oldEntry->letters;
-					curEntry->length = oldEntry->length;
-					curEntry->count = oldEntry->count;
-					curEntry->displacement = newDispl;
-
-					/// The order does not change when rehashing,
-					/// so the old index is replaced with the
-					/// rehashed one on the order array.
-					whtab->alphOrderArray[i] = curIndex;
-
-					/// If the word is the one with the max occurencies
-					/// or count, the print format stats should be updated
-					/// as well.
-					if(oldIndex == whtab->pfstats.maxCountWordIndex)
-					{
-						whtab->pfstats.maxCountWordIndex = curIndex;
-					}
-
-					if(oldIndex == whtab->pfstats.maxLengthWordIndex)
-					{
-						whtab->pfstats.maxLengthWordIndex = curIndex;
-					}
-
-					/// Insertions and Collisions are counted for the rehashing
-					/// process as well.
-					whtab->hstats.totalInsertions++;
-					if(newDispl>0) whtab->hstats.totalCollisions +=
-							(uint64_t)newDispl;
-#ifdef _DEBUG
-					st = SUCCESS;
-#endif //_DEBUG
-					break;
+					whtab->pfstats.maxCountWordIndex = curIndex;
 				}
-			}
-
-			if((hashIndex >= newDispl) &&(newDispl > 0))
-			{
-				curIndex =(size_t)(hashIndex - newDispl);
-				curEntry = &(extEntTab[curIndex]);
 
-				if(curEntry->count == 0)
+				if(oldIndex == whtab->pfstats.maxLengthWordIndex)
 				{
-					curEntry->letters = oldEntry->letters;
-					curEntry->length = oldEntry->length;
-					curEntry->count = oldEntry->count;
-					curEntry->displacement = -newDispl;
-
-					/// The order does not change when rehashing,
-					/// so the old index is replaced with the
-					/// rehashed one on the order array.
-					whtab->alphOrderArray[i] = curIndex;
-
-					/// If the word is the one with the max occurencies
-					/// or count, the print format stats should be updated
-					/// as well.
-					if(oldIndex == whtab->pfstats.maxCountWordIndex)
-					{
-						whtab->pfstats.maxCountWordIndex = curIndex;
-					}
-
-					if(oldIndex == whtab->pfstats.maxLengthWordIndex)
-					{
-						whtab->pfstats.maxLengthWordIndex = curIndex;
-					}
-
-					/// Insertions and Collisions are counted for the rehashing
-					/// process as well.
-					whtab->hstats.totalInsertions++;
-					if(newDispl > 0) whtab->hstats.totalCollisions +=
-							(uint64_t)newDispl;
+					whtab->pfstats.maxLengthWordIndex = curIndex;
+				}
 
+				/// Insertions and Collisions are counted for the rehashing
+				/// process as well.
+				whtab->hstats.totalInsertions++;
+				if(newDispl != 0) whtab->hstats.totalCollisions +=
+						(uint64_t)abs(newDispl);
 #ifdef _DEBUG
-					st = SUCCESS;
+				st = SUCCESS;
 #endif //_DEBUG
-					break;
-				}
+				break;
 			}
-			newDispl++;
-
-		} while(((size_t)(hashIndex + newDispl) < whtab->capacity) || (hashIndex >= newDispl));
+		} while(probe_next(hashIndex, whtab->capacity, &newDispl));
 
 #ifdef _DEBUG
 		if(st != SUCCESS)
@@ -912,20 +1274,25 @@ static void WordHashTable_migrate(WordHashTable* whtab, WordHashTabEntry* extEnt
 			break;
 		}
 #endif //_DEBUG
+		liveSize++;
 	}
 
-	return;
-
+	whtab->size = liveSize;
+	whtab->numTombstones = 0;
 }
 
-RetStatus WordHashTable_expand(WordHashTable* whtab)
+/**
+ * @brief Rehashes the entries of the Hash Table to a new array of entries
+ * with the specified capacity, dropping any tombstones.
+ *
+ * @param[in, out]	whtab		Pointer to the Hash table.
+ * @param[in]		newCapacity	The capacity of the new array of entries.
+ * @return	Returns the status of the routine.
+ */
+static RetStatus WordHashTable_rebuild(WordHashTable* whtab, const size_t newCapacity)
 {
-	WordHashTabEntry* extEntries = NULL;
-	size_t* extOutOrder = NULL;
-
-	const size_t newCapacity = whtab->capacity * 2;
-
-	extEntries = (WordHashTabEntry*) calloc(newCapacity, sizeof(WordHashTabEntry));
+	WordHashTabEntry* extEntries =
+			(WordHashTabEntry*) calloc(newCapacity, sizeof(WordHashTabEntry));
 	if(extEntries == NULL)
 	{
 		fprintf(stderr, "Failed to expand Word Hash Table Entries' "
@@ -933,18 +1300,29 @@ RetStatus WordHashTable_expand(WordHashTable* whtab)
 		return GEN_FAIL;
 	}
 
-	extOutOrder = realloc(whtab->alphOrderArray, newCapacity * sizeof(size_t));
-	if(extOutOrder == NULL)
+	if(newCapacity > whtab->capacity)
 	{
-		fprintf(stderr, "Failed to expand print table "
-				"for %ld words\n", newCapacity);
-		free(extEntries);
-		return GEN_FAIL;
+		size_t* extOutOrder = realloc(whtab->alphOrderArray, newCapacity * sizeof(size_t));
+		if(extOutOrder == NULL)
+		{
+			fprintf(stderr, "Failed to expand print table "
+					"for %ld words\n", newCapacity);
+			free(extEntries);
+			return GEN_FAIL;
+		}
+		whtab->alphOrderArray = extOutOrder;
 	}
 
 	whtab->capacity = newCapacity;
-	whtab->alphOrderArray = extOutOrder;
+	WordHashTable_migrate(whtab, extEntries);
+	free(whtab->entries);
+	whtab->entries = extEntries;
+
+	return SUCCESS;
+}
 
+RetStatus WordHashTable_expand(WordHashTable* whtab)
+{
 	/// If the size of the pool approaches its capacity,
 	/// it is expanded as well.
 	if(!MemoryPool_size_below(&(whtab->stringsPool), 80))
@@ -952,7 +1330,6 @@ RetStatus WordHashTable_expand(WordHashTable* whtab)
 		if(WordHashTable_MemoryPool_expand(whtab) != SUCCESS)
 		{
 			fprintf(stderr, "Failed to expand Hash table's string pool");
-			free(extEntries);
 			return GEN_FAIL;
 		}
 #ifdef _DEBUG
@@ -960,9 +1337,7 @@ RetStatus WordHashTable_expand(WordHashTable* whtab)
 #endif //_DEBUG
 	}
 
-	WordHashTable_migrate(whtab, extEntries);
-	free(whtab->entries);
-	whtab->entries = extEntries;
+	if(WordHashTable_rebuild(whtab, whtab->capacity * 2) != SUCCESS) return GEN_FAIL;
 
 #ifdef _DEBUG
 	printf("Table expansion from %ld to %ld entries. Current size: %ld.\n",
@@ -972,62 +1347,165 @@ RetStatus WordHashTable_expand(WordHashTable* whtab)
 	return SUCCESS;
 }
 
-/**
- * @brief Computes the number of digits of a decimal number.
- * @details Computes the number of characters needed to represent a decimal
- * number in a string.
- *
- * @param[in]	num	The decimal number.
- * @return	The number of digits
- */
-static inline uint32_t num_of_digits(const size_t num)
+RetStatus WordHashTable_compact(WordHashTable* whtab, size_t* refs, const size_t numRefs)
 {
-	return(uint32_t)snprintf(NULL, 0, "%ld", num);
+	/// Tombstones are purged first, so that only the strings
+	/// of the remaining entries are copied.
+	if(WordHashTable_rebuild(whtab, whtab->capacity) != SUCCESS) return GEN_FAIL;
+
+	size_t liveChars = 0;
+	for(size_t i = 0; i < whtab->size; i++)
+	{
+		liveChars += whtab->entries[whtab->alphOrderArray[i]].length;
+	}
+
+	/// The compacted pool keeps the proportion of a newly created table
+	/// and some space for new words.
+	MemoryPool compPool;
+	const size_t poolCapacity = (6 * whtab->capacity > 2 * liveChars)
+			? 6 * whtab->capacity : 2 * liveChars;
+	if(MemoryPool_init(&compPool, poolCapacity) != SUCCESS)
+	{
+		fprintf(stderr, "Failed to allocate the compacted strings pool\n");
+		return GEN_FAIL;
+	}
+
+	for(size_t i = 0; i < whtab->size; i++)
+	{
+		WordHashTabEntry* curEntry = &(whtab->entries[whtab->alphOrderArray[i]]);
+		char* letters = MemoryPool_alloc_block(&compPool, curEntry->length);
+		memcpy(letters, curEntry->letters, curEntry->length);
+		curEntry->letters = letters;
+	}
+
+	/// The references still point to the strings in the old pool,
+	/// which are looked up to find their new location.
+	MemoryPool oldPool = whtab->stringsPool;
+	whtab->stringsPool = compPool;
+	for(size_t i = 0; i < numRefs; i++)
+	{
+		const char* oldLetters = oldPool.memSpace + refs[i];
+		const int64_t index =
+				entry_find(whtab, oldLetters, (uint32_t)strlen(oldLetters) + 1);
+#ifdef _DEBUG
+		assert(index >= 0);
+#endif //_DEBUG
+		refs[i] = (size_t)(whtab->entries[index].letters - compPool.memSpace);
+	}
+	MemoryPool_free(&oldPool);
+	whtab->deadChars = 0;
+
+#ifdef _DEBUG
+	printf("Strings pool compacted from %ld to %ld characters.\n",
+			oldPool.nextChar, compPool.nextChar);
+#endif //_DEBUG
+
+	return SUCCESS;
 }
 
 /**
- * @brief Prints the specified number of dashes.
+ * @brief Provides the output format statistics of the table.
+ * @details If removals may have invalidated the statistics kept on insertions,
+ * they are computed again from the entries with a non-zero count.
  *
- * @param[in]	dashNum	The number of dashes to be printed.
- * @return	Void
+ * @param[in]	whtab	Pointer to the table.
+ * @return	The output format statistics.
  */
-static inline void print_dash_line(const uint32_t dashNum)
+static PrintFormatStats pfstats_get(const WordHashTable* whtab)
 {
-	for(uint32_t i = 0; i < dashNum; i++)
-		printf("%c", '-');
-	printf("\n");
+	if(!whtab->pfstatsStale) return whtab->pfstats;
+
+	PrintFormatStats pfstats = {0};
+	bool first = true;
+	for(size_t i = 0; i < whtab->size; i++)
+	{
+		const size_t curIndex = whtab->alphOrderArray[i];
+		const WordHashTabEntry* curEntry = &(whtab->entries[curIndex]);
+		if(curEntry->count == 0) continue;
+		if(first || (curEntry->length > whtab->entries[pfstats.maxLengthWordIndex].length))
+			pfstats.maxLengthWordIndex = curIndex;
+		if(first || (curEntry->count > whtab->entries[pfstats.maxCountWordIndex].count))
+			pfstats.maxCountWordIndex = curIndex;
+		first = false;
+	}
+
+	return pfstats;
 }
 
-void WordHashTable_count_print(const WordHashTable* whtab)
+RetStatus CountTable_print(const char *item, const char *heading, const uint32_t maxLength,
+		const size_t maxCount, CountTableNext next, void *iter)
 {
-	if(whtab->size == 0) return;
+	const int maxWordLength = (int)maxLength + 1;
+	const int maxDigitsCount = (int)num_of_digits(maxCount);
 
-	const uint32_t maxWordLength =
-			whtab->entries[whtab->pfstats.maxLengthWordIndex].length;
-	const uint32_t maxDigitsCount =
-			num_of_digits(whtab->entries[whtab->pfstats.maxCountWordIndex].count);
-
-	printf("Number of appearances of each word:\n");
-	printf("    %-*s    %s\n", maxWordLength, "Word", "Count");
+	printf("Number of appearances of each %s:\n", item);
+	printf("    %-*s    %s\n", maxWordLength, heading, "Count");
 
 	const uint32_t numOfDashes =
 		(uint32_t)snprintf(NULL, 0, "    %-*s    %s\n",
-				maxWordLength, "Word", "Count") + 3;
+				maxWordLength, heading, "Count") + 3;
 	print_dash_line(numOfDashes);
 
-	for(size_t i = 0; i < whtab->size; i++)
+	const char *word = NULL;
+	uint32_t length = 0;
+	size_t count = 0;
+	for(;;)
 	{
-		WordHashTabEntry* curEntry =
-				&(whtab->entries[whtab->alphOrderArray[i]]);
-		printf("    %-*s    %*ld\n",
-				maxWordLength, curEntry->letters, maxDigitsCount, curEntry->count);
+		if(next(iter, &word, &length, &count) != SUCCESS) return GEN_FAIL;
+		if(word == NULL) break;
+		/// The words need not be null terminated, so they are padded separately,
+		/// by their code points to line up the columns on the terminal.
+		printf("    %.*s%*s    %*ld\n", (int)length, word,
+				maxWordLength - (int)utf8_length((const uint8_t*)word, length), "",
+				maxDigitsCount, count);
 	}
 	print_dash_line(numOfDashes);
 
+	return SUCCESS;
+}
+
+/// @brief The state of an iteration over the words of a Hash table.
+typedef struct
+{
+	/// Pointer to the table.
+	const WordHashTable *whtab;
+	/// The next position of the alphabetical order.
+	size_t pos;
+}WordHashTableIter;
+
+/**
+ * @brief Gets the next word of a Hash table in alphabetical order.
+ *
+ * @param[in, out]	iter	Pointer to the state of the iteration.
+ * @param[out]		word	Pointer to the string of the word, or NULL past the last word.
+ * @param[out]		length	Pointer to the length of the word.
+ * @param[out]		count	Pointer to the count of the word.
+ * @return	Returns the status of the routine.
+ */
+static RetStatus table_next(void *iter, const char **word, uint32_t *length, size_t *count)
+{
+	WordHashTableIter *it = (WordHashTableIter*)iter;
+	*word = NULL;
+	/// Tombstones are not printed.
+	while((*word == NULL) && (it->pos < it->whtab->size))
+		*word = WordHashTable_order_word(it->whtab, it->pos++, length, count);
+
+	return SUCCESS;
+}
+
+void WordHashTable_count_print(const WordHashTable* whtab)
+{
+	if(whtab->size == whtab->numTombstones) return;
+
+	const PrintFormatStats pfstats = pfstats_get(whtab);
+	WordHashTableIter iter = {whtab, 0};
+	CountTable_print("word", "Word", whtab->entries[pfstats.maxLengthWordIndex].length - 1,
+			whtab->entries[pfstats.maxCountWordIndex].count, table_next, &iter);
+
 #ifdef _STATS
 	printf("Most common word: \"%s\", appearing %ld time(s)",
-		whtab->entries[whtab->pfstats.maxCountWordIndex].letters,
-		whtab->entries[whtab->pfstats.maxCountWordIndex].count);
+		whtab->entries[pfstats.maxCountWordIndex].letters,
+		whtab->entries[pfstats.maxCountWordIndex].count);
 #endif //_STATS
 }
 
@@ -1096,11 +1574,29 @@ void WordHashTable_hstats_print(const WordHashTable* whtab)
 		whtab->hstats.meanDisplacement, whtab->hstats.medianDisplacement);
 }
 
+void WordHashTable_clear(WordHashTable *whtab)
+{
+	/// Every entry in use, tombstones included, is listed in the order array.
+	for(size_t i = 0; i < whtab->size; i++)
+	{
+		memset(&(whtab->entries[whtab->alphOrderArray[i]]), 0, sizeof(WordHashTabEntry));
+	}
+
+	whtab->size = 0;
+	whtab->numTombstones = 0;
+	whtab->deadChars = 0;
+	whtab->stringsPool.nextChar = 0;
+	whtab->pfstats = (PrintFormatStats) {0};
+	whtab->pfstatsStale = false;
+	whtab->numIds = 0;
+}
+
 void WordHashTable_free(WordHashTable* whtab)
 {
 	MemoryPool_free(&(whtab->stringsPool));
 	free(whtab->entries);
 	free(whtab->alphOrderArray);
+	free(whtab->idIndices);
 }
 
 void WordHashTable_destroy(WordHashTable **whtab)
@@ -0,0 +1,587 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "options.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/// Default number of words counted between two consecutive checkpoints.
+#define DEFAULT_CHECKPOINT_INTERVAL (1 << 26)
+
+/// Default smallest log ratio of the words printed by the comparison,
+/// that of a frequency doubled or halved.
+#define DEFAULT_DIFF_THRESHOLD 1.0
+
+/**
+ * @brief Parses a strictly positive decimal number.
+ *
+ * @param[in]	str	Pointer to the string of the number.
+ * @param[out]	num	Pointer to the number to be set.
+ * @return	Returns true if the string is a valid positive number.
+ */
+static bool parse_size(const char *str, size_t *num)
+{
+	char *end = NULL;
+	errno = 0;
+	const unsigned long long val = strtoull(str, &end, 10);
+	if((errno != 0) || (end == str) || (*end != '\0') || (val == 0)
+		|| (str[0] == '-')) return false;
+
+	*num = (size_t)val;
+	return true;
+}
+
+/**
+ * @brief Fetches the value of an option expecting one.
+ *
+ * @param[in]		argc	The number of command line arguments.
+ * @param[in]		argv	The array of command line arguments.
+ * @param[in, out]	i		Pointer to the index of the option, moved to its value.
+ * @param[out]		val		Pointer to the value to be set.
+ * @return	Returns true if the value is present.
+ */
+static bool option_value(const int argc, char *argv[], int *i, const char **val)
+{
+	if(*i + 1 >= argc)
+	{
+		fprintf(stderr, "Option %s expects a value.\n", argv[*i]);
+		return false;
+	}
+	(*i)++;
+	*val = argv[*i];
+	return true;
+}
+
+/**
+ * @brief Fetches the value of an option expecting a positive number.
+ *
+ * @param[in]		argc	The number of command line arguments.
+ * @param[in]		argv	The array of command line arguments.
+ * @param[in, out]	i		Pointer to the index of the option, moved to its value.
+ * @param[out]		num		Pointer to the number to be set.
+ * @return	Returns true if the value is a valid positive number.
+ */
+static bool option_size(const int argc, char *argv[], int *i, size_t *num)
+{
+	const char *val = NULL;
+	if(!option_value(argc, argv, i, &val)) return false;
+	if(!parse_size(val, num))
+	{
+		fprintf(stderr, "Invalid value for option %s: %s\n", argv[*i - 1], val);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Fetches the value of an option expecting a non-negative real number.
+ *
+ * @param[in]		argc	The number of command line arguments.
+ * @param[in]		argv	The array of command line arguments.
+ * @param[in, out]	i		Pointer to the index of the option, moved to its value.
+ * @param[out]		num		Pointer to the number to be set.
+ * @return	Returns true if the value is a valid non-negative number.
+ */
+static bool option_real(const int argc, char *argv[], int *i, double *num)
+{
+	const char *val = NULL;
+	if(!option_value(argc, argv, i, &val)) return false;
+	char *end = NULL;
+	errno = 0;
+	const double real = strtod(val, &end);
+	/// NaN fails the comparison, infinity the bound.
+	if((errno != 0) || (end == val) || (*end != '\0') || !(real >= 0.0) || (real > 1e300))
+	{
+		fprintf(stderr, "Invalid value for option %s: %s\n", argv[*i - 1], val);
+		return false;
+	}
+	*num = real;
+	return true;
+}
+
+/**
+ * @brief Fetches the value of an option expecting a time bucket length.
+ *
+ * @param[in]		argc	The number of command line arguments.
+ * @param[in]		argv	The array of command line arguments.
+ * @param[in, out]	i		Pointer to the index of the option, moved to its value.
+ * @param[out]		seconds	Pointer to the length in seconds to be set.
+ * @return	Returns true if the value is one of "minute", "hour" or "day".
+ */
+static bool option_period(const int argc, char *argv[], int *i, size_t *seconds)
+{
+	static const char *names[] = {"minute", "hour", "day"};
+	static const size_t lengths[] = {60, 3600, 86400};
+
+	const char *val = NULL;
+	if(!option_value(argc, argv, i, &val)) return false;
+	for(size_t p = 0; p < sizeof(lengths) / sizeof(lengths[0]); p++)
+	{
+		if(strcmp(val, names[p]) == 0)
+		{
+			*seconds = lengths[p];
+			return true;
+		}
+	}
+	fprintf(stderr, "Invalid value for option %s: %s\n", argv[*i - 1], val);
+	return false;
+}
+
+/**
+ * @brief Fetches the value of an option expecting instruction set extensions.
+ *
+ * @param[in]		argc	The number of command line arguments.
+ * @param[in]		argv	The array of command line arguments.
+ * @param[in, out]	i		Pointer to the index of the option, moved to its value.
+ * @param[out]		isa		Pointer to the extensions to be set.
+ * @return	Returns true if the value is one of "scalar", "sse2", "avx2" or "avx512bw".
+ */
+static bool option_isa(const int argc, char *argv[], int *i, CpuIsa *isa)
+{
+	const char *val = NULL;
+	if(!option_value(argc, argv, i, &val)) return false;
+	if(CpuIsa_parse(val, isa)) return true;
+	fprintf(stderr, "Invalid value for option %s: %s\n", argv[*i - 1], val);
+	return false;
+}
+
+bool ProgramOptions_parse(ProgramOptions *opts, const int argc, char *argv[])
+{
+	ProgramOptions newOpts = {0};
+	newOpts.checkpointInterval = DEFAULT_CHECKPOINT_INTERVAL;
+	newOpts.diffThreshold = DEFAULT_DIFF_THRESHOLD;
+	newOpts.inputPaths = (const char**) calloc((size_t)argc, sizeof(char*));
+	if(newOpts.inputPaths == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the array of input paths.\n");
+		return false;
+	}
+
+	/// The subcommand compiling a vocabulary only takes the token rules
+	/// along with its two paths, the one querying an FST only its query
+	/// and the one comparing counts only its threshold.
+	int first = 1;
+	if((argc > 1) && (strcmp(argv[1], "compile-vocab") == 0))
+	{
+		newOpts.compileVocab = true;
+		first = 2;
+	}
+	else if((argc > 1) && (strcmp(argv[1], "query-fst") == 0))
+	{
+		newOpts.queryFst = true;
+		first = 2;
+	}
+	else if((argc > 1) && (strcmp(argv[1], "diff") == 0))
+	{
+		newOpts.diff = true;
+		first = 2;
+	}
+	bool hasThreshold = false;
+
+	bool valid = true;
+	for(int i = first; valid && (i < argc); i++)
+	{
+		if(strcmp(argv[i], "--checkpoint") == 0)
+		{
+			valid = option_value(argc, argv, &i, &newOpts.checkpointPath);
+		}
+		else if(strcmp(argv[i], "--checkpoint-interval") == 0)
+		{
+			valid = option_size(argc, argv, &i, &newOpts.checkpointInterval);
+		}
+		else if(strcmp(argv[i], "--cache-dir") == 0)
+		{
+			valid = option_value(argc, argv, &i, &newOpts.cacheDir);
+		}
+		else if(strcmp(argv[i], "--window-words") == 0)
+		{
+			valid = option_size(argc, argv, &i, &newOpts.windowWords);
+		}
+		else if(strcmp(argv[i], "--window-seconds") == 0)
+		{
+			valid = option_size(argc, argv, &i, &newOpts.windowSeconds);
+		}
+		else if(strcmp(argv[i], "--window-report") == 0)
+		{
+			valid = option_size(argc, argv, &i, &newOpts.windowReport);
+		}
+		else if(strcmp(argv[i], "--time-buckets") == 0)
+		{
+			valid = option_period(argc, argv, &i, &newOpts.bucketSeconds);
+		}
+		else if(strcmp(argv[i], "--top") == 0)
+		{
+			valid = option_size(argc, argv, &i, &newOpts.topWords);
+		}
+		else if(strcmp(argv[i], "--token-ids") == 0)
+		{
+			valid = option_value(argc, argv, &i, &newOpts.tokenIdsPath);
+		}
+		else if(strcmp(argv[i], "--word-chars") == 0)
+		{
+			valid = option_value(argc, argv, &i, &newOpts.wordChars);
+		}
+		else if(strcmp(argv[i], "--inword-symbols") == 0)
+		{
+			valid = option_value(argc, argv, &i, &newOpts.inwordSymbols);
+		}
+		else if(strcmp(argv[i], "--token-regex") == 0)
+		{
+			valid = option_value(argc, argv, &i, &newOpts.tokenRegex);
+		}
+		else if(strcmp(argv[i], "--case-sensitive") == 0)
+		{
+			newOpts.caseSensitive = true;
+		}
+		else if(strcmp(argv[i], "--strip-markup") == 0)
+		{
+			newOpts.stripMarkup = true;
+		}
+		else if(strcmp(argv[i], "--stopwords") == 0)
+		{
+			valid = option_value(argc, argv, &i, &newOpts.stopwordsPath);
+		}
+		else if(strcmp(argv[i], "--stem") == 0)
+		{
+			newOpts.stem = true;
+		}
+		else if(strcmp(argv[i], "--dedup-lines") == 0)
+		{
+			newOpts.dedupLines = true;
+		}
+		else if(strcmp(argv[i], "--max-token-length") == 0)
+		{
+			valid = option_size(argc, argv, &i, &newOpts.maxTokenLength);
+		}
+		else if(strcmp(argv[i], "--radix-tree") == 0)
+		{
+			newOpts.radixTree = true;
+		}
+		else if(strcmp(argv[i], "--vocab") == 0)
+		{
+			valid = option_value(argc, argv, &i, &newOpts.vocabPath);
+		}
+		else if(strcmp(argv[i], "--rollup") == 0)
+		{
+			valid = option_value(argc, argv, &i, &newOpts.rollupSeparators);
+		}
+		else if(strcmp(argv[i], "--export-fst") == 0)
+		{
+			valid = option_value(argc, argv, &i, &newOpts.fstPath);
+		}
+		else if(strcmp(argv[i], "--manifest") == 0)
+		{
+			valid = option_value(argc, argv, &i, &newOpts.manifestPath);
+			newOpts.manifestNul = false;
+		}
+		else if(strcmp(argv[i], "--manifest0") == 0)
+		{
+			valid = option_value(argc, argv, &i, &newOpts.manifestPath);
+			newOpts.manifestNul = true;
+		}
+		else if(strcmp(argv[i], "--force-isa") == 0)
+		{
+			valid = option_isa(argc, argv, &i, &newOpts.forcedIsa);
+			newOpts.isaForced = true;
+		}
+		else if(strcmp(argv[i], "--prefix") == 0)
+		{
+			valid = option_value(argc, argv, &i, &newOpts.queryPrefix);
+		}
+		else if(strcmp(argv[i], "--threshold") == 0)
+		{
+			valid = option_real(argc, argv, &i, &newOpts.diffThreshold);
+			hasThreshold = true;
+		}
+		else if(strcmp(argv[i], "--range") == 0)
+		{
+			valid = option_value(argc, argv, &i, &newOpts.rangeFrom) &&
+					option_value(argc, argv, &i, &newOpts.rangeTo);
+		}
+		else if((strncmp(argv[i], "--", 2) == 0) && (argv[i][2] != '\0'))
+		{
+			fprintf(stderr, "Unknown option: %s\n", argv[i]);
+			valid = false;
+		}
+		/// Any other argument is the name of an input text file.
+		else newOpts.inputPaths[newOpts.numInputs++] = argv[i];
+	}
+
+	/// Resuming requires seeking back into a single input.
+	if(valid && (newOpts.checkpointPath != NULL) && (newOpts.numInputs != 1))
+	{
+		fprintf(stderr, "Checkpointing requires a single input file.\n");
+		valid = false;
+	}
+	/// The standard input can not be identified on later runs.
+	if(valid && (newOpts.cacheDir != NULL) && (newOpts.numInputs == 0) &&
+		(newOpts.manifestPath == NULL))
+	{
+		fprintf(stderr, "Caching requires input files.\n");
+		valid = false;
+	}
+	/// The counts of a window are not those of whole files.
+	const bool windowed = (newOpts.windowWords != 0) || (newOpts.windowSeconds != 0);
+	if(valid && windowed &&
+		((newOpts.checkpointPath != NULL) || (newOpts.cacheDir != NULL)))
+	{
+		fprintf(stderr, "Sliding windows can not be combined "
+				"with checkpoints or caching.\n");
+		valid = false;
+	}
+	if(valid && !windowed && (newOpts.windowReport != 0))
+	{
+		fprintf(stderr, "Window reports require a sliding window.\n");
+		valid = false;
+	}
+	/// Bucketed counts are kept apart from the table saved by the other modes.
+	if(valid && (newOpts.bucketSeconds != 0) && (windowed ||
+		(newOpts.checkpointPath != NULL) || (newOpts.cacheDir != NULL)))
+	{
+		fprintf(stderr, "Time buckets can not be combined with sliding windows, "
+				"checkpoints or caching.\n");
+		valid = false;
+	}
+	if(valid && (newOpts.bucketSeconds == 0) && (newOpts.topWords != 0))
+	{
+		fprintf(stderr, "Printing the most common words requires time buckets.\n");
+		valid = false;
+	}
+	/// The stream follows the input from its start in a single pass.
+	if(valid && (newOpts.tokenIdsPath != NULL) && (windowed ||
+		(newOpts.bucketSeconds != 0) || (newOpts.checkpointPath != NULL) ||
+		(newOpts.cacheDir != NULL)))
+	{
+		fprintf(stderr, "Token id streams can not be combined with sliding windows, "
+				"time buckets, checkpoints or caching.\n");
+		valid = false;
+	}
+	/// The expression replaces the character types altogether.
+	if(valid && (newOpts.tokenRegex != NULL) &&
+		((newOpts.wordChars != NULL) || (newOpts.inwordSymbols != NULL)))
+	{
+		fprintf(stderr, "Token regexes can not be combined with word characters "
+				"or in word symbols.\n");
+		valid = false;
+	}
+	/// Repeated lines are counted out of the order of the input,
+	/// and each of them apart from the lines around it.
+	if(valid && newOpts.dedupLines && (windowed || (newOpts.bucketSeconds != 0) ||
+		(newOpts.tokenIdsPath != NULL) || newOpts.stripMarkup))
+	{
+		fprintf(stderr, "Line deduplication can not be combined with sliding windows, "
+				"time buckets, token id streams or markup stripping.\n");
+		valid = false;
+	}
+	/// The modes saving, removing or numbering the words rely on the hash table.
+	if(valid && newOpts.radixTree && (windowed || (newOpts.bucketSeconds != 0) ||
+		(newOpts.tokenIdsPath != NULL) || (newOpts.checkpointPath != NULL) ||
+		(newOpts.cacheDir != NULL)))
+	{
+		fprintf(stderr, "Radix trees can not be combined with sliding windows, "
+				"time buckets, token id streams, checkpoints or caching.\n");
+		valid = false;
+	}
+	/// The counts of the vocabulary are kept apart from the table.
+	if(valid && (newOpts.vocabPath != NULL) && (windowed || (newOpts.bucketSeconds != 0) ||
+		(newOpts.tokenIdsPath != NULL) || (newOpts.checkpointPath != NULL) ||
+		(newOpts.cacheDir != NULL) || newOpts.radixTree))
+	{
+		fprintf(stderr, "Vocabularies can not be combined with sliding windows, "
+				"time buckets, token id streams, checkpoints, caching or radix trees.\n");
+		valid = false;
+	}
+	if(valid && newOpts.compileVocab && (windowed || (newOpts.bucketSeconds != 0) ||
+		(newOpts.tokenIdsPath != NULL) || (newOpts.checkpointPath != NULL) ||
+		(newOpts.cacheDir != NULL) || newOpts.radixTree || (newOpts.vocabPath != NULL) ||
+		(newOpts.stopwordsPath != NULL) || newOpts.stem || newOpts.dedupLines))
+	{
+		fprintf(stderr, "compile-vocab only accepts the options of the token rules.\n");
+		valid = false;
+	}
+	/// The prefixes are rolled up over the words of a single, sorted table.
+	if(valid && (newOpts.rollupSeparators != NULL) && ((newOpts.bucketSeconds != 0) ||
+		newOpts.radixTree || (newOpts.vocabPath != NULL) || newOpts.compileVocab))
+	{
+		fprintf(stderr, "Prefix rollups can not be combined with time buckets, "
+				"radix trees, vocabularies or compile-vocab.\n");
+		valid = false;
+	}
+	if(valid && (newOpts.rollupSeparators != NULL) && (newOpts.rollupSeparators[0] == '\0'))
+	{
+		fprintf(stderr, "Prefix rollups expect at least one separator.\n");
+		valid = false;
+	}
+	/// The FST is built from the words of a single, sorted table.
+	if(valid && (newOpts.fstPath != NULL) && ((newOpts.bucketSeconds != 0) ||
+		newOpts.radixTree || (newOpts.vocabPath != NULL) || newOpts.compileVocab))
+	{
+		fprintf(stderr, "FST exports can not be combined with time buckets, "
+				"radix trees, vocabularies or compile-vocab.\n");
+		valid = false;
+	}
+	/// Each document is counted from its start into the emptied table
+	/// and printed on its own.
+	if(valid && (newOpts.manifestPath != NULL) && ((newOpts.numInputs != 0) || windowed ||
+		(newOpts.bucketSeconds != 0) || (newOpts.tokenIdsPath != NULL) ||
+		(newOpts.checkpointPath != NULL) || newOpts.radixTree ||
+		(newOpts.vocabPath != NULL) || (newOpts.fstPath != NULL) || newOpts.compileVocab))
+	{
+		fprintf(stderr, "Manifests can not be combined with input files, sliding windows, "
+				"time buckets, token id streams, checkpoints, radix trees, vocabularies, "
+				"FST exports or compile-vocab.\n");
+		valid = false;
+	}
+	const bool queried = (newOpts.queryPrefix != NULL) || (newOpts.rangeFrom != NULL);
+	if(valid && !newOpts.queryFst && queried)
+	{
+		fprintf(stderr, "Prefixes and ranges are only queried by query-fst.\n");
+		valid = false;
+	}
+	if(valid && (newOpts.queryPrefix != NULL) && (newOpts.rangeFrom != NULL))
+	{
+		fprintf(stderr, "query-fst accepts either a prefix or a range.\n");
+		valid = false;
+	}
+	/// The words of an FST are queried, and those of two sets of counts compared,
+	/// as they were counted, so the options splitting and counting them do not apply.
+	const bool counting = windowed || (newOpts.bucketSeconds != 0) ||
+		(newOpts.tokenIdsPath != NULL) || (newOpts.checkpointPath != NULL) ||
+		(newOpts.cacheDir != NULL) || newOpts.radixTree || (newOpts.vocabPath != NULL) ||
+		(newOpts.stopwordsPath != NULL) || newOpts.stem || newOpts.dedupLines ||
+		(newOpts.wordChars != NULL) || (newOpts.inwordSymbols != NULL) ||
+		(newOpts.tokenRegex != NULL) || newOpts.caseSensitive || newOpts.stripMarkup ||
+		(newOpts.maxTokenLength != 0) || (newOpts.fstPath != NULL) ||
+		(newOpts.rollupSeparators != NULL) || (newOpts.manifestPath != NULL) ||
+		newOpts.isaForced;
+	if(valid && newOpts.queryFst && (counting || hasThreshold))
+	{
+		fprintf(stderr, "query-fst only accepts --prefix or --range.\n");
+		valid = false;
+	}
+	if(valid && newOpts.diff && (counting || queried))
+	{
+		fprintf(stderr, "diff only accepts --threshold.\n");
+		valid = false;
+	}
+	if(valid && !newOpts.diff && hasThreshold)
+	{
+		fprintf(stderr, "Thresholds are only applied by diff.\n");
+		valid = false;
+	}
+	if(valid && newOpts.diff && (newOpts.numInputs != 2))
+	{
+		fprintf(stderr, "diff expects an old and a new counts file.\n");
+		valid = false;
+	}
+	if(valid && newOpts.queryFst && (newOpts.numInputs != 1))
+	{
+		fprintf(stderr, "query-fst expects a single FST file.\n");
+		valid = false;
+	}
+	if(valid && newOpts.compileVocab && (newOpts.numInputs != 2))
+	{
+		fprintf(stderr, "compile-vocab expects a vocabulary file and a compiled file.\n");
+		valid = false;
+	}
+	if(!valid)
+	{
+		ProgramOptions_free(&newOpts);
+		return false;
+	}
+
+	*opts = newOpts;
+
+	return true;
+}
+
+void ProgramOptions_print_usage(const char *progName)
+{
+	printf("Usage: %s [OPTIONS] [INFILE...]\n"
+			"       %s compile-vocab [TOKEN OPTIONS] VOCABFILE OUTFILE\n"
+			"       %s query-fst [--prefix PREFIX | --range FROM TO] FSTFILE\n"
+			"       %s diff [--threshold X] OLDFILE NEWFILE\n"
+			"Options:\n"
+			"  --checkpoint FILE           Periodically saves the progress to FILE\n"
+			"                              and resumes from it if it exists.\n"
+			"  --checkpoint-interval N     Counts at least N words between two\n"
+			"                              checkpoints (default %d).\n"
+			"  --cache-dir DIR             Caches the counts of each input file in DIR\n"
+			"                              and reuses them for unchanged files.\n"
+			"  --window-words N            Counts only the last N words of the input.\n"
+			"  --window-seconds N          Counts only the words read during the\n"
+			"                              last N seconds.\n"
+			"  --window-report N           Prints the counts of the window every\n"
+			"                              N words.\n"
+			"  --time-buckets UNIT         Counts the words of timestamped lines per\n"
+			"                              minute, hour or day.\n"
+			"  --top N                     Prints only the N most common words\n"
+			"                              of each time bucket.\n"
+			"  --token-ids FILE            Writes the id of each word of the input\n"
+			"                              to FILE and the words of the ids\n"
+			"                              to FILE.dict.\n"
+			"  --word-chars CHARS          Counts the ASCII symbols CHARS as letters.\n"
+			"  --inword-symbols CHARS      Sets the ASCII symbols which can join the\n"
+			"                              parts of a word (default -'%%,.@).\n"
+			"  --token-regex REGEX         Counts the longest matches of REGEX\n"
+			"                              as the words.\n"
+			"  --case-sensitive            Counts words differing in case separately.\n"
+			"  --strip-markup              Counts only the text of HTML or XML input,\n"
+			"                              decoding its character references.\n"
+			"  --stopwords FILE            Excludes the words of FILE from the counts.\n"
+			"  --stem                      Counts English words by their Porter stem.\n"
+			"  --dedup-lines               Tokenizes each distinct line once, counting\n"
+			"                              its words as many times as it is repeated.\n"
+			"  --max-token-length N        Cuts words longer than N bytes to their\n"
+			"                              first N bytes.\n"
+			"  --radix-tree                Counts the words in a radix tree, printing\n"
+			"                              them in order without sorting.\n"
+			"  --vocab FILE                Counts only the words of FILE, either\n"
+			"                              listed or compiled by compile-vocab.\n"
+			"  --rollup CHARS              Also prints the counts of the prefixes of\n"
+			"                              the words ending at any of CHARS.\n"
+			"  --export-fst FILE           Exports the final counts to FILE as an FST\n"
+			"                              for query-fst.\n"
+			"  --manifest FILE             Counts and prints separately each document\n"
+			"                              listed in FILE, one path per line, or\n"
+			"                              in the standard input if FILE is -.\n"
+			"                              Documents that can not be opened are\n"
+			"                              skipped, exiting with status 2.\n"
+			"  --manifest0 FILE            Same as --manifest, with the paths\n"
+			"                              separated by null characters.\n"
+			"  --force-isa ISA             Tokenizes with the kernels built for ISA,\n"
+			"                              one of scalar, sse2, avx2 or avx512bw,\n"
+			"                              instead of the best ones of the CPU.\n"
+			"Query options:\n"
+			"  --prefix PREFIX             Prints the words starting with PREFIX.\n"
+			"  --range FROM TO             Prints the words from FROM up to, but\n"
+			"                              excluding, TO.\n"
+			"Diff options:\n"
+			"  --threshold X               Prints the words whose log2 ratio of\n"
+			"                              frequencies is at least X in absolute\n"
+			"                              value (default %.1f).\n",
+			progName, progName, progName, progName, DEFAULT_CHECKPOINT_INTERVAL,
+			DEFAULT_DIFF_THRESHOLD);
+}
+
+void ProgramOptions_free(ProgramOptions *opts)
+{
+	free(opts->inputPaths);
+}
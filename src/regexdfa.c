@@ -0,0 +1,1071 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "regexdfa.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif //_MSC_VER
+
+/// The maximum number of NFA states of an expression.
+#define REGEX_MAX_NFA_STATES 65536
+/// The maximum number of DFA states, before minimization.
+#define REGEX_MAX_DFA_STATES 8192
+/// The number of slots of the table looking up the DFA states.
+#define REGEX_DFA_HASH_SLOTS 16384
+/// The maximum count of a {m,n} quantifier.
+#define REGEX_MAX_REPEAT 1000
+/// The upper bound of the quantifiers without one.
+#define REGEX_UNBOUNDED UINT32_MAX
+/// Marks a missing node or state.
+#define REGEX_NONE UINT32_MAX
+
+/// @brief A set of bytes, one bit per byte.
+typedef struct
+{
+	uint64_t bits[4];
+}ByteSet;
+
+/// @brief The type of a node of the syntax tree of an expression.
+typedef enum
+{
+	/// Matches the empty string.
+	NODE_EMPTY,
+	/// Matches a byte of a set.
+	NODE_SET,
+	/// Matches the left child followed by the right one.
+	NODE_CONCAT,
+	/// Matches either the left or the right child.
+	NODE_ALTERNATE,
+	/// Matches the left child repeated between min and max times.
+	NODE_REPEAT
+}RegexNodeType;
+
+/// @brief A node of the syntax tree of an expression.
+typedef struct
+{
+	/// The RegexNodeType of the node.
+	uint8_t type;
+	/// The index of the left or only child.
+	uint32_t left;
+	/// The index of the right child.
+	uint32_t right;
+	/// The minimum number of repetitions.
+	uint32_t min;
+	/// The maximum number of repetitions.
+	uint32_t max;
+	/// The bytes matched by a set node.
+	ByteSet set;
+}RegexNode;
+
+/// @brief The state of the parsing of an expression.
+typedef struct
+{
+	/// The string of the expression.
+	const char *pattern;
+	/// The position of the next character to be parsed.
+	size_t pos;
+	/// The nodes of the syntax tree.
+	RegexNode *nodes;
+	/// The number of nodes.
+	uint32_t numNodes;
+	/// The capacity of the array of nodes.
+	uint32_t capacity;
+	/// Whether the ASCII letters match regardless of their case.
+	bool foldCase;
+}RegexParser;
+
+/// @brief The type of an NFA state.
+typedef enum
+{
+	/// Moves to out1 on a byte of the set.
+	NFA_SET,
+	/// Moves to both out1 and out2 without consuming a byte.
+	NFA_SPLIT,
+	/// Completes a match.
+	NFA_MATCH
+}NfaStateType;
+
+/// @brief A state of the NFA of an expression.
+typedef struct
+{
+	/// The NfaStateType of the state.
+	uint8_t type;
+	/// The first next state.
+	uint32_t out1;
+	/// The second next state of a split.
+	uint32_t out2;
+	/// The bytes moving to out1.
+	ByteSet set;
+}NfaState;
+
+/// @brief The NFA built from the syntax tree of an expression.
+typedef struct
+{
+	/// The states of the NFA.
+	NfaState *states;
+	/// The number of states.
+	uint32_t numStates;
+	/// The capacity of the array of states.
+	uint32_t capacity;
+}Nfa;
+
+/**
+ * @brief Gets the position of the least significant set bit of a word.
+ *
+ * @param[in]	word	The word, which can not be 0.
+ * @return	The position of the bit.
+ */
+static inline uint32_t lowest_set_bit64(const uint64_t word)
+{
+#ifdef _MSC_VER
+	unsigned long pos;
+	_BitScanForward64(&pos, word);
+	return (uint32_t)pos;
+#else
+	return (uint32_t)__builtin_ctzll(word);
+#endif //_MSC_VER
+}
+
+static inline void byteset_add(ByteSet *set, const uint8_t b)
+{
+	set->bits[b >> 6] |= (1ULL << (b & 63));
+}
+
+static inline bool byteset_has(const ByteSet *set, const uint8_t b)
+{
+	return (set->bits[b >> 6] >> (b & 63)) & 1;
+}
+
+static void byteset_add_range(ByteSet *set, const int first, const int last)
+{
+	for(int b = first; b <= last; b++) byteset_add(set, (uint8_t)b);
+}
+
+static void byteset_union(ByteSet *dst, const ByteSet *src)
+{
+	for(uint32_t i = 0; i < 4; i++) dst->bits[i] |= src->bits[i];
+}
+
+static void byteset_invert(ByteSet *set)
+{
+	for(uint32_t i = 0; i < 4; i++) set->bits[i] = ~set->bits[i];
+}
+
+/**
+ * @brief Adds to a set the other case of each ASCII letter it holds.
+ *
+ * @param[in, out]	set	Pointer to the set.
+ * @return	Void
+ */
+static void byteset_fold_case(ByteSet *set)
+{
+	for(int c = 'a'; c <= 'z'; c++)
+	{
+		if(!byteset_has(set, (uint8_t)c) && !byteset_has(set, (uint8_t)(c - 'a' + 'A'))) continue;
+		byteset_add(set, (uint8_t)c);
+		byteset_add(set, (uint8_t)(c - 'a' + 'A'));
+	}
+}
+
+/**
+ * @brief Reports an error of the expression at the current position.
+ *
+ * @param[in]	prs	Pointer to the parser.
+ * @param[in]	msg	Pointer to the string describing the error.
+ * @return	REGEX_NONE, to be returned as the failed node.
+ */
+static uint32_t parse_error(const RegexParser *prs, const char *msg)
+{
+	fprintf(stderr, "Invalid token regex at position %ld: %s\n", (long)prs->pos, msg);
+	return REGEX_NONE;
+}
+
+/**
+ * @brief Appends a node to the syntax tree.
+ *
+ * @param[in, out]	prs		Pointer to the parser.
+ * @param[in]		type	The RegexNodeType of the node.
+ * @param[in]		left	The index of the left child.
+ * @param[in]		right	The index of the right child.
+ * @return	The index of the node, REGEX_NONE if it could not be allocated.
+ */
+static uint32_t node_new(RegexParser *prs, const RegexNodeType type,
+		const uint32_t left, const uint32_t right)
+{
+	if(prs->numNodes == prs->capacity)
+	{
+		const uint32_t newCapacity = (prs->capacity == 0) ? 64 : prs->capacity * 2;
+		RegexNode *newNodes = (RegexNode*) realloc(prs->nodes,
+				newCapacity * sizeof(RegexNode));
+		if(newNodes == NULL)
+		{
+			fprintf(stderr, "Failed to allocate the nodes of the token regex.\n");
+			return REGEX_NONE;
+		}
+		prs->nodes = newNodes;
+		prs->capacity = newCapacity;
+	}
+
+	RegexNode *node = &(prs->nodes[prs->numNodes]);
+	memset(node, 0, sizeof(RegexNode));
+	node->type = (uint8_t)type;
+	node->left = left;
+	node->right = right;
+
+	return prs->numNodes++;
+}
+
+static uint32_t parse_alternation(RegexParser *prs);
+
+/**
+ * @brief Parses an escaped character, after the backslash.
+ *
+ * @param[in, out]	prs		Pointer to the parser.
+ * @param[out]		set		Pointer to the set the matched bytes are added to.
+ * @param[out]		single	Pointer to the byte matched if only one, -1 otherwise.
+ * @return	Returns true if the escape is valid.
+ */
+static bool parse_escape(RegexParser *prs, ByteSet *set, int *single)
+{
+	const int c = (unsigned char)prs->pattern[prs->pos];
+	ByteSet cls = {{0}};
+	*single = -1;
+	switch(c)
+	{
+		case '\0':
+		{
+			parse_error(prs, "trailing backslash");
+			return false;
+		}
+		case 'd':
+		case 'D':
+		{
+			byteset_add_range(&cls, '0', '9');
+			break;
+		}
+		case 'w':
+		case 'W':
+		{
+			byteset_add_range(&cls, 'a', 'z');
+			byteset_add_range(&cls, 'A', 'Z');
+			byteset_add_range(&cls, '0', '9');
+			byteset_add(&cls, '_');
+			break;
+		}
+		case 's':
+		case 'S':
+		{
+			byteset_add_range(&cls, '\t', '\r');
+			byteset_add(&cls, ' ');
+			break;
+		}
+		case 'n': *single = '\n'; break;
+		case 'r': *single = '\r'; break;
+		case 't': *single = '\t'; break;
+		case 'x':
+		{
+			unsigned int val = 0;
+			for(uint32_t i = 1; i <= 2; i++)
+			{
+				const char h = prs->pattern[prs->pos + i];
+				unsigned int digit;
+				if((h >= '0') && (h <= '9')) digit = (unsigned int)(h - '0');
+				else if((h >= 'a') && (h <= 'f')) digit = (unsigned int)(h - 'a' + 10);
+				else if((h >= 'A') && (h <= 'F')) digit = (unsigned int)(h - 'A' + 10);
+				else
+				{
+					parse_error(prs, "\\x expects 2 hex digits");
+					return false;
+				}
+				val = (val << 4) | digit;
+			}
+			prs->pos += 2;
+			*single = (int)val;
+			break;
+		}
+		default:
+		{
+			/// Only symbols can be escaped to match themselves.
+			if((c >= 0x80) || ((c >= '0') && (c <= '9')) ||
+				((c | 0x20) >= 'a' && (c | 0x20) <= 'z'))
+			{
+				parse_error(prs, "unknown escape");
+				return false;
+			}
+			*single = c;
+			break;
+		}
+	}
+	prs->pos++;
+
+	if(*single >= 0) byteset_add(set, (uint8_t)*single);
+	else
+	{
+		/// The uppercase classes are the complements of the lowercase ones.
+		if((c == 'D') || (c == 'W') || (c == 'S')) byteset_invert(&cls);
+		byteset_union(set, &cls);
+	}
+	return true;
+}
+
+/**
+ * @brief Parses a character of a bracketed class.
+ *
+ * @param[in, out]	prs		Pointer to the parser.
+ * @param[out]		set		Pointer to the set the matched bytes are added to.
+ * @param[out]		single	Pointer to the byte matched if only one, -1 otherwise.
+ * @return	Returns true if the character is valid.
+ */
+static bool parse_class_char(RegexParser *prs, ByteSet *set, int *single)
+{
+	const int c = (unsigned char)prs->pattern[prs->pos];
+	if(c == '\\')
+	{
+		prs->pos++;
+		return parse_escape(prs, set, single);
+	}
+	/// A class matches single bytes, so it can not hold multibyte characters.
+	if(c >= 0x80)
+	{
+		parse_error(prs, "classes can only hold ASCII characters");
+		return false;
+	}
+	prs->pos++;
+	*single = c;
+	byteset_add(set, (uint8_t)c);
+	return true;
+}
+
+/**
+ * @brief Parses a bracketed class, after the opening bracket.
+ *
+ * @param[in, out]	prs	Pointer to the parser.
+ * @return	The index of the node, REGEX_NONE on error.
+ */
+static uint32_t parse_class(RegexParser *prs)
+{
+	ByteSet set = {{0}};
+	const bool negated = (prs->pattern[prs->pos] == '^');
+	if(negated) prs->pos++;
+
+	/// A closing bracket right after the opening one is a literal.
+	bool first = true;
+	while(first || (prs->pattern[prs->pos] != ']'))
+	{
+		first = false;
+		if(prs->pattern[prs->pos] == '\0') return parse_error(prs, "missing ']'");
+
+		ByteSet item = {{0}};
+		int low = -1;
+		if(!parse_class_char(prs, &item, &low)) return REGEX_NONE;
+		if((low >= 0) && (prs->pattern[prs->pos] == '-') &&
+			(prs->pattern[prs->pos + 1] != ']') && (prs->pattern[prs->pos + 1] != '\0'))
+		{
+			prs->pos++;
+			ByteSet last = {{0}};
+			int high = -1;
+			if(!parse_class_char(prs, &last, &high)) return REGEX_NONE;
+			if((high < 0) || (high < low)) return parse_error(prs, "invalid range");
+			byteset_add_range(&item, low, high);
+		}
+		byteset_union(&set, &item);
+	}
+	prs->pos++;
+	/// The letters are folded before the negation, so that a negated class
+	/// excludes both cases of its letters.
+	if(prs->foldCase) byteset_fold_case(&set);
+	if(negated) byteset_invert(&set);
+
+	const uint32_t node = node_new(prs, NODE_SET, REGEX_NONE, REGEX_NONE);
+	if(node != REGEX_NONE) prs->nodes[node].set = set;
+	return node;
+}
+
+/**
+ * @brief Parses a number of a {m,n} quantifier.
+ *
+ * @param[in, out]	prs	Pointer to the parser.
+ * @param[out]		num	Pointer to the number.
+ * @return	Returns true if a number was parsed.
+ */
+static bool parse_count(RegexParser *prs, uint32_t *num)
+{
+	const size_t start = prs->pos;
+	uint32_t val = 0;
+	while((prs->pattern[prs->pos] >= '0') && (prs->pattern[prs->pos] <= '9'))
+	{
+		val = val * 10 + (uint32_t)(prs->pattern[prs->pos] - '0');
+		if(val > REGEX_MAX_REPEAT) return false;
+		prs->pos++;
+	}
+	*num = val;
+	return (prs->pos != start);
+}
+
+/**
+ * @brief Parses an atom: a group, a class, an escape or a literal byte.
+ *
+ * @param[in, out]	prs	Pointer to the parser.
+ * @return	The index of the node, REGEX_NONE on error.
+ */
+static uint32_t parse_atom(RegexParser *prs)
+{
+	const int c = (unsigned char)prs->pattern[prs->pos];
+	switch(c)
+	{
+		case '(':
+		{
+			prs->pos++;
+			const uint32_t inner = parse_alternation(prs);
+			if(inner == REGEX_NONE) return REGEX_NONE;
+			if(prs->pattern[prs->pos] != ')') return parse_error(prs, "missing ')'");
+			prs->pos++;
+			return inner;
+		}
+		case '[':
+		{
+			prs->pos++;
+			return parse_class(prs);
+		}
+		case '*':
+		case '+':
+		case '?':
+		case '{':
+		{
+			return parse_error(prs, "quantifier without an expression");
+		}
+		case '^':
+		case '$':
+		{
+			return parse_error(prs, "anchors are not supported");
+		}
+		default:
+		{
+			break;
+		}
+	}
+
+	ByteSet set = {{0}};
+	if(c == '.')
+	{
+		/// Any byte but the new line.
+		byteset_invert(&set);
+		set.bits['\n' >> 6] &= ~(1ULL << ('\n' & 63));
+		prs->pos++;
+	}
+	else if(c == '\\')
+	{
+		int single = -1;
+		prs->pos++;
+		if(!parse_escape(prs, &set, &single)) return REGEX_NONE;
+	}
+	else
+	{
+		byteset_add(&set, (uint8_t)c);
+		prs->pos++;
+	}
+	if(prs->foldCase) byteset_fold_case(&set);
+
+	const uint32_t node = node_new(prs, NODE_SET, REGEX_NONE, REGEX_NONE);
+	if(node != REGEX_NONE) prs->nodes[node].set = set;
+	return node;
+}
+
+/**
+ * @brief Parses an atom followed by any quantifiers.
+ *
+ * @param[in, out]	prs	Pointer to the parser.
+ * @return	The index of the node, REGEX_NONE on error.
+ */
+static uint32_t parse_repeat(RegexParser *prs)
+{
+	uint32_t node = parse_atom(prs);
+	while(node != REGEX_NONE)
+	{
+		uint32_t min = 0;
+		uint32_t max = 0;
+		const char c = prs->pattern[prs->pos];
+		if(c == '*')
+		{
+			min = 0;
+			max = REGEX_UNBOUNDED;
+		}
+		else if(c == '+')
+		{
+			min = 1;
+			max = REGEX_UNBOUNDED;
+		}
+		else if(c == '?')
+		{
+			min = 0;
+			max = 1;
+		}
+		else if(c == '{')
+		{
+			prs->pos++;
+			if(!parse_count(prs, &min)) return parse_error(prs, "invalid repetition count");
+			max = min;
+			if(prs->pattern[prs->pos] == ',')
+			{
+				prs->pos++;
+				if(prs->pattern[prs->pos] == '}') max = REGEX_UNBOUNDED;
+				else if(!parse_count(prs, &max) || (max < min))
+					return parse_error(prs, "invalid repetition count");
+			}
+			if(prs->pattern[prs->pos] != '}') return parse_error(prs, "missing '}'");
+		}
+		else break;
+		prs->pos++;
+
+		const uint32_t rep = node_new(prs, NODE_REPEAT, node, REGEX_NONE);
+		if(rep == REGEX_NONE) return REGEX_NONE;
+		prs->nodes[rep].min = min;
+		prs->nodes[rep].max = max;
+		node = rep;
+	}
+
+	return node;
+}
+
+/**
+ * @brief Parses a sequence of repeated atoms.
+ *
+ * @param[in, out]	prs	Pointer to the parser.
+ * @return	The index of the node, REGEX_NONE on error.
+ */
+static uint32_t parse_concat(RegexParser *prs)
+{
+	uint32_t node = node_new(prs, NODE_EMPTY, REGEX_NONE, REGEX_NONE);
+	while(node != REGEX_NONE)
+	{
+		const char c = prs->pattern[prs->pos];
+		if((c == '\0') || (c == '|') || (c == ')')) break;
+
+		const uint32_t item = parse_repeat(prs);
+		if(item == REGEX_NONE) return REGEX_NONE;
+		node = (prs->nodes[node].type == NODE_EMPTY) ? item :
+				node_new(prs, NODE_CONCAT, node, item);
+	}
+
+	return node;
+}
+
+/**
+ * @brief Parses alternatives separated by '|'.
+ *
+ * @param[in, out]	prs	Pointer to the parser.
+ * @return	The index of the node, REGEX_NONE on error.
+ */
+static uint32_t parse_alternation(RegexParser *prs)
+{
+	uint32_t node = parse_concat(prs);
+	while((node != REGEX_NONE) && (prs->pattern[prs->pos] == '|'))
+	{
+		prs->pos++;
+		const uint32_t right = parse_concat(prs);
+		if(right == REGEX_NONE) return REGEX_NONE;
+		node = node_new(prs, NODE_ALTERNATE, node, right);
+	}
+
+	return node;
+}
+
+/**
+ * @brief Appends a state to the NFA.
+ *
+ * @param[in, out]	nfa		Pointer to the NFA.
+ * @param[in]		type	The NfaStateType of the state.
+ * @param[in]		out1	The first next state.
+ * @param[in]		out2	The second next state.
+ * @return	The index of the state, REGEX_NONE if the NFA is too large.
+ */
+static uint32_t nfa_state_new(Nfa *nfa, const NfaStateType type,
+		const uint32_t out1, const uint32_t out2)
+{
+	if(nfa->numStates == REGEX_MAX_NFA_STATES)
+	{
+		fprintf(stderr, "The token regex is too large.\n");
+		return REGEX_NONE;
+	}
+	if(nfa->numStates == nfa->capacity)
+	{
+		const uint32_t newCapacity = (nfa->capacity == 0) ? 64 : nfa->capacity * 2;
+		NfaState *newStates = (NfaState*) realloc(nfa->states,
+				newCapacity * sizeof(NfaState));
+		if(newStates == NULL)
+		{
+			fprintf(stderr, "Failed to allocate the NFA of the token regex.\n");
+			return REGEX_NONE;
+		}
+		nfa->states = newStates;
+		nfa->capacity = newCapacity;
+	}
+
+	NfaState *state = &(nfa->states[nfa->numStates]);
+	memset(state, 0, sizeof(NfaState));
+	state->type = (uint8_t)type;
+	state->out1 = out1;
+	state->out2 = out2;
+
+	return nfa->numStates++;
+}
+
+/**
+ * @brief Builds the NFA states of a node of the syntax tree.
+ * @details The states are built backwards from the state following them,
+ * so that repeated nodes are copied without patching dangling edges.
+ *
+ * @param[in, out]	nfa		Pointer to the NFA.
+ * @param[in]		nodes	Pointer to the nodes of the syntax tree.
+ * @param[in]		node	The index of the node.
+ * @param[in]		next	The state following the node.
+ * @return	The first state of the node, REGEX_NONE on error.
+ */
+static uint32_t nfa_build(Nfa *nfa, const RegexNode *nodes, const uint32_t node,
+		const uint32_t next)
+{
+	const RegexNode *nd = &(nodes[node]);
+	switch(nd->type)
+	{
+		case NODE_EMPTY:
+		{
+			return next;
+		}
+		case NODE_SET:
+		{
+			const uint32_t state = nfa_state_new(nfa, NFA_SET, next, REGEX_NONE);
+			if(state != REGEX_NONE) nfa->states[state].set = nd->set;
+			return state;
+		}
+		case NODE_CONCAT:
+		{
+			const uint32_t right = nfa_build(nfa, nodes, nd->right, next);
+			if(right == REGEX_NONE) return REGEX_NONE;
+			return nfa_build(nfa, nodes, nd->left, right);
+		}
+		case NODE_ALTERNATE:
+		{
+			const uint32_t left = nfa_build(nfa, nodes, nd->left, next);
+			if(left == REGEX_NONE) return REGEX_NONE;
+			const uint32_t right = nfa_build(nfa, nodes, nd->right, next);
+			if(right == REGEX_NONE) return REGEX_NONE;
+			return nfa_state_new(nfa, NFA_SPLIT, left, right);
+		}
+		default:
+		{
+			break;
+		}
+	}
+
+	/// The optional repetitions follow the mandatory ones, each of them
+	/// skipping to the end of the node.
+	uint32_t cur = next;
+	if(nd->max == REGEX_UNBOUNDED)
+	{
+		const uint32_t loop = nfa_state_new(nfa, NFA_SPLIT, REGEX_NONE, next);
+		if(loop == REGEX_NONE) return REGEX_NONE;
+		const uint32_t body = nfa_build(nfa, nodes, nd->left, loop);
+		if(body == REGEX_NONE) return REGEX_NONE;
+		nfa->states[loop].out1 = body;
+		cur = loop;
+	}
+	else
+	{
+		for(uint32_t i = nd->min; i < nd->max; i++)
+		{
+			const uint32_t body = nfa_build(nfa, nodes, nd->left, cur);
+			if(body == REGEX_NONE) return REGEX_NONE;
+			cur = nfa_state_new(nfa, NFA_SPLIT, body, next);
+			if(cur == REGEX_NONE) return REGEX_NONE;
+		}
+	}
+	for(uint32_t i = 0; i < nd->min; i++)
+	{
+		cur = nfa_build(nfa, nodes, nd->left, cur);
+		if(cur == REGEX_NONE) return REGEX_NONE;
+	}
+
+	return cur;
+}
+
+/**
+ * @brief Adds a state to a set of NFA states along with the states
+ * it reaches without consuming a byte.
+ *
+ * @param[in]		nfa		Pointer to the NFA.
+ * @param[in, out]	set		Pointer to the bitset of the states.
+ * @param[in, out]	stack	Pointer to a stack of at least as many entries as states.
+ * @param[in]		state	The state to be added.
+ * @return	Void
+ */
+static void nfa_closure_add(const Nfa *nfa, uint64_t *set, uint32_t *stack,
+		const uint32_t state)
+{
+	if((state == REGEX_NONE) || ((set[state >> 6] >> (state & 63)) & 1)) return;
+
+	uint32_t top = 0;
+	set[state >> 6] |= (1ULL << (state & 63));
+	stack[top++] = state;
+	while(top != 0)
+	{
+		const NfaState *st = &(nfa->states[stack[--top]]);
+		if(st->type != NFA_SPLIT) continue;
+
+		const uint32_t outs[2] = {st->out1, st->out2};
+		for(uint32_t i = 0; i < 2; i++)
+		{
+			const uint32_t out = outs[i];
+			if((out == REGEX_NONE) || ((set[out >> 6] >> (out & 63)) & 1)) continue;
+			set[out >> 6] |= (1ULL << (out & 63));
+			stack[top++] = out;
+		}
+	}
+}
+
+/**
+ * @brief Groups the bytes which no state of the NFA tells apart into classes.
+ *
+ * @param[in]	nfa			Pointer to the NFA.
+ * @param[out]	classes		Pointer to the class of each byte.
+ * @return	The number of classes.
+ */
+static uint32_t byte_classes(const Nfa *nfa, uint8_t *classes)
+{
+	uint32_t numClasses = 1;
+	memset(classes, 0, 256);
+
+	/// Each set splits the classes into the bytes it holds and the rest.
+	for(uint32_t s = 0; s < nfa->numStates; s++)
+	{
+		if(nfa->states[s].type != NFA_SET) continue;
+
+		int16_t split[256][2];
+		memset(split, 0xFF, sizeof(split));
+		uint32_t newNumClasses = 0;
+		for(int b = 0; b < 256; b++)
+		{
+			const int in = byteset_has(&(nfa->states[s].set), (uint8_t)b) ? 1 : 0;
+			if(split[classes[b]][in] < 0) split[classes[b]][in] = (int16_t)newNumClasses++;
+			classes[b] = (uint8_t)split[classes[b]][in];
+		}
+		numClasses = newNumClasses;
+	}
+
+	return numClasses;
+}
+
+/// @brief The DFA built by the subset construction, before minimization.
+typedef struct
+{
+	/// The bitsets of the NFA states of each DFA state.
+	uint64_t *sets;
+	/// The number of 64-bit words of each bitset.
+	uint32_t setWords;
+	/// The next state of each state per byte class.
+	uint32_t *transitions;
+	/// Whether each state completes a match.
+	bool *accepting;
+	/// The number of states.
+	uint32_t numStates;
+	/// The table looking up the states by their bitset.
+	uint32_t *slots;
+}SubsetDfa;
+
+/**
+ * @brief Finds the DFA state of a set of NFA states, adding it if missing.
+ *
+ * @param[in, out]	sdfa		Pointer to the DFA.
+ * @param[in]		set			Pointer to the bitset of the NFA states.
+ * @param[in]		numClasses	The number of byte classes.
+ * @return	The index of the state, REGEX_NONE if there are too many states.
+ */
+static uint32_t subset_state(SubsetDfa *sdfa, const uint64_t *set, const uint32_t numClasses)
+{
+	const size_t setBytes = sdfa->setWords * sizeof(uint64_t);
+	uint32_t slot = (uint32_t)fnvhash((const uint8_t*)set, (uint32_t)setBytes)
+			& (REGEX_DFA_HASH_SLOTS - 1);
+	while(sdfa->slots[slot] != REGEX_NONE)
+	{
+		const uint32_t state = sdfa->slots[slot];
+		if(memcmp(sdfa->sets + (size_t)state * sdfa->setWords, set, setBytes) == 0)
+			return state;
+		slot = (slot + 1) & (REGEX_DFA_HASH_SLOTS - 1);
+	}
+
+	if(sdfa->numStates == REGEX_MAX_DFA_STATES)
+	{
+		fprintf(stderr, "The token regex is too complex.\n");
+		return REGEX_NONE;
+	}
+	const uint32_t state = sdfa->numStates++;
+	memcpy(sdfa->sets + (size_t)state * sdfa->setWords, set, setBytes);
+	for(uint32_t c = 0; c < numClasses; c++)
+	{
+		sdfa->transitions[(size_t)state * numClasses + c] = REGEX_DEAD_STATE;
+	}
+	sdfa->slots[slot] = state;
+
+	return state;
+}
+
+/**
+ * @brief Converts the NFA to a DFA with the subset construction.
+ *
+ * @param[in]		nfa			Pointer to the NFA.
+ * @param[in]		start		The start state of the NFA.
+ * @param[in]		match		The match state of the NFA.
+ * @param[in]		classes		Pointer to the class of each byte.
+ * @param[in]		numClasses	The number of byte classes.
+ * @param[out]		sdfa		Pointer to the DFA to be built.
+ * @return	Returns the status of the routine.
+ */
+static bool subset_construct(const Nfa *nfa, const uint32_t start, const uint32_t match,
+		const uint8_t *classes, const uint32_t numClasses, SubsetDfa *sdfa)
+{
+	sdfa->setWords = (nfa->numStates + 63) / 64;
+	sdfa->sets = (uint64_t*) calloc((size_t)REGEX_MAX_DFA_STATES * sdfa->setWords,
+			sizeof(uint64_t));
+	sdfa->transitions = (uint32_t*) calloc((size_t)REGEX_MAX_DFA_STATES * numClasses,
+			sizeof(uint32_t));
+	sdfa->accepting = (bool*) calloc(REGEX_MAX_DFA_STATES, sizeof(bool));
+	sdfa->slots = (uint32_t*) malloc(REGEX_DFA_HASH_SLOTS * sizeof(uint32_t));
+	uint64_t *cur = (uint64_t*) calloc(sdfa->setWords, sizeof(uint64_t));
+	uint64_t *next = (uint64_t*) calloc(sdfa->setWords, sizeof(uint64_t));
+	uint32_t *stack = (uint32_t*) malloc(nfa->numStates * sizeof(uint32_t));
+	if((sdfa->sets == NULL) || (sdfa->transitions == NULL) || (sdfa->accepting == NULL) ||
+		(sdfa->slots == NULL) || (cur == NULL) || (next == NULL) || (stack == NULL))
+	{
+		fprintf(stderr, "Failed to allocate the DFA of the token regex.\n");
+		free(cur);
+		free(next);
+		free(stack);
+		return false;
+	}
+	memset(sdfa->slots, 0xFF, REGEX_DFA_HASH_SLOTS * sizeof(uint32_t));
+
+	/// A representative byte of each class.
+	uint8_t reps[256];
+	for(int b = 255; b >= 0; b--) reps[classes[b]] = (uint8_t)b;
+
+	/// The dead state holds no NFA states and the start state follows it.
+	bool ok = (subset_state(sdfa, cur, numClasses) == REGEX_DEAD_STATE);
+	nfa_closure_add(nfa, cur, stack, start);
+	ok = ok && (subset_state(sdfa, cur, numClasses) != REGEX_NONE);
+
+	for(uint32_t state = 1; ok && (state < sdfa->numStates); state++)
+	{
+		memcpy(cur, sdfa->sets + (size_t)state * sdfa->setWords,
+				sdfa->setWords * sizeof(uint64_t));
+		sdfa->accepting[state] = (cur[match >> 6] >> (match & 63)) & 1;
+		for(uint32_t c = 0; ok && (c < numClasses); c++)
+		{
+			memset(next, 0, sdfa->setWords * sizeof(uint64_t));
+			for(uint32_t w = 0; w < sdfa->setWords; w++)
+			{
+				uint64_t word = cur[w];
+				while(word != 0)
+				{
+					const uint32_t s = w * 64 + lowest_set_bit64(word);
+					word &= word - 1;
+					const NfaState *st = &(nfa->states[s]);
+					if((st->type == NFA_SET) && byteset_has(&(st->set), reps[c]))
+						nfa_closure_add(nfa, next, stack, st->out1);
+				}
+			}
+			const uint32_t target = subset_state(sdfa, next, numClasses);
+			if(target == REGEX_NONE) ok = false;
+			else sdfa->transitions[(size_t)state * numClasses + c] = target;
+		}
+	}
+
+	free(cur);
+	free(next);
+	free(stack);
+	return ok;
+}
+
+/**
+ * @brief Merges the equivalent states of the DFA, refining the partition
+ * of the states by their acceptance until the next states of the states
+ * of each block fall in the same blocks.
+ *
+ * @param[in]	sdfa		Pointer to the DFA of the subset construction.
+ * @param[in]	numClasses	The number of byte classes.
+ * @param[out]	dfa			Pointer to the minimized DFA.
+ * @return	Returns true if the DFA was minimized.
+ */
+static bool dfa_minimize(const SubsetDfa *sdfa, const uint32_t numClasses, RegexDfa *dfa)
+{
+	const uint32_t n = sdfa->numStates;
+	uint32_t *block = (uint32_t*) malloc(n * sizeof(uint32_t));
+	uint32_t *newBlock = (uint32_t*) malloc(n * sizeof(uint32_t));
+	uint32_t *sig = (uint32_t*) malloc((numClasses + 1) * sizeof(uint32_t));
+	const size_t numSlots = next_2power(2 * (size_t)n);
+	uint32_t *slots = (uint32_t*) malloc(numSlots * sizeof(uint32_t));
+	if((block == NULL) || (newBlock == NULL) || (sig == NULL) || (slots == NULL))
+	{
+		fprintf(stderr, "Failed to allocate the DFA of the token regex.\n");
+		free(block);
+		free(newBlock);
+		free(sig);
+		free(slots);
+		return false;
+	}
+
+	uint32_t numBlocks = 0;
+	for(uint32_t s = 0; s < n; s++)
+	{
+		block[s] = sdfa->accepting[s] ? 1 : 0;
+	}
+	while(true)
+	{
+		/// The states with the same block and the same blocks of next states
+		/// form a block of the refined partition.
+		uint32_t newNumBlocks = 0;
+		memset(slots, 0xFF, numSlots * sizeof(uint32_t));
+		for(uint32_t s = 0; s < n; s++)
+		{
+			const uint32_t *trans = sdfa->transitions + (size_t)s * numClasses;
+			sig[0] = block[s];
+			for(uint32_t c = 0; c < numClasses; c++) sig[c + 1] = block[trans[c]];
+
+			size_t slot = (size_t)fnvhash((const uint8_t*)sig,
+					(numClasses + 1) * sizeof(uint32_t)) & (numSlots - 1);
+			while(slots[slot] != REGEX_NONE)
+			{
+				const uint32_t rep = slots[slot];
+				const uint32_t *repTrans = sdfa->transitions + (size_t)rep * numClasses;
+				bool same = (block[rep] == sig[0]);
+				for(uint32_t c = 0; same && (c < numClasses); c++)
+				{
+					same = (block[repTrans[c]] == sig[c + 1]);
+				}
+				if(same) break;
+				slot = (slot + 1) & (numSlots - 1);
+			}
+			if(slots[slot] == REGEX_NONE)
+			{
+				slots[slot] = s;
+				newBlock[s] = newNumBlocks++;
+			}
+			else newBlock[s] = newBlock[slots[slot]];
+		}
+
+		uint32_t *tmp = block;
+		block = newBlock;
+		newBlock = tmp;
+		if(newNumBlocks == numBlocks) break;
+		numBlocks = newNumBlocks;
+	}
+
+	/// The blocks are numbered in the order of their first state,
+	/// so the block of the dead state is the dead state of the result.
+	dfa->numStates = numBlocks;
+	dfa->numClasses = numClasses;
+	dfa->start = block[1];
+	dfa->transitions = (uint16_t*) calloc((size_t)numBlocks * numClasses, sizeof(uint16_t));
+	dfa->accepting = (bool*) calloc(numBlocks, sizeof(bool));
+	const bool ok = (dfa->transitions != NULL) && (dfa->accepting != NULL);
+	if(!ok) fprintf(stderr, "Failed to allocate the DFA of the token regex.\n");
+	for(uint32_t s = 0; ok && (s < n); s++)
+	{
+		const uint32_t b = block[s];
+		dfa->accepting[b] = sdfa->accepting[s];
+		for(uint32_t c = 0; c < numClasses; c++)
+		{
+			dfa->transitions[(size_t)b * numClasses + c] =
+					(uint16_t)block[sdfa->transitions[(size_t)s * numClasses + c]];
+		}
+	}
+
+	free(block);
+	free(newBlock);
+	free(sig);
+	free(slots);
+	return ok;
+}
+
+RegexDfa* RegexDfa_compile(const char *pattern, const bool foldCase)
+{
+	RegexParser prs = {0};
+	prs.pattern = pattern;
+	prs.foldCase = foldCase;
+	uint32_t root = parse_alternation(&prs);
+	if((root != REGEX_NONE) && (pattern[prs.pos] != '\0'))
+	{
+		root = parse_error(&prs, "unmatched ')'");
+	}
+	if(root == REGEX_NONE)
+	{
+		free(prs.nodes);
+		return NULL;
+	}
+
+	Nfa nfa = {0};
+	const uint32_t match = nfa_state_new(&nfa, NFA_MATCH, REGEX_NONE, REGEX_NONE);
+	const uint32_t start = (match == REGEX_NONE) ? REGEX_NONE :
+			nfa_build(&nfa, prs.nodes, root, match);
+	free(prs.nodes);
+
+	RegexDfa *dfa = NULL;
+	SubsetDfa sdfa = {0};
+	if(start != REGEX_NONE) dfa = (RegexDfa*) calloc(1, sizeof(RegexDfa));
+	bool ok = (dfa != NULL);
+	if(ok)
+	{
+		const uint32_t numClasses = byte_classes(&nfa, dfa->classes);
+		ok = subset_construct(&nfa, start, match, dfa->classes, numClasses, &sdfa) &&
+			dfa_minimize(&sdfa, numClasses, dfa);
+	}
+	free(nfa.states);
+	free(sdfa.sets);
+	free(sdfa.transitions);
+	free(sdfa.accepting);
+	free(sdfa.slots);
+
+	/// An expression matching only the empty string yields no tokens.
+	if(ok)
+	{
+		bool matchesBytes = false;
+		for(uint32_t c = 0; c < dfa->numClasses; c++)
+		{
+			matchesBytes |= (dfa->transitions[(size_t)dfa->start * dfa->numClasses + c]
+					!= REGEX_DEAD_STATE);
+		}
+		if(!matchesBytes)
+		{
+			fprintf(stderr, "The token regex matches no tokens.\n");
+			ok = false;
+		}
+	}
+	if(!ok && (dfa != NULL)) RegexDfa_destroy(&dfa);
+
+	return dfa;
+}
+
+void RegexDfa_destroy(RegexDfa **dfa)
+{
+	free((*dfa)->transitions);
+	free((*dfa)->accepting);
+	free(*dfa);
+	*dfa = NULL;
+}
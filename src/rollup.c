@@ -0,0 +1,226 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "rollup.h"
+#include <string.h>
+
+/// The initial number of prefixes allocated.
+#define ROLLUP_INITIAL_PREFIXES 256
+
+/// @brief A prefix of the words, ending at a separator.
+typedef struct
+{
+	/// Pointer to the characters of the first word starting with the prefix.
+	const char *letters;
+	/// The length of the prefix, including its separator.
+	uint32_t length;
+	/// The number of occurrences of the words starting with the prefix.
+	size_t count;
+}RollupPrefix;
+
+struct PrefixRollup
+{
+	/// The prefixes, in alphabetical order.
+	RollupPrefix *prefixes;
+	size_t numPrefixes;
+	size_t capacity;
+	/// The most prefixes of a single word.
+	uint32_t maxDepth;
+};
+
+/**
+ * @brief Appends a prefix, growing the array of the prefixes if needed.
+ *
+ * @param[in, out]	rollup	Pointer to the rollup.
+ * @param[in]		letters	Pointer to the characters of the word.
+ * @param[in]		length	The length of the prefix.
+ * @return	Return the status of the routine.
+ */
+static RetStatus rollup_append(PrefixRollup *rollup, const char *letters, const uint32_t length)
+{
+	if(rollup->numPrefixes == rollup->capacity)
+	{
+		const size_t capacity = 2 * rollup->capacity;
+		RollupPrefix *prefixes = (RollupPrefix*) realloc(rollup->prefixes,
+				capacity * sizeof(RollupPrefix));
+		if(prefixes == NULL) return GEN_FAIL;
+		rollup->prefixes = prefixes;
+		rollup->capacity = capacity;
+	}
+	RollupPrefix *prefix = &(rollup->prefixes[rollup->numPrefixes++]);
+	prefix->letters = letters;
+	prefix->length = length;
+	prefix->count = 0;
+	return SUCCESS;
+}
+
+PrefixRollup* PrefixRollup_create(const WordHashTable *whtab, const char *separators)
+{
+	PrefixRollup *rollup = (PrefixRollup*) calloc(1, sizeof(PrefixRollup));
+	if(rollup == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the prefix rollup.\n");
+		return NULL;
+	}
+	rollup->capacity = ROLLUP_INITIAL_PREFIXES;
+	rollup->prefixes = (RollupPrefix*) malloc(rollup->capacity * sizeof(RollupPrefix));
+	/// The stack holds the positions of the prefixes of the last word.
+	size_t stackCapacity = ROLLUP_INITIAL_PREFIXES;
+	size_t *stack = (size_t*) malloc(stackCapacity * sizeof(size_t));
+	if((rollup->prefixes == NULL) || (stack == NULL))
+	{
+		fprintf(stderr, "Failed to allocate the prefix rollup.\n");
+		free(stack);
+		PrefixRollup_destroy(&rollup);
+		return NULL;
+	}
+	bool isSeparator[256] = {false};
+	for(const char *s = separators; *s != '\0'; s++) isSeparator[(uint8_t)*s] = true;
+
+	const char *prev = NULL;
+	uint32_t prevLength = 0;
+	size_t depth = 0;
+	const size_t size = WordHashTable_get_size(whtab);
+	for(size_t i = 0; i < size; i++)
+	{
+		uint32_t length = 0;
+		size_t count = 0;
+		const char *word = WordHashTable_order_word(whtab, i, &length, &count);
+		if(word == NULL) continue;
+
+		uint32_t shared = 0;
+		if(prev != NULL)
+		{
+			const uint32_t limit = (length < prevLength) ? length : prevLength;
+			while((shared < limit) && (word[shared] == prev[shared])) shared++;
+		}
+		/// The prefixes longer than the part shared with the last word
+		/// have no more words, so their counts are final.
+		while((depth > 0) && (rollup->prefixes[stack[depth - 1]].length > shared))
+		{
+			depth--;
+			if(depth > 0)
+			{
+				rollup->prefixes[stack[depth - 1]].count +=
+						rollup->prefixes[stack[depth]].count;
+			}
+		}
+		/// The separators of the shared part end prefixes already on the stack.
+		for(uint32_t p = (shared > 0) ? shared : 1; p < length; p++)
+		{
+			if(!isSeparator[(uint8_t)word[p]]) continue;
+			if(depth == stackCapacity)
+			{
+				stackCapacity *= 2;
+				size_t *grown = (size_t*) realloc(stack, stackCapacity * sizeof(size_t));
+				if(grown == NULL)
+				{
+					fprintf(stderr, "Failed to expand the stack of the prefix rollup.\n");
+					free(stack);
+					PrefixRollup_destroy(&rollup);
+					return NULL;
+				}
+				stack = grown;
+			}
+			if(rollup_append(rollup, word, p + 1) != SUCCESS)
+			{
+				fprintf(stderr, "Failed to expand the prefixes of the rollup.\n");
+				free(stack);
+				PrefixRollup_destroy(&rollup);
+				return NULL;
+			}
+			stack[depth++] = rollup->numPrefixes - 1;
+		}
+		if(depth > rollup->maxDepth) rollup->maxDepth = (uint32_t)depth;
+		if(depth > 0) rollup->prefixes[stack[depth - 1]].count += count;
+		prev = word;
+		prevLength = length;
+	}
+	while(depth > 1)
+	{
+		depth--;
+		rollup->prefixes[stack[depth - 1]].count += rollup->prefixes[stack[depth]].count;
+	}
+	free(stack);
+
+	return rollup;
+}
+
+/// @brief The state of an iteration over the prefixes of a rollup.
+typedef struct
+{
+	/// Pointer to the rollup.
+	const PrefixRollup *rollup;
+	/// The position of the next prefix.
+	size_t pos;
+}PrefixIter;
+
+/**
+ * @brief Gets the next prefix of a rollup in the order of the words.
+ *
+ * @param[in, out]	iter	Pointer to the state of the iteration.
+ * @param[out]		word	Pointer to the bytes of the prefix, or NULL past the last one.
+ * @param[out]		length	Pointer to the length of the prefix.
+ * @param[out]		count	Pointer to the count of the prefix.
+ * @return	Return the status of the routine.
+ */
+static RetStatus prefix_next(void *iter, const char **word, uint32_t *length, size_t *count)
+{
+	PrefixIter *it = (PrefixIter*)iter;
+	if(it->pos == it->rollup->numPrefixes)
+	{
+		*word = NULL;
+		return SUCCESS;
+	}
+	const RollupPrefix *prefix = &(it->rollup->prefixes[it->pos++]);
+	*word = prefix->letters;
+	*length = prefix->length;
+	*count = prefix->count;
+
+	return SUCCESS;
+}
+
+void PrefixRollup_print(const PrefixRollup *rollup)
+{
+	uint32_t maxLength = 0;
+	size_t maxCount = 0;
+	for(size_t i = 0; i < rollup->numPrefixes; i++)
+	{
+		if(rollup->prefixes[i].length > maxLength) maxLength = rollup->prefixes[i].length;
+		if(rollup->prefixes[i].count > maxCount) maxCount = rollup->prefixes[i].count;
+	}
+
+	PrefixIter iter = {rollup, 0};
+	printf("\n");
+	CountTable_print("prefix", "Prefix", maxLength, maxCount, prefix_next, &iter);
+}
+
+void PrefixRollup_stats_print(const PrefixRollup *rollup)
+{
+	printf("\nPrefix Rollup statistics:\n");
+	printf("\tPrefixes: %ld\n", rollup->numPrefixes);
+	printf("\tMost prefixes of a word: %u\n", rollup->maxDepth);
+}
+
+void PrefixRollup_destroy(PrefixRollup **rollup)
+{
+	free((*rollup)->prefixes);
+	free(*rollup);
+	*rollup = NULL;
+}
@@ -0,0 +1,517 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "stemmer.h"
+#include "utils.h"
+#include <string.h>
+
+/// The number of words remembered by the cache, a power of 2.
+#define STEM_CACHE_SLOTS 4096
+/// The maximum length of a word remembered by the cache,
+/// so that a slot fills a cache line.
+#define STEM_CACHE_WORD_LENGTH 27
+/// The minimum length of the words reduced to their stem.
+#define MIN_STEMMED_LENGTH 3
+/// The initial capacity of the buffers of the stemmer.
+#define INITIAL_STEM_LENGTH 32
+
+/// @brief A slot of the cache, holding a word and its stem.
+typedef struct
+{
+	/// The hash of the word.
+	uint64_t hash;
+	/// The length of the word, 0 if the slot is empty.
+	uint8_t wordLen;
+	/// The length of the stem.
+	uint8_t stemLen;
+	/// The characters of the word.
+	char word[STEM_CACHE_WORD_LENGTH];
+	/// The characters of the stem.
+	char stem[STEM_CACHE_WORD_LENGTH];
+}StemSlot;
+
+struct Stemmer
+{
+	/// The slots of the cache, each word taking the slot of its hash.
+	StemSlot *slots;
+	/// The buffer the word is reduced to its stem in.
+	char *letters;
+	/// The capacity of the buffer.
+	uint32_t capacity;
+	/// The buffer of the last stem returned.
+	WordBuffer *result;
+	/// The number of words whose stem was found in the cache.
+	size_t hits;
+	/// The number of words whose stem was computed.
+	size_t misses;
+};
+
+/// @brief A word being reduced to its stem by the steps of the algorithm.
+typedef struct
+{
+	/// The characters of the word.
+	char *b;
+	/// The index of the last character of the word.
+	int k;
+	/// The index of the last character preceding the suffix matched last.
+	int j;
+}PorterWord;
+
+/**
+ * @brief Checks whether a character of the word is a consonant.
+ * @details 'y' is a consonant at the start of the word or after a vowel.
+ *
+ * @param[in]	w	Pointer to the word.
+ * @param[in]	i	The index of the character.
+ * @return	Returns true if the character is a consonant.
+ */
+static bool porter_cons(const PorterWord *w, const int i)
+{
+	switch(w->b[i])
+	{
+	case 'a': case 'e': case 'i': case 'o': case 'u':
+		return false;
+	case 'y':
+		return (i == 0) ? true : !porter_cons(w, i - 1);
+	default:
+		return true;
+	}
+}
+
+/**
+ * @brief Measures the number of vowel-consonant sequences of the word
+ * up to the suffix matched last.
+ * @details Writing c for a sequence of consonants and v for one of vowels,
+ * any word is [c](vc){m}[v], of which m is measured.
+ *
+ * @param[in]	w	Pointer to the word.
+ * @return	The number of sequences.
+ */
+static int porter_measure(const PorterWord *w)
+{
+	int n = 0;
+	int i = 0;
+	for(; (i <= w->j) && porter_cons(w, i); i++);
+	if(i > w->j) return 0;
+	while(true)
+	{
+		for(; (i <= w->j) && !porter_cons(w, i); i++);
+		if(i > w->j) return n;
+		n++;
+		for(; (i <= w->j) && porter_cons(w, i); i++);
+		if(i > w->j) return n;
+	}
+}
+
+/**
+ * @brief Checks whether the word contains a vowel up to the suffix matched last.
+ *
+ * @param[in]	w	Pointer to the word.
+ * @return	Returns true if a vowel is found.
+ */
+static bool porter_vowel_in_stem(const PorterWord *w)
+{
+	for(int i = 0; i <= w->j; i++)
+	{
+		if(!porter_cons(w, i)) return true;
+	}
+	return false;
+}
+
+/**
+ * @brief Checks whether a character of the word is a consonant doubling
+ * the previous one.
+ *
+ * @param[in]	w	Pointer to the word.
+ * @param[in]	i	The index of the character.
+ * @return	Returns true if the characters are a double consonant.
+ */
+static bool porter_double_cons(const PorterWord *w, const int i)
+{
+	return (i >= 1) && (w->b[i] == w->b[i - 1]) && porter_cons(w, i);
+}
+
+/**
+ * @brief Checks whether the characters of the word ending at an index are
+ * a consonant, a vowel and a consonant other than 'w', 'x' or 'y',
+ * as in "hop", after which an 'e' is restored.
+ *
+ * @param[in]	w	Pointer to the word.
+ * @param[in]	i	The index of the last character.
+ * @return	Returns true if the characters match.
+ */
+static bool porter_cvc(const PorterWord *w, const int i)
+{
+	if((i < 2) || !porter_cons(w, i) || porter_cons(w, i - 1) || !porter_cons(w, i - 2))
+		return false;
+	return (w->b[i] != 'w') && (w->b[i] != 'x') && (w->b[i] != 'y');
+}
+
+/**
+ * @brief Checks whether the word ends with a suffix, in which case
+ * the suffix becomes the one matched last.
+ *
+ * @param[in, out]	w		Pointer to the word.
+ * @param[in]		suffix	Pointer to the string of the suffix.
+ * @return	Returns true if the word ends with the suffix.
+ */
+static bool porter_ends(PorterWord *w, const char *suffix)
+{
+	const int len = (int)strlen(suffix);
+	if((len > w->k + 1) || (suffix[len - 1] != w->b[w->k])) return false;
+	if(memcmp(w->b + w->k - len + 1, suffix, (size_t)len) != 0) return false;
+	w->j = w->k - len;
+	return true;
+}
+
+/**
+ * @brief Replaces the suffix matched last.
+ * @details The replacements are never longer than the suffixes they replace.
+ *
+ * @param[in, out]	w			Pointer to the word.
+ * @param[in]		replacement	Pointer to the string replacing the suffix.
+ * @return	Void
+ */
+static void porter_set(PorterWord *w, const char *replacement)
+{
+	const int len = (int)strlen(replacement);
+	memcpy(w->b + w->j + 1, replacement, (size_t)len);
+	w->k = w->j + len;
+}
+
+/**
+ * @brief Replaces the suffix matched last if the rest of the word
+ * has at least one vowel-consonant sequence.
+ *
+ * @param[in, out]	w			Pointer to the word.
+ * @param[in]		replacement	Pointer to the string replacing the suffix.
+ * @return	Void
+ */
+static void porter_replace(PorterWord *w, const char *replacement)
+{
+	if(porter_measure(w) > 0) porter_set(w, replacement);
+}
+
+/**
+ * @brief Removes plurals and the suffixes -ed and -ing,
+ * as in "caresses" to "caress", "ponies" to "poni" and "hopping" to "hop".
+ *
+ * @param[in, out]	w	Pointer to the word.
+ * @return	Void
+ */
+static void porter_step1ab(PorterWord *w)
+{
+	if(w->b[w->k] == 's')
+	{
+		if(porter_ends(w, "sses")) w->k -= 2;
+		else if(porter_ends(w, "ies")) porter_set(w, "i");
+		else if(w->b[w->k - 1] != 's') w->k--;
+	}
+	if(porter_ends(w, "eed"))
+	{
+		if(porter_measure(w) > 0) w->k--;
+	}
+	else if((porter_ends(w, "ed") || porter_ends(w, "ing")) && porter_vowel_in_stem(w))
+	{
+		w->k = w->j;
+		if(porter_ends(w, "at")) porter_set(w, "ate");
+		else if(porter_ends(w, "bl")) porter_set(w, "ble");
+		else if(porter_ends(w, "iz")) porter_set(w, "ize");
+		else if(porter_double_cons(w, w->k))
+		{
+			const char ch = w->b[w->k];
+			if((ch != 'l') && (ch != 's') && (ch != 'z')) w->k--;
+		}
+		else
+		{
+			w->j = w->k;
+			if((porter_measure(w) == 1) && porter_cvc(w, w->k)) porter_set(w, "e");
+		}
+	}
+}
+
+/**
+ * @brief Turns a final 'y' to 'i' when there is another vowel in the word.
+ *
+ * @param[in, out]	w	Pointer to the word.
+ * @return	Void
+ */
+static void porter_step1c(PorterWord *w)
+{
+	if(porter_ends(w, "y") && porter_vowel_in_stem(w)) w->b[w->k] = 'i';
+}
+
+/// @brief A suffix of the algorithm along with its replacement.
+typedef struct
+{
+	/// The suffix.
+	const char *suffix;
+	/// The string replacing it.
+	const char *replacement;
+}PorterRule;
+
+/**
+ * @brief Replaces the first suffix of a list ending the word,
+ * if the rest of the word is long enough.
+ *
+ * @param[in, out]	w		Pointer to the word.
+ * @param[in]		rules	Pointer to the list of suffixes, ending with a NULL suffix.
+ * @return	Void
+ */
+static void porter_rules(PorterWord *w, const PorterRule *rules)
+{
+	for(; rules->suffix != NULL; rules++)
+	{
+		if(porter_ends(w, rules->suffix))
+		{
+			porter_replace(w, rules->replacement);
+			return;
+		}
+	}
+}
+
+/**
+ * @brief Maps double suffixes to single ones, as in "relational" to "relate".
+ * @details The suffixes are grouped by their penultimate letter.
+ *
+ * @param[in, out]	w	Pointer to the word.
+ * @return	Void
+ */
+static void porter_step2(PorterWord *w)
+{
+	static const PorterRule a[] = {{"ational", "ate"}, {"tional", "tion"}, {NULL, NULL}};
+	static const PorterRule c[] = {{"enci", "ence"}, {"anci", "ance"}, {NULL, NULL}};
+	static const PorterRule e[] = {{"izer", "ize"}, {NULL, NULL}};
+	static const PorterRule l[] = {{"bli", "ble"}, {"alli", "al"}, {"entli", "ent"},
+			{"eli", "e"}, {"ousli", "ous"}, {NULL, NULL}};
+	static const PorterRule o[] = {{"ization", "ize"}, {"ation", "ate"}, {"ator", "ate"},
+			{NULL, NULL}};
+	static const PorterRule s[] = {{"alism", "al"}, {"iveness", "ive"}, {"fulness", "ful"},
+			{"ousness", "ous"}, {NULL, NULL}};
+	static const PorterRule t[] = {{"aliti", "al"}, {"iviti", "ive"}, {"biliti", "ble"},
+			{NULL, NULL}};
+	static const PorterRule g[] = {{"logi", "log"}, {NULL, NULL}};
+
+	switch(w->b[w->k - 1])
+	{
+	case 'a': porter_rules(w, a); break;
+	case 'c': porter_rules(w, c); break;
+	case 'e': porter_rules(w, e); break;
+	case 'l': porter_rules(w, l); break;
+	case 'o': porter_rules(w, o); break;
+	case 's': porter_rules(w, s); break;
+	case 't': porter_rules(w, t); break;
+	case 'g': porter_rules(w, g); break;
+	default: break;
+	}
+}
+
+/**
+ * @brief Removes or simplifies the suffixes -ic-, -full, -ness etc.,
+ * as in "electrical" to "electric".
+ * @details The suffixes are grouped by their last letter.
+ *
+ * @param[in, out]	w	Pointer to the word.
+ * @return	Void
+ */
+static void porter_step3(PorterWord *w)
+{
+	static const PorterRule e[] = {{"icate", "ic"}, {"ative", ""}, {"alize", "al"},
+			{NULL, NULL}};
+	static const PorterRule i[] = {{"iciti", "ic"}, {NULL, NULL}};
+	static const PorterRule l[] = {{"ical", "ic"}, {"ful", ""}, {NULL, NULL}};
+	static const PorterRule s[] = {{"ness", ""}, {NULL, NULL}};
+
+	switch(w->b[w->k])
+	{
+	case 'e': porter_rules(w, e); break;
+	case 'i': porter_rules(w, i); break;
+	case 'l': porter_rules(w, l); break;
+	case 's': porter_rules(w, s); break;
+	default: break;
+	}
+}
+
+/**
+ * @brief Removes the suffixes -ant, -ence etc. from words of more than
+ * one vowel-consonant sequence besides them, as in "adjustment" to "adjust".
+ *
+ * @param[in, out]	w	Pointer to the word.
+ * @return	Void
+ */
+static void porter_step4(PorterWord *w)
+{
+	bool found = false;
+	switch(w->b[w->k - 1])
+	{
+	case 'a': found = porter_ends(w, "al"); break;
+	case 'c': found = porter_ends(w, "ance") || porter_ends(w, "ence"); break;
+	case 'e': found = porter_ends(w, "er"); break;
+	case 'i': found = porter_ends(w, "ic"); break;
+	case 'l': found = porter_ends(w, "able") || porter_ends(w, "ible"); break;
+	case 'n':
+		found = porter_ends(w, "ant") || porter_ends(w, "ement") ||
+				porter_ends(w, "ment") || porter_ends(w, "ent");
+		break;
+	case 'o':
+		/// -ion is only removed after 's' or 't'.
+		found = (porter_ends(w, "ion") && (w->j >= 0) &&
+				((w->b[w->j] == 's') || (w->b[w->j] == 't'))) || porter_ends(w, "ou");
+		break;
+	case 's': found = porter_ends(w, "ism"); break;
+	case 't': found = porter_ends(w, "ate") || porter_ends(w, "iti"); break;
+	case 'u': found = porter_ends(w, "ous"); break;
+	case 'v': found = porter_ends(w, "ive"); break;
+	case 'z': found = porter_ends(w, "ize"); break;
+	default: break;
+	}
+	if(found && (porter_measure(w) > 1)) w->k = w->j;
+}
+
+/**
+ * @brief Removes a final 'e' and a double 'l' of long enough words,
+ * as in "probate" to "probat" and "controll" to "control".
+ *
+ * @param[in, out]	w	Pointer to the word.
+ * @return	Void
+ */
+static void porter_step5(PorterWord *w)
+{
+	w->j = w->k;
+	if(w->b[w->k] == 'e')
+	{
+		const int m = porter_measure(w);
+		if((m > 1) || ((m == 1) && !porter_cvc(w, w->k - 1))) w->k--;
+	}
+	if((w->b[w->k] == 'l') && porter_double_cons(w, w->k) && (porter_measure(w) > 1))
+		w->k--;
+}
+
+/**
+ * @brief Reduces a word of lowercase ASCII letters to its stem in place,
+ * following the algorithm of M.F. Porter, 1980, as published by its author.
+ *
+ * @param[in, out]	letters	Pointer to the characters of the word.
+ * @param[in]		len		The length of the word, at least 3.
+ * @return	The length of the stem.
+ */
+static uint32_t porter_stem(char *letters, const uint32_t len)
+{
+	PorterWord w = {letters, (int)len - 1, 0};
+	porter_step1ab(&w);
+	if(w.k > 0)
+	{
+		porter_step1c(&w);
+		porter_step2(&w);
+		porter_step3(&w);
+		porter_step4(&w);
+		porter_step5(&w);
+	}
+
+	return (uint32_t)(w.k + 1);
+}
+
+Stemmer* Stemmer_create(void)
+{
+	Stemmer *stem = (Stemmer*) calloc(1, sizeof(Stemmer));
+	if(stem == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the stemmer.\n");
+		return NULL;
+	}
+	stem->slots = (StemSlot*) calloc(STEM_CACHE_SLOTS, sizeof(StemSlot));
+	stem->capacity = INITIAL_STEM_LENGTH;
+	stem->letters = (char*) malloc(stem->capacity);
+	stem->result = WordBuffer_create(INITIAL_STEM_LENGTH);
+	if((stem->slots == NULL) || (stem->letters == NULL) || (stem->result == NULL))
+	{
+		fprintf(stderr, "Failed to allocate the stemmer.\n");
+		Stemmer_destroy(&stem);
+		return NULL;
+	}
+
+	return stem;
+}
+
+RetStatus Stemmer_stem(Stemmer *stem, const WordBuffer *wbuf, const WordBuffer **result)
+{
+	const char *word = WordBuffer_get_word(wbuf);
+	const uint32_t len = WordBuffer_get_length(wbuf);
+	*result = wbuf;
+	if(len < MIN_STEMMED_LENGTH) return SUCCESS;
+	for(uint32_t i = 0; i < len; i++)
+	{
+		if((word[i] < 'a') || (word[i] > 'z')) return SUCCESS;
+	}
+
+	/// The upper bits of the hash are the best mixed.
+	const uint64_t hash = fnvhash((const uint8_t*) word, len);
+	StemSlot *slot = &(stem->slots[(hash >> 32) & (STEM_CACHE_SLOTS - 1)]);
+	if((slot->hash == hash) && (slot->wordLen == len) && (memcmp(slot->word, word, len) == 0))
+	{
+		stem->hits++;
+		*result = stem->result;
+		return WordBuffer_set(stem->result, slot->stem, slot->stemLen);
+	}
+	stem->misses++;
+
+	if(len > stem->capacity)
+	{
+		char *letters = (char*) realloc(stem->letters, len);
+		if(letters == NULL)
+		{
+			fprintf(stderr, "Failed to grow the buffer of the stemmer.\n");
+			return GEN_FAIL;
+		}
+		stem->letters = letters;
+		stem->capacity = len;
+	}
+	memcpy(stem->letters, word, len);
+	const uint32_t stemLen = porter_stem(stem->letters, len);
+
+	/// Longer words are rare enough not to be worth caching.
+	if(len <= STEM_CACHE_WORD_LENGTH)
+	{
+		slot->hash = hash;
+		slot->wordLen = (uint8_t)len;
+		slot->stemLen = (uint8_t)stemLen;
+		memcpy(slot->word, word, len);
+		memcpy(slot->stem, stem->letters, stemLen);
+	}
+	*result = stem->result;
+
+	return WordBuffer_set(stem->result, stem->letters, stemLen);
+}
+
+void Stemmer_stats_print(const Stemmer *stem)
+{
+	const size_t lookups = stem->hits + stem->misses;
+	printf("\nStemmer statistics:\n");
+	printf("\tWords stemmed: %ld\n", lookups);
+	printf("\tStems found in cache: %ld (%.2f%%)\n", stem->hits,
+			(lookups != 0) ? 100.0 * (double)stem->hits / (double)lookups : 0.0);
+}
+
+void Stemmer_destroy(Stemmer **stem)
+{
+	free((*stem)->slots);
+	free((*stem)->letters);
+	if((*stem)->result != NULL) WordBuffer_destroy(&((*stem)->result));
+	free(*stem);
+	*stem = NULL;
+}
@@ -0,0 +1,74 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "stopwords.h"
+#include "wordset.h"
+
+struct StopWords
+{
+	/// The words excluded.
+	WordSet *set;
+	/// The number of words excluded so far.
+	size_t excluded;
+};
+
+StopWords* StopWords_create(const char *path, const TokenRules *rules)
+{
+	StopWords *stop = (StopWords*) calloc(1, sizeof(StopWords));
+	if(stop == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the stop words.\n");
+		return NULL;
+	}
+	stop->set = WordSet_create(path, rules, "stop words");
+	if(stop->set == NULL)
+	{
+		StopWords_destroy(&stop);
+		return NULL;
+	}
+
+	return stop;
+}
+
+bool StopWords_contains(StopWords *stop, const WordBuffer *wbuf)
+{
+	if(WordSet_find(stop->set, wbuf) == WORD_SET_MISSING) return false;
+
+	stop->excluded++;
+	return true;
+}
+
+uint64_t StopWords_signature(const StopWords *stop)
+{
+	return WordSet_signature(stop->set);
+}
+
+void StopWords_stats_print(const StopWords *stop)
+{
+	printf("\nStop Words statistics:\n");
+	printf("\tStop words: %u\n", WordSet_size(stop->set));
+	printf("\tWords excluded: %ld\n", stop->excluded);
+}
+
+void StopWords_destroy(StopWords **stop)
+{
+	if((*stop)->set != NULL) WordSet_destroy(&((*stop)->set));
+	free(*stop);
+	*stop = NULL;
+}
@@ -0,0 +1,545 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "timebuckets.h"
+#include <stdlib.h>
+#include <string.h>
+
+/// The initial capacity of the table of the bucketed counts.
+#define INITIAL_BUCKET_TABLE_CAPACITY 1024
+/// The occupancy percentage of the table triggering its expansion.
+#define BUCKET_TABLE_LOAD_LIMIT 70
+#define SECONDS_PER_DAY 86400
+
+/// @brief The count of a word in a bucket, the slot of the bucketed counts table.
+typedef struct
+{
+	/// The index of the bucket, its start time divided by its length.
+	int64_t bucket;
+	/// The reference of the word's string in the interning table.
+	size_t ref;
+	/// The number of appearances of the word in the bucket, 0 for an empty slot.
+	size_t count;
+}BucketCount;
+
+struct TimeBuckets
+{
+	/// The open addressing table of the counts, keyed by bucket and word.
+	BucketCount *counts;
+	/// The capacity of the table, a power of 2.
+	size_t capacity;
+	/// The number of occupied slots of the table.
+	size_t size;
+	/// The length of each bucket in seconds.
+	int64_t period;
+	/// The number of most common words printed per bucket, 0 for all.
+	size_t topK;
+	/// The number of expansions of the table.
+	uint64_t expansions;
+};
+
+TimeBuckets* TimeBuckets_create(const int64_t period, const size_t topK)
+{
+	TimeBuckets *tbk = (TimeBuckets*) calloc(1, sizeof(TimeBuckets));
+	if(tbk == NULL)
+	{
+		fprintf(stderr, "Initial allocation for the Time Buckets failed.\n");
+		return NULL;
+	}
+
+	tbk->period = period;
+	tbk->topK = topK;
+	tbk->capacity = INITIAL_BUCKET_TABLE_CAPACITY;
+	tbk->counts = (BucketCount*) calloc(tbk->capacity, sizeof(BucketCount));
+	if(tbk->counts == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the table of the Time Buckets.\n");
+		free(tbk);
+		return NULL;
+	}
+
+	return tbk;
+}
+
+/**
+ * @brief Converts a civil date to the number of days since the Epoch.
+ *
+ * @param[in]	year	The year.
+ * @param[in]	month	The month, from 1 to 12.
+ * @param[in]	day		The day of the month, from 1 to 31.
+ * @return	The number of days since 1970-01-01, negative for earlier dates.
+ */
+static int64_t days_from_civil(int64_t year, const uint32_t month, const uint32_t day)
+{
+	/// Years are counted from March, so that the leap day is the last one.
+	year -= (month <= 2);
+	const int64_t era = ((year >= 0) ? year : year - 399) / 400;
+	const uint32_t yearOfEra = (uint32_t)(year - era * 400);
+	const uint32_t dayOfYear = (153 * ((month > 2) ? month - 3 : month + 9) + 2) / 5
+			+ day - 1;
+	const uint32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100
+			+ dayOfYear;
+
+	return era * 146097 + (int64_t)dayOfEra - 719468;
+}
+
+/**
+ * @brief Converts a number of days since the Epoch to a civil date.
+ *
+ * @param[in]	days	The number of days since 1970-01-01.
+ * @param[out]	year	Pointer to the year.
+ * @param[out]	month	Pointer to the month, from 1 to 12.
+ * @param[out]	day		Pointer to the day of the month, from 1 to 31.
+ * @return	Void
+ */
+static void civil_from_days(int64_t days, int64_t *year, uint32_t *month, uint32_t *day)
+{
+	days += 719468;
+	const int64_t era = ((days >= 0) ? days : days - 146096) / 146097;
+	const uint32_t dayOfEra = (uint32_t)(days - era * 146097);
+	const uint32_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524
+			- dayOfEra / 146096) / 365;
+	const uint32_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4
+			- yearOfEra / 100);
+	const uint32_t monthFromMarch = (5 * dayOfYear + 2) / 153;
+
+	*day = dayOfYear - (153 * monthFromMarch + 2) / 5 + 1;
+	*month = (monthFromMarch < 10) ? monthFromMarch + 3 : monthFromMarch - 9;
+	*year = (int64_t)yearOfEra + era * 400 + (*month <= 2);
+}
+
+/**
+ * @brief Parses a fixed number of decimal digits.
+ *
+ * @param[in]		str			Pointer to the string.
+ * @param[in]		len			The length of the string.
+ * @param[in, out]	pos			Pointer to the position of the first digit,
+ * 								advanced past the digits on success.
+ * @param[in]		numDigits	The number of digits to be parsed.
+ * @param[out]		value		Pointer to the parsed value.
+ * @return	Returns true if all the digits are present.
+ */
+static bool digits_parse(const char *str, const size_t len, size_t *pos,
+		const uint32_t numDigits, int64_t *value)
+{
+	if(*pos + numDigits > len) return false;
+
+	int64_t val = 0;
+	for(uint32_t i = 0; i < numDigits; i++)
+	{
+		const char ch = str[*pos + i];
+		if((ch < '0') || (ch > '9')) return false;
+		val = val * 10 + (ch - '0');
+	}
+	*pos += numDigits;
+	*value = val;
+
+	return true;
+}
+
+/**
+ * @brief Evaluates whether a character of a string is a decimal digit.
+ *
+ * @param[in]	str	Pointer to the string.
+ * @param[in]	len	The length of the string.
+ * @param[in]	pos	The position of the character.
+ * @return	Returns true if the position is within the string and holds a digit.
+ */
+static inline bool digit_at(const char *str, const size_t len, const size_t pos)
+{
+	return (pos < len) && (str[pos] >= '0') && (str[pos] <= '9');
+}
+
+/**
+ * @brief Parses an ISO 8601 date, optionally followed by a time and a zone.
+ *
+ * @param[in]		str		Pointer to the string.
+ * @param[in]		len		The length of the string.
+ * @param[in, out]	pos		Pointer to the position of the date,
+ * 							advanced past the timestamp on success.
+ * @param[out]		time	Pointer to the parsed time in seconds since the Epoch.
+ * @return	Returns true if a valid date is present.
+ */
+static bool iso_time_parse(const char *str, const size_t len, size_t *pos, int64_t *time)
+{
+	size_t p = *pos;
+	int64_t year = 0, month = 0, day = 0;
+	if(!digits_parse(str, len, &p, 4, &year) || (p >= len) || (str[p++] != '-') ||
+		!digits_parse(str, len, &p, 2, &month) || (p >= len) || (str[p++] != '-') ||
+		!digits_parse(str, len, &p, 2, &day)) return false;
+	if((month < 1) || (month > 12) || (day < 1) || (day > 31)) return false;
+
+	int64_t hour = 0, minute = 0, second = 0;
+	/// The time is optional, so a separator followed by text is left to be counted.
+	if((p < len) && ((str[p] == 'T') || (str[p] == ' ')) && digit_at(str, len, p + 1))
+	{
+		size_t tp = p + 1;
+		if(digits_parse(str, len, &tp, 2, &hour) && (tp < len) && (str[tp++] == ':') &&
+			digits_parse(str, len, &tp, 2, &minute) && (hour < 24) && (minute < 60))
+		{
+			p = tp;
+			if((p < len) && (str[p] == ':') && digit_at(str, len, p + 1))
+			{
+				p++;
+				if(!digits_parse(str, len, &p, 2, &second) || (second > 60)) return false;
+				/// Fractions of a second do not affect the bucket.
+				if((p < len) && ((str[p] == '.') || (str[p] == ',')) &&
+					digit_at(str, len, p + 1))
+				{
+					p++;
+					while(digit_at(str, len, p)) p++;
+				}
+			}
+
+			/// The offset of the time zone converts the time to UTC.
+			if((p < len) && (str[p] == 'Z')) p++;
+			else if((p < len) && ((str[p] == '+') || (str[p] == '-')))
+			{
+				size_t zp = p + 1;
+				int64_t zoneHours = 0, zoneMinutes = 0;
+				if(digits_parse(str, len, &zp, 2, &zoneHours))
+				{
+					if((zp < len) && (str[zp] == ':')) zp++;
+					if(digits_parse(str, len, &zp, 2, &zoneMinutes))
+					{
+						const int64_t offset = zoneHours * 3600 + zoneMinutes * 60;
+						second -= (str[p] == '+') ? offset : -offset;
+						p = zp;
+					}
+				}
+			}
+		}
+	}
+
+	*time = days_from_civil(year, (uint32_t)month, (uint32_t)day) * SECONDS_PER_DAY
+			+ hour * 3600 + minute * 60 + second;
+	*pos = p;
+
+	return true;
+}
+
+/**
+ * @brief Parses a time in seconds or milliseconds since the Epoch.
+ * @details Only numbers of 9 or 10 digits are taken as seconds and of 13 digits
+ * as milliseconds, so that other numbers leading a line are not mistaken for times.
+ *
+ * @param[in]		str		Pointer to the string.
+ * @param[in]		len		The length of the string.
+ * @param[in, out]	pos		Pointer to the position of the number,
+ * 							advanced past the timestamp on success.
+ * @param[out]		time	Pointer to the parsed time in seconds since the Epoch.
+ * @return	Returns true if a valid time is present.
+ */
+static bool epoch_time_parse(const char *str, const size_t len, size_t *pos, int64_t *time)
+{
+	size_t p = *pos;
+	while(digit_at(str, len, p)) p++;
+
+	const size_t numDigits = p - *pos;
+	if((numDigits != 9) && (numDigits != 10) && (numDigits != 13)) return false;
+
+	int64_t value = 0;
+	size_t vp = *pos;
+	digits_parse(str, len, &vp, (uint32_t)numDigits, &value);
+	if(numDigits == 13) value /= 1000;
+	else if((p < len) && (str[p] == '.') && digit_at(str, len, p + 1))
+	{
+		p++;
+		while(digit_at(str, len, p)) p++;
+	}
+
+	*time = value;
+	*pos = p;
+
+	return true;
+}
+
+bool TimeBuckets_parse_timestamp(const char *line, const size_t len,
+		int64_t *time, size_t *tsLen)
+{
+	size_t pos = 0;
+	const bool bracketed = (len > 0) && (line[0] == '[');
+	if(bracketed) pos++;
+
+	if(!iso_time_parse(line, len, &pos, time) && !epoch_time_parse(line, len, &pos, time))
+		return false;
+
+	if(bracketed)
+	{
+		if((pos >= len) || (line[pos] != ']')) return false;
+		pos++;
+	}
+	/// A timestamp glued to the text that follows is rather part of a word.
+	if((pos < len) && (((line[pos] | 0x20) >= 'a') && ((line[pos] | 0x20) <= 'z')))
+		return false;
+
+	*tsLen = pos;
+	return true;
+}
+
+/**
+ * @brief Hash function of the key of a bucketed count.
+ *
+ * @param[in]	bucket	The index of the bucket.
+ * @param[in]	ref		The reference of the word.
+ * @return	The hash of the key.
+ */
+static inline uint64_t bucket_hash(const int64_t bucket, const size_t ref)
+{
+	/// The mixing of MurmurHash3's finalizer spreads the sequential
+	/// bucket indices and pool offsets over the whole table.
+	uint64_t h = ((uint64_t)bucket * 0x9e3779b97f4a7c15ULL) ^ (uint64_t)ref;
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 33;
+
+	return h;
+}
+
+/**
+ * @brief Finds the slot of a key in a table of bucketed counts.
+ *
+ * @param[in]	counts		Pointer to the slots of the table.
+ * @param[in]	capacity	The capacity of the table, a power of 2.
+ * @param[in]	bucket		The index of the bucket.
+ * @param[in]	ref			The reference of the word.
+ * @return	The index of the slot of the key, or of the empty slot to place it.
+ */
+static size_t slot_find(const BucketCount *counts, const size_t capacity,
+		const int64_t bucket, const size_t ref)
+{
+	const size_t mask = capacity - 1;
+	size_t index = (size_t)bucket_hash(bucket, ref) & mask;
+	while((counts[index].count != 0) &&
+		((counts[index].bucket != bucket) || (counts[index].ref != ref)))
+	{
+		index = (index + 1) & mask;
+	}
+
+	return index;
+}
+
+/**
+ * @brief Doubles the capacity of the table of bucketed counts.
+ *
+ * @param[in, out]	tbk	Pointer to the buckets.
+ * @return	Returns the status of the routine.
+ */
+static RetStatus table_expand(TimeBuckets *tbk)
+{
+	const size_t newCapacity = 2 * tbk->capacity;
+	BucketCount *newCounts = (BucketCount*) calloc(newCapacity, sizeof(BucketCount));
+	if(newCounts == NULL)
+	{
+		fprintf(stderr, "Failed to expand the table of the Time Buckets "
+				"to %ld slots.\n", newCapacity);
+		return GEN_FAIL;
+	}
+
+	for(size_t i = 0; i < tbk->capacity; i++)
+	{
+		const BucketCount *slot = &(tbk->counts[i]);
+		if(slot->count == 0) continue;
+		newCounts[slot_find(newCounts, newCapacity, slot->bucket, slot->ref)] = *slot;
+	}
+
+	free(tbk->counts);
+	tbk->counts = newCounts;
+	tbk->capacity = newCapacity;
+	tbk->expansions++;
+
+	return SUCCESS;
+}
+
+RetStatus TimeBuckets_count_word(TimeBuckets *tbk, WordHashTable *whtab,
+		const WordBuffer *wbuf, const int64_t time)
+{
+	/// The string is interned once, the buckets only keep its reference.
+	size_t ref = 0;
+	if(WordHashTable_count_word_ref(whtab, wbuf, &ref) != SUCCESS) return GEN_FAIL;
+
+	if((tbk->size + 1) * 100 > tbk->capacity * BUCKET_TABLE_LOAD_LIMIT)
+	{
+		if(table_expand(tbk) != SUCCESS) return GEN_FAIL;
+	}
+
+	/// Times before the Epoch are rounded down to the start of their bucket too.
+	const int64_t bucket = (time >= 0) ? time / tbk->period
+			: -((-time + tbk->period - 1) / tbk->period);
+	BucketCount *slot = &(tbk->counts[slot_find(tbk->counts, tbk->capacity, bucket, ref)]);
+	if(slot->count == 0)
+	{
+		slot->bucket = bucket;
+		slot->ref = ref;
+		tbk->size++;
+	}
+	slot->count++;
+
+	return SUCCESS;
+}
+
+/// @brief A bucketed count resolved to its word, as printed.
+typedef struct
+{
+	/// The index of the bucket.
+	int64_t bucket;
+	/// Pointer to the string of the word.
+	const char *word;
+	/// The number of appearances of the word in the bucket.
+	size_t count;
+}BucketLine;
+
+/**
+ * @brief Orders the lines chronologically and then alphabetically.
+ */
+static int line_compare_alph(const void *a, const void *b)
+{
+	const BucketLine *la = (const BucketLine*)a;
+	const BucketLine *lb = (const BucketLine*)b;
+	if(la->bucket != lb->bucket) return (la->bucket < lb->bucket) ? -1 : 1;
+
+	return strcmp(la->word, lb->word);
+}
+
+/**
+ * @brief Orders the lines chronologically and then by descending count,
+ * breaking ties alphabetically.
+ */
+static int line_compare_count(const void *a, const void *b)
+{
+	const BucketLine *la = (const BucketLine*)a;
+	const BucketLine *lb = (const BucketLine*)b;
+	if(la->bucket != lb->bucket) return (la->bucket < lb->bucket) ? -1 : 1;
+	if(la->count != lb->count) return (la->count > lb->count) ? -1 : 1;
+
+	return strcmp(la->word, lb->word);
+}
+
+/**
+ * @brief Prints the counts of a single bucket.
+ *
+ * @param[in]	tbk		Pointer to the buckets.
+ * @param[in]	lines	Pointer to the sorted lines of the bucket.
+ * @param[in]	numLines	The number of lines of the bucket.
+ * @return	Void
+ */
+static void bucket_print(const TimeBuckets *tbk, const BucketLine *lines,
+		const size_t numLines)
+{
+	const size_t numPrinted = ((tbk->topK != 0) && (tbk->topK < numLines))
+			? tbk->topK : numLines;
+
+	size_t totalCount = 0;
+	size_t maxCount = 0;
+	int maxWordLength = (int)strlen("Word");
+	for(size_t i = 0; i < numLines; i++)
+	{
+		totalCount += lines[i].count;
+		if(i >= numPrinted) continue;
+		if(lines[i].count > maxCount) maxCount = lines[i].count;
+		const int wordLength = (int)strlen(lines[i].word);
+		if(wordLength > maxWordLength) maxWordLength = wordLength;
+	}
+	const int maxDigitsCount = snprintf(NULL, 0, "%ld", maxCount);
+
+	/// The bucket is labeled by its start time in UTC.
+	const int64_t start = lines[0].bucket * tbk->period;
+	const int64_t days = ((start >= 0) ? start : start - SECONDS_PER_DAY + 1)
+			/ SECONDS_PER_DAY;
+	const int64_t secondOfDay = start - days * SECONDS_PER_DAY;
+	int64_t year = 0;
+	uint32_t month = 0, day = 0;
+	civil_from_days(days, &year, &month, &day);
+
+	printf("%s %04ld-%02u-%02u", (tbk->topK != 0) ? "Most common words of" :
+			"Number of appearances of each word in", year, month, day);
+	if(tbk->period < SECONDS_PER_DAY)
+	{
+		printf(" %02ld:%02ld", secondOfDay / 3600, (secondOfDay % 3600) / 60);
+	}
+	printf(" (%ld words):\n", totalCount);
+
+	const int numOfDashes = snprintf(NULL, 0, "    %-*s    %s\n",
+			maxWordLength, "Word", "Count") + 3;
+	printf("    %-*s    %s\n", maxWordLength, "Word", "Count");
+	for(int i = 0; i < numOfDashes; i++) putchar('-');
+	putchar('\n');
+	for(size_t i = 0; i < numPrinted; i++)
+	{
+		printf("    %-*s    %*ld\n", maxWordLength, lines[i].word,
+				maxDigitsCount, lines[i].count);
+	}
+	for(int i = 0; i < numOfDashes; i++) putchar('-');
+	putchar('\n');
+}
+
+RetStatus TimeBuckets_print(const TimeBuckets *tbk, const WordHashTable *whtab)
+{
+	if(tbk->size == 0) return SUCCESS;
+
+	BucketLine *lines = (BucketLine*) malloc(tbk->size * sizeof(BucketLine));
+	if(lines == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the output of the Time Buckets.\n");
+		return GEN_FAIL;
+	}
+
+	size_t numLines = 0;
+	for(size_t i = 0; i < tbk->capacity; i++)
+	{
+		const BucketCount *slot = &(tbk->counts[i]);
+		if(slot->count == 0) continue;
+		lines[numLines].bucket = slot->bucket;
+		lines[numLines].word = WordHashTable_ref_word(whtab, slot->ref);
+		lines[numLines].count = slot->count;
+		numLines++;
+	}
+	qsort(lines, numLines, sizeof(BucketLine),
+			(tbk->topK != 0) ? line_compare_count : line_compare_alph);
+
+	/// Lines are grouped by bucket, each group printed as a separate table.
+	size_t first = 0;
+	for(size_t i = 1; i <= numLines; i++)
+	{
+		if((i < numLines) && (lines[i].bucket == lines[first].bucket)) continue;
+		if(first != 0) printf("\n");
+		bucket_print(tbk, &(lines[first]), i - first);
+		first = i;
+	}
+	free(lines);
+
+	return SUCCESS;
+}
+
+void TimeBuckets_stats_print(const TimeBuckets *tbk)
+{
+	printf("\nTime Buckets statistics:\n");
+	printf("\tBucket length: %ld seconds\n", tbk->period);
+	printf("\tDistinct (bucket, word) counts: %ld\n", tbk->size);
+	printf("\tTable capacity: %ld slots, expanded %ld time(s)\n",
+			tbk->capacity, tbk->expansions);
+}
+
+void TimeBuckets_destroy(TimeBuckets **tbk)
+{
+	free((*tbk)->counts);
+	free(*tbk);
+	*tbk = NULL;
+}
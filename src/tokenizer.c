@@ -0,0 +1,1736 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tokenizer.h"
+#include "utils.h"
+#include "unicode.h"
+#include "regexdfa.h"
+#include "markup.h"
+#include <string.h>
+
+#ifdef CPU_ISA_X86
+#include <immintrin.h>
+#endif //CPU_ISA_X86
+/// The most bytes classified at once by the ASCII fast path.
+#define MAX_ASCII_BLOCK_LENGTH 64
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif //_MSC_VER
+
+#define INITIAL_WORD_BUFFER_LENGTH 16
+/// The symbols which can appear inside words by default.
+#define DEFAULT_INWORD_SYMBOLS "-'%,.@"
+/// The longest name of a tag or character reference which is told apart.
+#define MARKUP_NAME_LENGTH 32
+
+/**
+ * @brief Converts a Latin Alphabet letter to its lowercase form.
+ *
+ * @param[in]	let	Letter to be converted
+ * @return	Corresponding lowercase letter
+ */
+static inline int to_lowercase(const int let)
+{
+	return (let | 0x20);
+}
+
+/**
+ * @brief Evaluates whether the input character is a Latin Alphabet letter
+ *
+ * @param[in]	ch	Character to to be evaluated
+ * @return	True if the character is a Latin Alphabet letter
+ */
+static inline bool is_letter(const int ch)
+{
+	int lowch = to_lowercase(ch);
+
+	return (lowch >= 'a' && lowch <= 'z');
+}
+
+/**
+ * @brief Evaluates whether the input character is a number
+ *
+ * @param[in]	ch	Character to to be evaluated
+ * @return	True if the character is a number
+ */
+static inline bool is_number(const int ch)
+{
+	return (ch >= '0' && ch <= '9');
+}
+
+/// @brief The type of the processed character
+typedef enum
+{
+	/// The processed character is a letter or another word character.
+	LETTER,
+	/// The processed character is a number.
+	NUMBER,
+	/// The processed character is among those
+	/// which can possibly appear inside a word.
+	IN_WORD_SYMBOL,
+	/// The processed character is not used in words.
+	OTHER_SYMBOL
+}InputCharType;
+
+/// @brief The state of the input processor. Where the processing cursor is.
+typedef enum
+{
+	/// Input Processing Cursor is between words.
+	BETWEEN_WORDS,
+	/// Input Processing Cursor is inside a word, after an Alpharithmetic.
+	IN_WORD_AFTER_ALPHARITH,
+	/// Input Processing Cursor is inside a word, after an In Word character.
+	IN_WORD_AFTER_SYMBOL
+}InputState;
+
+/// @brief The markup construct being skipped, when stripping markup.
+typedef enum
+{
+	/// Text between markup, which is tokenized.
+	MARKUP_TEXT,
+	/// After a '<', which starts markup if followed by a tag name, '/', '!' or '?'.
+	MARKUP_TAG_OPEN,
+	/// The name of a tag.
+	MARKUP_TAG_NAME,
+	/// The rest of a tag, up to its '>'.
+	MARKUP_TAG,
+	/// A quoted attribute value, which may hold '>'.
+	MARKUP_TAG_QUOTE,
+	/// After "<!", telling comments and CDATA sections from declarations.
+	MARKUP_DECL,
+	/// A comment, up to its "-->".
+	MARKUP_COMMENT,
+	/// The content of a script or style element, up to its end tag.
+	MARKUP_RAW_TEXT,
+	/// A character reference after its '&'.
+	MARKUP_REFERENCE
+}MarkupState;
+
+/// @brief What the processing of a character does to the word being read.
+typedef enum
+{
+	/// The character is discarded.
+	ACTION_NONE,
+	/// The character is case folded and appended to the word.
+	ACTION_APPEND,
+	/// The In Word symbol is appended to the word as it is.
+	ACTION_APPEND_SYMBOL,
+	/// The word ended before the character and is pushed to the vector.
+	ACTION_PUSH,
+	/// The word ended before the symbol preceding the character,
+	/// so the symbol is discarded and the word is pushed to the vector.
+	ACTION_DROP_PUSH
+}TokenAction;
+
+/// @brief The transition of the input processor on a character.
+typedef struct
+{
+	/// The InputState after the character.
+	uint8_t next;
+	/// The TokenAction taken on the character.
+	uint8_t action;
+}Transition;
+
+/// The transitions of the input processor per InputState and InputCharType.
+static const Transition transitions[3][4] =
+{
+	/// While being between words only Alpharithmetic characters
+	/// change the input's state. Other characters can't be in
+	/// the beginning of a word.
+	[BETWEEN_WORDS] =
+	{
+		[LETTER] = {IN_WORD_AFTER_ALPHARITH, ACTION_APPEND},
+		[NUMBER] = {IN_WORD_AFTER_ALPHARITH, ACTION_APPEND},
+		[IN_WORD_SYMBOL] = {BETWEEN_WORDS, ACTION_NONE},
+		[OTHER_SYMBOL] = {BETWEEN_WORDS, ACTION_NONE}
+	},
+	/// After an Alpharithmetic, a new one signifies the continuation
+	/// of the word, an In Word Symbol that the word possibly ended
+	/// and any other symbol the definite end of the word.
+	[IN_WORD_AFTER_ALPHARITH] =
+	{
+		[LETTER] = {IN_WORD_AFTER_ALPHARITH, ACTION_APPEND},
+		[NUMBER] = {IN_WORD_AFTER_ALPHARITH, ACTION_APPEND},
+		[IN_WORD_SYMBOL] = {IN_WORD_AFTER_SYMBOL, ACTION_APPEND_SYMBOL},
+		[OTHER_SYMBOL] = {BETWEEN_WORDS, ACTION_PUSH}
+	},
+	/// After an In Word symbol only Alpharithmetic characters
+	/// signify the continuation of the word. Any symbol signifies
+	/// that the word had already ended before the previous symbol,
+	/// as 2 consecutive symbols are not allowed inside words.
+	[IN_WORD_AFTER_SYMBOL] =
+	{
+		[LETTER] = {IN_WORD_AFTER_ALPHARITH, ACTION_APPEND},
+		[NUMBER] = {IN_WORD_AFTER_ALPHARITH, ACTION_APPEND},
+		[IN_WORD_SYMBOL] = {BETWEEN_WORDS, ACTION_DROP_PUSH},
+		[OTHER_SYMBOL] = {BETWEEN_WORDS, ACTION_DROP_PUSH}
+	}
+};
+
+/**
+ * @brief Classifies a block of bytes with vector instructions.
+ * @details Unless the rules are case sensitive, the letters of the block
+ * are also converted to lowercase by setting their bit 0x20. Bytes beyond
+ * ASCII are negative as signed, so the signed comparisons of the kernels
+ * never take them for letters or digits.
+ *
+ * @param[in]	rules		Pointer to the token rules.
+ * @param[in]	bytes		Pointer to the block of bytes.
+ * @param[out]	lowered		Pointer to the block converted to lowercase.
+ * @param[out]	nonAscii	Pointer to the mask of the bytes beyond ASCII.
+ * @return	The mask of the ASCII word characters of the block.
+ */
+typedef uint64_t (*BlockClassifier)(const TokenRules *rules, const uint8_t *bytes,
+		uint8_t *lowered, uint64_t *nonAscii);
+
+/**
+ * @brief Appends to the word being read the run of ASCII word characters
+ * at the start of the bytes, converted to lowercase.
+ * @details The run is read whole, even if only part of it is appended.
+ * A scanner is built for each kernel, so that the kernel is chosen
+ * once per run instead of once per block.
+ *
+ * @param[in]		rules	Pointer to the token rules.
+ * @param[in, out]	wbuf	Pointer to the buffer of the word.
+ * @param[in]		bytes	Pointer to the bytes.
+ * @param[in]		len		The number of bytes.
+ * @param[in]		room	The maximum number of bytes to be appended.
+ * @param[out]		runLen	Pointer to the number of bytes of the run.
+ * @return	Return the status of the routine.
+ */
+typedef RetStatus (*WordRunAppender)(const TokenRules *rules, WordBuffer *wbuf,
+		const uint8_t *bytes, const size_t len, size_t room, size_t *runLen);
+
+/**
+ * @brief Counts the ASCII characters which are not word characters
+ * at the start of the bytes, which are skipped between words.
+ * @details A scanner is built for each kernel, see WordRunAppender.
+ *
+ * @param[in]	rules	Pointer to the token rules.
+ * @param[in]	bytes	Pointer to the bytes.
+ * @param[in]	len		The number of bytes.
+ * @return	The number of bytes to be skipped.
+ */
+typedef size_t (*SeparatorSkipper)(const TokenRules *rules, const uint8_t *bytes,
+		const size_t len);
+
+struct TokenRules
+{
+	/// The InputCharType of each ASCII character.
+	uint8_t types[256];
+	/// The byte appended to a word for each ASCII word character.
+	uint8_t folded[256];
+	/// The word characters which are neither letters nor digits.
+	uint8_t wordSymbols[128];
+	/// The number of word symbols.
+	uint32_t numWordSymbols;
+	/// Whether letters are kept in their case.
+	bool caseSensitive;
+	/// The DFA of the expression matching the words,
+	/// NULL if the words are split by the character types.
+	RegexDfa *dfa;
+	/// The hash of the expression matching the words.
+	uint64_t regexHash;
+	/// Whether HTML and XML markup is skipped and character references
+	/// are decoded before the input is tokenized.
+	bool stripMarkup;
+	/// The maximum number of bytes of a word, 0 for no limit.
+	size_t maxLength;
+	/// The instruction set extensions of the kernel classifying blocks of bytes.
+	CpuIsa isa;
+	/// The scanner appending runs of word characters with the kernel.
+	WordRunAppender appendRun;
+	/// The scanner skipping runs of separators with the kernel.
+	SeparatorSkipper skipSeparators;
+};
+
+struct Tokenizer
+{
+	/// The rules splitting the input into words.
+	const TokenRules *rules;
+	/// The buffer of the word being read.
+	WordBuffer *wbuf;
+	/// The state of the input processor.
+	InputState state;
+	/// The first bytes of a character split at the end of the bytes fed.
+	uint8_t pending[4];
+	/// The number of pending bytes.
+	uint32_t numPending;
+	/// The state of the DFA matching the candidate word.
+	uint32_t dfaState;
+	/// The bytes of the candidate word matched by the DFA so far.
+	uint8_t *match;
+	/// The number of bytes of the candidate word.
+	size_t matchLen;
+	/// The capacity of the buffer of the candidate word.
+	size_t matchCapacity;
+	/// The length of the longest match of the candidate word, 0 if none.
+	size_t acceptLen;
+	/// The bytes to be matched again after a candidate word ended.
+	uint8_t *replay;
+	/// The number of bytes to be matched again.
+	size_t replayLen;
+	/// The position of the next byte to be matched again.
+	size_t replayPos;
+	/// The capacity of the buffer of the bytes to be matched again.
+	size_t replayCapacity;
+	/// The markup construct being skipped.
+	MarkupState markupState;
+	/// The lowercase name of the tag, or the name of the character reference,
+	/// being read.
+	char markupName[MARKUP_NAME_LENGTH];
+	/// The number of characters of the name.
+	uint32_t markupNameLen;
+	/// Whether the tag being read is an end tag.
+	bool markupEndTag;
+	/// The last character of the tag being read which was not a space.
+	uint8_t markupLast;
+	/// The quote ending the attribute value being skipped.
+	uint8_t markupQuote;
+	/// The number of dashes before the end of a comment, or the number of
+	/// characters matched of the end tag of a script or style element.
+	uint32_t markupProgress;
+	/// The text decoded from markup which did not fit in the last chunk.
+	uint8_t markupText[MARKUP_NAME_LENGTH + 1];
+	/// The number of bytes of the decoded text.
+	uint32_t markupTextLen;
+	/// Whether the word being read is longer than the maximum length,
+	/// in which case no more characters are appended to it.
+	bool overflow;
+	/// Whether the DFA is skipping the rest of a match cut at the maximum length.
+	bool regexSkip;
+	/// The number of words cut at the maximum length.
+	size_t truncated;
+	/// The cache counting the most frequent words instead of pushing them,
+	/// NULL if none.
+	HotWords *hot;
+	/// The number of words counted in the cache.
+	size_t hotWords;
+};
+
+struct InputReader
+{
+	/// Pointer to the input stream.
+	InputStream *stream;
+	/// The tokenizer of the input.
+	Tokenizer *tok;
+	/// The bytes read from the stream.
+	const char *bytes;
+	/// The number of bytes read.
+	size_t length;
+	/// The position of the first byte read not yet tokenized.
+	size_t position;
+	/// The offset of the stream up to which the input has been tokenized.
+	uint64_t offset;
+	/// Whether the input is read line by line.
+	bool streamed;
+	/// Whether the end of the input was reached.
+	bool eof;
+};
+
+/**
+ * @brief Checks that the characters of a token rule option are ASCII symbols.
+ *
+ * @param[in]	chars	Pointer to the string of the characters.
+ * @param[in]	option	The name of the option, for the error message.
+ * @return	Returns true if the characters are valid.
+ */
+static bool rule_chars_check(const char *chars, const char *option)
+{
+	for(const char *ch = chars; *ch != '\0'; ch++)
+	{
+		const int c = (unsigned char)*ch;
+		if((c <= ' ') || (c >= 0x7F) || is_letter(c) || is_number(c))
+		{
+			fprintf(stderr, "The characters of %s must be ASCII symbols.\n", option);
+			return false;
+		}
+	}
+	return true;
+}
+
+TokenRules* TokenRules_create(const char *wordChars, const char *inwordSymbols,
+		const char *tokenRegex, const bool caseSensitive, const bool stripMarkup,
+		const size_t maxLength)
+{
+	if(wordChars == NULL) wordChars = "";
+	if(inwordSymbols == NULL) inwordSymbols = DEFAULT_INWORD_SYMBOLS;
+	if(!rule_chars_check(wordChars, "--word-chars") ||
+		!rule_chars_check(inwordSymbols, "--inword-symbols")) return NULL;
+
+	TokenRules *rules = (TokenRules*) calloc(1, sizeof(TokenRules));
+	if(rules == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the token rules.\n");
+		return NULL;
+	}
+	rules->caseSensitive = caseSensitive;
+	rules->stripMarkup = stripMarkup;
+	rules->maxLength = maxLength;
+
+	for(int c = 0; c < 256; c++)
+	{
+		rules->folded[c] = (uint8_t)c;
+		if(is_letter(c) && (c < 0x80))
+		{
+			rules->types[c] = LETTER;
+			if(!caseSensitive) rules->folded[c] = (uint8_t)to_lowercase(c);
+		}
+		else if(is_number(c)) rules->types[c] = NUMBER;
+		else rules->types[c] = OTHER_SYMBOL;
+	}
+	for(const char *ch = inwordSymbols; *ch != '\0'; ch++)
+	{
+		rules->types[(unsigned char)*ch] = IN_WORD_SYMBOL;
+	}
+	for(const char *ch = wordChars; *ch != '\0'; ch++)
+	{
+		const uint8_t c = (uint8_t)*ch;
+		if(rules->types[c] == IN_WORD_SYMBOL)
+		{
+			fprintf(stderr, "Character '%c' can not be both a word character "
+					"and an in word symbol.\n", *ch);
+			free(rules);
+			return NULL;
+		}
+		if(rules->types[c] == LETTER) continue;
+		rules->types[c] = LETTER;
+		rules->wordSymbols[rules->numWordSymbols++] = c;
+	}
+	if(tokenRegex != NULL)
+	{
+		rules->dfa = RegexDfa_compile(tokenRegex, !caseSensitive);
+		if(rules->dfa == NULL)
+		{
+			free(rules);
+			return NULL;
+		}
+		rules->regexHash = fnvhash((const uint8_t*)tokenRegex, (uint32_t)strlen(tokenRegex));
+	}
+	/// The kernel is selected once, for the best extensions of the CPU running it.
+	TokenRules_set_isa(rules, CpuIsa_detect());
+
+	return rules;
+}
+
+uint64_t TokenRules_signature(const TokenRules *rules)
+{
+	uint8_t desc[257];
+	memcpy(desc, rules->types, 128);
+	memcpy(desc + 128, rules->folded, 128);
+	desc[256] = (uint8_t)rules->caseSensitive;
+
+	uint64_t signature = fnvhash(desc, sizeof(desc)) ^ rules->regexHash;
+	/// The classes and foldings beyond ASCII change with the Unicode version.
+	signature ^= fnvhash((const uint8_t*)unicodeVersion, strlen(unicodeVersion));
+	if(rules->stripMarkup) signature ^= fnvhash((const uint8_t*)"markup", 6);
+	if(rules->maxLength != 0)
+	{
+		const uint64_t maxLength = (uint64_t)rules->maxLength;
+		signature ^= fnvhash((const uint8_t*)&maxLength, sizeof(maxLength));
+	}
+
+	return signature;
+}
+
+void TokenRules_destroy(TokenRules **rules)
+{
+	if((*rules)->dfa != NULL) RegexDfa_destroy(&((*rules)->dfa));
+	free(*rules);
+	*rules = NULL;
+}
+
+/**
+ * @brief Categorizes a character on the available InputCharTypes
+ * @details ASCII characters are looked up in the table of the rules,
+ * while the rest are classified by their Unicode class and invalid
+ * UTF-8 sequences separate words.
+ *
+ * @param[in]	rules	Pointer to the token rules.
+ * @param[in]	ch		Code point of the character to to be evaluated
+ * @return	The InputCharType of the character
+ */
+static inline InputCharType get_char_type(const TokenRules *rules, const uint32_t ch)
+{
+	if(ch < 0x80) return (InputCharType)rules->types[ch];
+	if(ch == UNICODE_INVALID) return OTHER_SYMBOL;
+
+	switch(unicode_class(ch))
+	{
+		case UNICODE_LETTER: return LETTER;
+		case UNICODE_NUMBER: return NUMBER;
+		default: return OTHER_SYMBOL;
+	}
+}
+
+Tokenizer* Tokenizer_create(const TokenRules *rules)
+{
+	Tokenizer *tok = (Tokenizer*) calloc(1, sizeof(Tokenizer));
+	if(tok == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the tokenizer.\n");
+		return NULL;
+	}
+
+	tok->wbuf = WordBuffer_create(INITIAL_WORD_BUFFER_LENGTH);
+	if(tok->wbuf == NULL)
+	{
+		fprintf(stderr, "Failed to initialize word buffer for input "
+				"processing.\n");
+		free(tok);
+		return NULL;
+	}
+	tok->rules = rules;
+	tok->state = BETWEEN_WORDS;
+	if(rules->dfa != NULL) tok->dfaState = rules->dfa->start;
+
+	return tok;
+}
+
+/**
+ * @brief Appends the bytes of a character to the word being read.
+ * @details Unless the rules are case sensitive, letters are replaced
+ * by their simple case folding, which for ASCII letters is their
+ * lowercase form.
+ *
+ * @param[in]		rules		Pointer to the token rules.
+ * @param[in, out]	wbuf		Pointer to the buffer of the word.
+ * @param[in]		chBytes		Pointer to the UTF-8 bytes of the character.
+ * @param[in]		numBytes	The number of bytes of the character.
+ * @param[in]		cp			The code point of the character.
+ * @return	Return the status of the routine.
+ */
+static inline RetStatus char_append(const TokenRules *rules, WordBuffer *wbuf,
+		const uint8_t *chBytes, const uint32_t numBytes, const uint32_t cp)
+{
+	if(numBytes == 1) return WordBuffer_push_char(wbuf, rules->folded[chBytes[0]]);
+
+	const uint32_t folded = rules->caseSensitive ? cp : unicode_fold(cp);
+	if(folded == cp) return WordBuffer_append(wbuf, (const char*)chBytes, numBytes);
+
+	/// The folding can be encoded in fewer bytes than the character.
+	uint8_t foldedBytes[4];
+	const uint32_t numFolded = utf8_encode(folded, foldedBytes);
+	return WordBuffer_append(wbuf, (const char*)foldedBytes, numFolded);
+}
+
+/**
+ * @brief Gets the number of bytes which can still be appended to the word
+ * being read before it is known to be longer than the maximum length.
+ *
+ * @param[in]	tok	Pointer to the tokenizer.
+ * @return	The number of bytes, SIZE_MAX if there is no maximum length.
+ */
+static inline size_t word_room(const Tokenizer *tok)
+{
+	const size_t maxLength = tok->rules->maxLength;
+	if(maxLength == 0) return SIZE_MAX;
+	if(tok->overflow) return 0;
+	/// One more byte than the maximum length tells longer words apart.
+	const size_t length = WordBuffer_get_length(tok->wbuf);
+	return (length <= maxLength) ? maxLength + 1 - length : 0;
+}
+
+/**
+ * @brief Pushes the word being read to the vector, or counts it in the cache
+ * of hot words, cut at the maximum length if it is longer, and clears it.
+ * @details Words are cut at the start of the character crossing
+ * the maximum length, so that they remain valid UTF-8, unless that is
+ * their first character.
+ *
+ * @param[in, out]	tok	Pointer to the tokenizer.
+ * @param[out]		vec	Pointer to the Word Buffer Vector to be filled.
+ * @return	Return the status of the routine.
+ */
+static RetStatus word_push(Tokenizer *tok, WordBufferVector *vec)
+{
+	WordBuffer *wbuf = tok->wbuf;
+	if(tok->overflow)
+	{
+		const char *letters = WordBuffer_get_word(wbuf);
+		const uint32_t length = WordBuffer_get_length(wbuf);
+		uint32_t cut = (length < tok->rules->maxLength) ? length : (uint32_t)tok->rules->maxLength;
+		while((cut != 0) && (((uint8_t)letters[cut] & 0xC0) == 0x80)) cut--;
+		/// A first character longer than the maximum length is kept whole.
+		if(cut == 0)
+		{
+			for(cut = 1; (cut < length) && (((uint8_t)letters[cut] & 0xC0) == 0x80); cut++);
+		}
+		for(uint32_t i = cut; i < length; i++) WordBuffer_backspace(wbuf);
+		tok->overflow = false;
+		tok->truncated++;
+	}
+	/// The words held by the cache are counted without being copied.
+	if((tok->hot != NULL) && HotWords_hit(tok->hot, wbuf)) tok->hotWords++;
+	else if(WordBufferVector_push(vec, wbuf) != SUCCESS) return GEN_FAIL;
+	WordBuffer_clear(wbuf);
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Processes the next character of the stream, pushing to the vector
+ * the word it concludes, if any.
+ * @details Once a word is longer than the maximum length,
+ * the rest of its characters are dropped.
+ *
+ * @param[in, out]	tok			Pointer to the tokenizer.
+ * @param[out]		vec			Pointer to the Word Buffer Vector to be filled.
+ * @param[in]		chBytes		Pointer to the UTF-8 bytes of the character.
+ * @param[in]		numBytes	The number of bytes of the character.
+ * @param[in]		cp			The code point of the character.
+ * @param[in]		inpType		The InputCharType of the character.
+ * @return	Return the status of the routine.
+ */
+static inline RetStatus Tokenizer_push_char(Tokenizer *tok, WordBufferVector *vec,
+		const uint8_t *chBytes, const uint32_t numBytes, const uint32_t cp,
+		const InputCharType inpType)
+{
+	WordBuffer *wbuf = tok->wbuf;
+	const Transition trans = transitions[tok->state][inpType];
+	switch(trans.action)
+	{
+		case ACTION_APPEND:
+		{
+			if(tok->overflow) break;
+			if(char_append(tok->rules, wbuf, chBytes, numBytes, cp) != SUCCESS)
+				return GEN_FAIL;
+			if((tok->rules->maxLength != 0) &&
+				(WordBuffer_get_length(wbuf) > tok->rules->maxLength)) tok->overflow = true;
+			break;
+		}
+		case ACTION_APPEND_SYMBOL:
+		{
+			/// The symbol may still be dropped, so it does not make the word
+			/// longer than the maximum length by itself.
+			if(tok->overflow) break;
+			if(WordBuffer_push_char(wbuf, chBytes[0]) != SUCCESS) return GEN_FAIL;
+			break;
+		}
+		case ACTION_DROP_PUSH:
+		{
+			/// Symbols are not appended to words longer than the maximum length.
+			if(!tok->overflow) WordBuffer_backspace(wbuf);
+			if(word_push(tok, vec) != SUCCESS) return GEN_FAIL;
+			break;
+		}
+		case ACTION_PUSH:
+		{
+			if(word_push(tok, vec) != SUCCESS) return GEN_FAIL;
+			break;
+		}
+		default:
+		{
+			break;
+		}
+	}
+	tok->state = (InputState)trans.next;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Gets the position of the least significant set bit of a mask.
+ *
+ * @param[in]	mask	The mask, which can not be 0.
+ * @return	The position of the bit.
+ */
+static inline uint32_t lowest_set_bit(const uint64_t mask)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+	unsigned long pos;
+	_BitScanForward64(&pos, mask);
+	return (uint32_t)pos;
+#elif defined(_MSC_VER)
+	unsigned long pos;
+	if(_BitScanForward(&pos, (unsigned long)mask)) return (uint32_t)pos;
+	_BitScanForward(&pos, (unsigned long)(mask >> 32));
+	return (uint32_t)pos + 32;
+#else
+	return (uint32_t)__builtin_ctzll(mask);
+#endif //_MSC_VER
+}
+
+#ifdef CPU_ISA_X86
+/**
+ * @brief Classifies a block of 16 bytes with SSE2 instructions.
+ * @details See BlockClassifier.
+ */
+ISA_TARGET("sse2")
+static inline uint64_t block_classify_sse2(const TokenRules *rules, const uint8_t *bytes,
+		uint8_t *lowered, uint64_t *nonAscii)
+{
+	const __m128i block = _mm_loadu_si128((const __m128i*)bytes);
+	const __m128i lower = _mm_or_si128(block, _mm_set1_epi8(0x20));
+	const __m128i isLetter = _mm_and_si128(
+			_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+			_mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+	const __m128i isDigit = _mm_and_si128(
+			_mm_cmpgt_epi8(block, _mm_set1_epi8('0' - 1)),
+			_mm_cmplt_epi8(block, _mm_set1_epi8('9' + 1)));
+	__m128i isWord = _mm_or_si128(isLetter, isDigit);
+	for(uint32_t i = 0; i < rules->numWordSymbols; i++)
+	{
+		isWord = _mm_or_si128(isWord, _mm_cmpeq_epi8(block,
+				_mm_set1_epi8((char)rules->wordSymbols[i])));
+	}
+	_mm_storeu_si128((__m128i*)lowered, rules->caseSensitive ? block :
+			_mm_or_si128(block, _mm_and_si128(isLetter, _mm_set1_epi8(0x20))));
+	*nonAscii = (uint32_t)_mm_movemask_epi8(block);
+	return (uint32_t)_mm_movemask_epi8(isWord);
+}
+
+/**
+ * @brief Classifies a block of 32 bytes with AVX2 instructions.
+ * @details See BlockClassifier.
+ */
+ISA_TARGET("avx2")
+static inline uint64_t block_classify_avx2(const TokenRules *rules, const uint8_t *bytes,
+		uint8_t *lowered, uint64_t *nonAscii)
+{
+	const __m256i block = _mm256_loadu_si256((const __m256i*)bytes);
+	const __m256i lower = _mm256_or_si256(block, _mm256_set1_epi8(0x20));
+	const __m256i isLetter = _mm256_and_si256(
+			_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+			_mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+	const __m256i isDigit = _mm256_and_si256(
+			_mm256_cmpgt_epi8(block, _mm256_set1_epi8('0' - 1)),
+			_mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), block));
+	__m256i isWord = _mm256_or_si256(isLetter, isDigit);
+	for(uint32_t i = 0; i < rules->numWordSymbols; i++)
+	{
+		isWord = _mm256_or_si256(isWord, _mm256_cmpeq_epi8(block,
+				_mm256_set1_epi8((char)rules->wordSymbols[i])));
+	}
+	_mm256_storeu_si256((__m256i*)lowered, rules->caseSensitive ? block :
+			_mm256_or_si256(block, _mm256_and_si256(isLetter, _mm256_set1_epi8(0x20))));
+	*nonAscii = (uint32_t)_mm256_movemask_epi8(block);
+	return (uint32_t)_mm256_movemask_epi8(isWord);
+}
+
+/**
+ * @brief Classifies a block of 64 bytes with AVX-512BW instructions,
+ * whose comparisons yield the masks directly.
+ * @details See BlockClassifier.
+ */
+ISA_TARGET("avx512f,avx512bw")
+static inline uint64_t block_classify_avx512bw(const TokenRules *rules, const uint8_t *bytes,
+		uint8_t *lowered, uint64_t *nonAscii)
+{
+	const __m512i block = _mm512_loadu_si512((const void*)bytes);
+	const __m512i lower = _mm512_or_si512(block, _mm512_set1_epi8(0x20));
+	const __mmask64 isLetter =
+			_mm512_cmpgt_epi8_mask(lower, _mm512_set1_epi8('a' - 1)) &
+			_mm512_cmplt_epi8_mask(lower, _mm512_set1_epi8('z' + 1));
+	const __mmask64 isDigit =
+			_mm512_cmpgt_epi8_mask(block, _mm512_set1_epi8('0' - 1)) &
+			_mm512_cmplt_epi8_mask(block, _mm512_set1_epi8('9' + 1));
+	__mmask64 isWord = isLetter | isDigit;
+	for(uint32_t i = 0; i < rules->numWordSymbols; i++)
+	{
+		isWord |= _mm512_cmpeq_epi8_mask(block, _mm512_set1_epi8((char)rules->wordSymbols[i]));
+	}
+	_mm512_storeu_si512((void*)lowered, rules->caseSensitive ? block :
+			_mm512_mask_blend_epi8(isLetter, block, lower));
+	*nonAscii = (uint64_t)_mm512_movepi8_mask(block);
+	return (uint64_t)isWord;
+}
+#endif //CPU_ISA_X86
+
+/**
+ * @brief Evaluates whether the input character is an ASCII word character.
+ *
+ * @param[in]	rules	Pointer to the token rules.
+ * @param[in]	ch		Character to to be evaluated
+ * @return	True if the character is an ASCII letter, digit or word symbol
+ */
+static inline bool is_word_char(const TokenRules *rules, const uint8_t ch)
+{
+	return (ch < 0x80) && (rules->types[ch] <= NUMBER);
+}
+
+/**
+ * @brief Appends to the word being read the run of ASCII word characters
+ * at the start of the bytes with a kernel, see WordRunAppender.
+ * @details Inlined into the scanner of each kernel, which is then
+ * called directly for each block.
+ *
+ * @param[in]	classify	The kernel, NULL if the bytes are classified one by one.
+ * @param[in]	blockLength	The number of bytes classified at once by the kernel.
+ */
+ISA_INLINE RetStatus word_run_append_blocks(const TokenRules *rules, WordBuffer *wbuf,
+		const uint8_t *bytes, const size_t len, size_t room, size_t *runLen,
+		const BlockClassifier classify, const uint32_t blockLength)
+{
+	/// The mask of a block made only of word characters.
+	const uint64_t blockMask = (blockLength == 64) ? UINT64_MAX :
+			(((uint64_t)1 << blockLength) - 1);
+	size_t run = 0;
+	uint8_t lowered[MAX_ASCII_BLOCK_LENGTH];
+	while((classify != NULL) && (run + blockLength <= len))
+	{
+		uint64_t nonAscii = 0;
+		const uint64_t word = classify(rules, bytes + run, lowered, &nonAscii);
+		const uint32_t blockRun = (word == blockMask) ? blockLength : lowest_set_bit(~word);
+		const uint32_t appended = (blockRun < room) ? blockRun : (uint32_t)room;
+		if((appended != 0) &&
+			(WordBuffer_append(wbuf, (const char*)lowered, appended) != SUCCESS))
+			return GEN_FAIL;
+		room -= appended;
+		run += blockRun;
+		if(blockRun < blockLength)
+		{
+			*runLen = run;
+			return SUCCESS;
+		}
+	}
+	/// The bytes left, fewer than a block, are appended one by one.
+	while((run < len) && is_word_char(rules, bytes[run]))
+	{
+		if(room != 0)
+		{
+			if(WordBuffer_push_char(wbuf, rules->folded[bytes[run]]) != SUCCESS)
+				return GEN_FAIL;
+			room--;
+		}
+		run++;
+	}
+	*runLen = run;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Counts the separators at the start of the bytes with a kernel,
+ * see SeparatorSkipper and word_run_append_blocks.
+ *
+ * @param[in]	classify	The kernel, NULL if the bytes are classified one by one.
+ * @param[in]	blockLength	The number of bytes classified at once by the kernel.
+ */
+ISA_INLINE size_t separators_skip_blocks(const TokenRules *rules, const uint8_t *bytes,
+		const size_t len, const BlockClassifier classify, const uint32_t blockLength)
+{
+	size_t skip = 0;
+	uint8_t lowered[MAX_ASCII_BLOCK_LENGTH];
+	while((classify != NULL) && (skip + blockLength <= len))
+	{
+		uint64_t nonAscii = 0;
+		const uint64_t stop = classify(rules, bytes + skip, lowered, &nonAscii) | nonAscii;
+		if(stop != 0) return skip + lowest_set_bit(stop);
+		skip += blockLength;
+	}
+	while((skip < len) && (bytes[skip] < 0x80) && !is_word_char(rules, bytes[skip])) skip++;
+
+	return skip;
+}
+
+/// The scanners classifying the bytes one by one.
+static RetStatus word_run_append_scalar(const TokenRules *rules, WordBuffer *wbuf,
+		const uint8_t *bytes, const size_t len, size_t room, size_t *runLen)
+{
+	return word_run_append_blocks(rules, wbuf, bytes, len, room, runLen, NULL, 0);
+}
+
+static size_t separators_skip_scalar(const TokenRules *rules, const uint8_t *bytes,
+		const size_t len)
+{
+	return separators_skip_blocks(rules, bytes, len, NULL, 0);
+}
+
+#ifdef CPU_ISA_X86
+/// The scanners classifying blocks of 16 bytes with SSE2 instructions.
+ISA_TARGET("sse2")
+static RetStatus word_run_append_sse2(const TokenRules *rules, WordBuffer *wbuf,
+		const uint8_t *bytes, const size_t len, size_t room, size_t *runLen)
+{
+	return word_run_append_blocks(rules, wbuf, bytes, len, room, runLen,
+			block_classify_sse2, 16);
+}
+
+ISA_TARGET("sse2")
+static size_t separators_skip_sse2(const TokenRules *rules, const uint8_t *bytes,
+		const size_t len)
+{
+	return separators_skip_blocks(rules, bytes, len, block_classify_sse2, 16);
+}
+
+/// The scanners classifying blocks of 32 bytes with AVX2 instructions.
+ISA_TARGET("avx2")
+static RetStatus word_run_append_avx2(const TokenRules *rules, WordBuffer *wbuf,
+		const uint8_t *bytes, const size_t len, size_t room, size_t *runLen)
+{
+	return word_run_append_blocks(rules, wbuf, bytes, len, room, runLen,
+			block_classify_avx2, 32);
+}
+
+ISA_TARGET("avx2")
+static size_t separators_skip_avx2(const TokenRules *rules, const uint8_t *bytes,
+		const size_t len)
+{
+	return separators_skip_blocks(rules, bytes, len, block_classify_avx2, 32);
+}
+
+/// The scanners classifying blocks of 64 bytes with AVX-512BW instructions.
+ISA_TARGET("avx512f,avx512bw")
+static RetStatus word_run_append_avx512bw(const TokenRules *rules, WordBuffer *wbuf,
+		const uint8_t *bytes, const size_t len, size_t room, size_t *runLen)
+{
+	return word_run_append_blocks(rules, wbuf, bytes, len, room, runLen,
+			block_classify_avx512bw, 64);
+}
+
+ISA_TARGET("avx512f,avx512bw")
+static size_t separators_skip_avx512bw(const TokenRules *rules, const uint8_t *bytes,
+		const size_t len)
+{
+	return separators_skip_blocks(rules, bytes, len, block_classify_avx512bw, 64);
+}
+#endif //CPU_ISA_X86
+
+RetStatus TokenRules_set_isa(TokenRules *rules, const CpuIsa isa)
+{
+	if(isa > CpuIsa_detect())
+	{
+		fprintf(stderr, "The CPU does not support %s.\n", CpuIsa_name(isa));
+		return GEN_FAIL;
+	}
+
+	rules->isa = isa;
+	rules->appendRun = word_run_append_scalar;
+	rules->skipSeparators = separators_skip_scalar;
+	switch(isa)
+	{
+#ifdef CPU_ISA_X86
+		case ISA_AVX512BW:
+			rules->appendRun = word_run_append_avx512bw;
+			rules->skipSeparators = separators_skip_avx512bw;
+			break;
+		case ISA_AVX2:
+			rules->appendRun = word_run_append_avx2;
+			rules->skipSeparators = separators_skip_avx2;
+			break;
+		case ISA_SSE2:
+			rules->appendRun = word_run_append_sse2;
+			rules->skipSeparators = separators_skip_sse2;
+			break;
+#endif //CPU_ISA_X86
+		default:
+			break;
+	}
+
+	return SUCCESS;
+}
+
+CpuIsa TokenRules_isa(const TokenRules *rules)
+{
+	return rules->isa;
+}
+
+/**
+ * @brief Grows a byte buffer of the tokenizer to hold at least
+ * the requested number of bytes.
+ *
+ * @param[in, out]	buffer		Pointer to the pointer of the buffer.
+ * @param[in, out]	capacity	Pointer to the capacity of the buffer.
+ * @param[in]		needed		The number of bytes to be held.
+ * @return	Return the status of the routine.
+ */
+static RetStatus bytes_reserve(uint8_t **buffer, size_t *capacity, const size_t needed)
+{
+	if(needed <= *capacity) return SUCCESS;
+
+	size_t newCapacity = (*capacity == 0) ? INITIAL_WORD_BUFFER_LENGTH : *capacity;
+	while(newCapacity < needed) newCapacity *= 2;
+	uint8_t *newBuffer = (uint8_t*) realloc(*buffer, newCapacity);
+	if(newBuffer == NULL)
+	{
+		fprintf(stderr, "Failed to grow the buffers of the tokenizer.\n");
+		return GEN_FAIL;
+	}
+	*buffer = newBuffer;
+	*capacity = newCapacity;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Appends the bytes of a word matched by the expression
+ * to the word buffer, case folded unless the rules are case sensitive.
+ *
+ * @param[in]		rules	Pointer to the token rules.
+ * @param[in, out]	wbuf	Pointer to the buffer of the word.
+ * @param[in]		bytes	Pointer to the bytes of the word.
+ * @param[in]		len		The number of bytes of the word.
+ * @return	Return the status of the routine.
+ */
+static RetStatus match_append(const TokenRules *rules, WordBuffer *wbuf,
+		const uint8_t *bytes, const size_t len)
+{
+	size_t pos = 0;
+	while(pos < len)
+	{
+		uint32_t cp = 0;
+		uint32_t numBytes = utf8_decode(bytes + pos, len - pos, &cp);
+		/// The expression can match part of a character,
+		/// in which case the bytes are kept as they are.
+		if(numBytes == 0)
+		{
+			numBytes = (uint32_t)(len - pos);
+			cp = UNICODE_INVALID;
+		}
+		if(cp == UNICODE_INVALID)
+		{
+			if(WordBuffer_append(wbuf, (const char*)(bytes + pos), numBytes) != SUCCESS)
+				return GEN_FAIL;
+		}
+		else if(char_append(rules, wbuf, bytes + pos, numBytes, cp) != SUCCESS)
+			return GEN_FAIL;
+		pos += numBytes;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Concludes the candidate word which the DFA can not extend.
+ * @details The longest match of the candidate, if any, is pushed to the
+ * vector. The bytes after it, or after the first byte of the candidate
+ * if nothing matched, are matched again before the rest of the input.
+ *
+ * @param[in, out]	tok	Pointer to the tokenizer.
+ * @param[out]		vec	Pointer to the Word Buffer Vector to be filled.
+ * @return	Return the status of the routine.
+ */
+static RetStatus regex_match_end(Tokenizer *tok, WordBufferVector *vec)
+{
+	const size_t cut = (tok->acceptLen != 0) ? tok->acceptLen : 1;
+	if(tok->acceptLen != 0)
+	{
+		WordBuffer_clear(tok->wbuf);
+		if((match_append(tok->rules, tok->wbuf, tok->match, tok->acceptLen) != SUCCESS) ||
+			(word_push(tok, vec) != SUCCESS)) return GEN_FAIL;
+	}
+
+	/// The rest of the candidate precedes the bytes left to be matched again.
+	const size_t rest = tok->matchLen - cut;
+	const size_t left = tok->replayLen - tok->replayPos;
+	if(bytes_reserve(&(tok->replay), &(tok->replayCapacity), rest + left) != SUCCESS)
+		return GEN_FAIL;
+	memmove(tok->replay + rest, tok->replay + tok->replayPos, left);
+	memcpy(tok->replay, tok->match + cut, rest);
+	tok->replayPos = 0;
+	tok->replayLen = rest + left;
+
+	tok->matchLen = 0;
+	tok->acceptLen = 0;
+	tok->dfaState = tok->rules->dfa->start;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Tokenizes the next bytes of the stream with the DFA of the rules,
+ * pushing to the vector the longest matches of the expression.
+ * @details At each position, the longest match of the expression is a word,
+ * while positions where nothing matches are skipped.
+ *
+ * @param[in, out]	tok			Pointer to the tokenizer.
+ * @param[out]		vec			Pointer to the Word Buffer Vector to be filled.
+ * @param[in]		in			Pointer to the bytes.
+ * @param[in]		len			The number of bytes.
+ * @param[in]		maxWords	The maximum number of words in the vector, 0 for no limit.
+ * @param[out]		consumed	Pointer to the number of bytes tokenized.
+ * @return	Return the status of the routine.
+ */
+static RetStatus regex_feed(Tokenizer *tok, WordBufferVector *vec, const uint8_t *in,
+		const size_t len, const size_t maxWords, size_t *consumed)
+{
+	const RegexDfa *dfa = tok->rules->dfa;
+	size_t pos = 0;
+	while((maxWords == 0) || (WordBufferVector_get_size(vec) < maxWords))
+	{
+		/// The bytes to be matched again precede those of the input.
+		const bool replayed = (tok->replayPos < tok->replayLen);
+		if(!replayed && (pos == len)) break;
+		const uint8_t b = replayed ? tok->replay[tok->replayPos] : in[pos];
+
+		const uint32_t next = dfa->transitions[(size_t)tok->dfaState * dfa->numClasses
+				+ dfa->classes[b]];
+		if(tok->regexSkip)
+		{
+			/// The byte ending the match is matched again from the start.
+			if(next == REGEX_DEAD_STATE)
+			{
+				tok->regexSkip = false;
+				tok->dfaState = dfa->start;
+				continue;
+			}
+			if(replayed) tok->replayPos++;
+			else pos++;
+			tok->dfaState = next;
+			continue;
+		}
+		if((next == REGEX_DEAD_STATE) && (tok->matchLen != 0))
+		{
+			/// The byte is matched again after the candidate word ends.
+			if(regex_match_end(tok, vec) != SUCCESS) return GEN_FAIL;
+			continue;
+		}
+		if((next != REGEX_DEAD_STATE) && (tok->matchLen != 0) &&
+			(tok->matchLen == tok->rules->maxLength))
+		{
+			/// A match longer than the maximum length is cut and the rest of it
+			/// skipped without being held, while a shorter match ends the candidate.
+			if(tok->acceptLen != tok->matchLen)
+			{
+				if(regex_match_end(tok, vec) != SUCCESS) return GEN_FAIL;
+				continue;
+			}
+			WordBuffer_clear(tok->wbuf);
+			tok->overflow = true;
+			if((match_append(tok->rules, tok->wbuf, tok->match, tok->matchLen) != SUCCESS) ||
+				(word_push(tok, vec) != SUCCESS)) return GEN_FAIL;
+			tok->matchLen = 0;
+			tok->acceptLen = 0;
+			tok->regexSkip = true;
+			continue;
+		}
+
+		if(replayed) tok->replayPos++;
+		else pos++;
+		/// Bytes which can not start a word are skipped.
+		if(next == REGEX_DEAD_STATE) continue;
+
+		if((tok->matchLen == tok->matchCapacity) &&
+			(bytes_reserve(&(tok->match), &(tok->matchCapacity), tok->matchLen + 1) != SUCCESS))
+			return GEN_FAIL;
+		tok->match[tok->matchLen++] = b;
+		tok->dfaState = next;
+		if(dfa->accepting[next]) tok->acceptLen = tok->matchLen;
+	}
+
+	/// Stopping after a word, the bytes left to be matched again which were
+	/// fed with these bytes are returned, so that the consumed bytes end at
+	/// the word.
+	const size_t left = tok->replayLen - tok->replayPos;
+	const size_t returned = (left < pos) ? left : pos;
+	tok->replayLen -= returned;
+	*consumed = pos - returned;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Concludes the candidate words of the DFA at the end of the stream.
+ *
+ * @param[in, out]	tok	Pointer to the tokenizer.
+ * @param[out]		vec	Pointer to the Word Buffer Vector to be filled.
+ * @return	Return the status of the routine.
+ */
+static RetStatus regex_finish(Tokenizer *tok, WordBufferVector *vec)
+{
+	size_t consumed = 0;
+	do
+	{
+		if(regex_feed(tok, vec, NULL, 0, 0, &consumed) != SUCCESS) return GEN_FAIL;
+		if((tok->matchLen != 0) && (regex_match_end(tok, vec) != SUCCESS)) return GEN_FAIL;
+	} while(tok->replayPos < tok->replayLen);
+	tok->regexSkip = false;
+	tok->dfaState = tok->rules->dfa->start;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Tokenizes the next bytes of text, pushing to the vector
+ * the words they conclude.
+ *
+ * @param[in, out]	tok			Pointer to the tokenizer.
+ * @param[out]		vec			Pointer to the Word Buffer Vector to be filled.
+ * @param[in]		in			Pointer to the bytes.
+ * @param[in]		len			The number of bytes.
+ * @param[in]		maxWords	The maximum number of words in the vector, 0 for no limit.
+ * @param[out]		consumed	Pointer to the number of bytes tokenized.
+ * @return	Return the status of the routine.
+ */
+static RetStatus text_feed(Tokenizer *tok, WordBufferVector *vec, const uint8_t *in,
+		const size_t len, const size_t maxWords, size_t *consumed)
+{
+	size_t pos = 0;
+	if(tok->rules->dfa != NULL) return regex_feed(tok, vec, in, len, maxWords, consumed);
+
+	/// A character split at the end of the previous bytes is completed first.
+	if(tok->numPending != 0)
+	{
+		uint8_t chBytes[4];
+		memcpy(chBytes, tok->pending, tok->numPending);
+		const size_t numNew = (len < 4 - tok->numPending) ? len : 4 - tok->numPending;
+		memcpy(chBytes + tok->numPending, in, numNew);
+
+		uint32_t cp = 0;
+		const uint32_t numBytes = utf8_decode(chBytes, tok->numPending + numNew, &cp);
+		if(numBytes == 0)
+		{
+			memcpy(tok->pending + tok->numPending, in, len);
+			tok->numPending += (uint32_t)len;
+			*consumed = len;
+			return SUCCESS;
+		}
+		/// An invalid sequence is dropped along with all the pending bytes.
+		pos = (numBytes > tok->numPending) ? numBytes - tok->numPending : 0;
+		tok->numPending = 0;
+		if(Tokenizer_push_char(tok, vec, chBytes, numBytes, cp,
+				get_char_type(tok->rules, cp)) != SUCCESS) return GEN_FAIL;
+	}
+
+	while((pos < len) && ((maxWords == 0) || (WordBufferVector_get_size(vec) < maxWords)))
+	{
+		/// Runs of ASCII characters, in or between words, are processed
+		/// in blocks, leaving only their last character and the rest
+		/// of the characters to be processed one by one.
+		if(tok->state == BETWEEN_WORDS)
+		{
+			pos += tok->rules->skipSeparators(tok->rules, in + pos, len - pos);
+			if(pos == len) break;
+		}
+		else
+		{
+			size_t run = 0;
+			const size_t room = word_room(tok);
+			if(tok->rules->appendRun(tok->rules, tok->wbuf, in + pos, len - pos, room, &run)
+					!= SUCCESS)
+				return GEN_FAIL;
+			/// Appending the whole room makes the word longer than the maximum length.
+			if((run != 0) && (run >= room)) tok->overflow = true;
+			if(run != 0)
+			{
+				tok->state = IN_WORD_AFTER_ALPHARITH;
+				pos += run;
+				if(pos == len) break;
+			}
+		}
+
+		uint32_t cp = 0;
+		const uint32_t numBytes = utf8_decode(in + pos, len - pos, &cp);
+		if(numBytes == 0)
+		{
+			/// The rest of the character is expected with the next bytes.
+			tok->numPending = (uint32_t)(len - pos);
+			memcpy(tok->pending, in + pos, tok->numPending);
+			pos = len;
+			break;
+		}
+		if(Tokenizer_push_char(tok, vec, in + pos, numBytes, cp,
+				get_char_type(tok->rules, cp)) != SUCCESS) return GEN_FAIL;
+		pos += numBytes;
+	}
+	*consumed = pos;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Checks whether the vector holds the maximum number of words.
+ *
+ * @param[in]	vec			Pointer to the Word Buffer Vector.
+ * @param[in]	maxWords	The maximum number of words in the vector, 0 for no limit.
+ * @return	Returns true if no more words are to be pushed.
+ */
+static inline bool vector_full(WordBufferVector *vec, const size_t maxWords)
+{
+	return (maxWords != 0) && (WordBufferVector_get_size(vec) >= maxWords);
+}
+
+/**
+ * @brief Tokenizes text decoded from markup, keeping the bytes which
+ * do not fit in the chunk to be tokenized first in the next one.
+ *
+ * @param[in, out]	tok			Pointer to the tokenizer.
+ * @param[out]		vec			Pointer to the Word Buffer Vector to be filled.
+ * @param[in]		text		Pointer to the bytes of the text.
+ * @param[in]		len			The number of bytes, at most MARKUP_NAME_LENGTH + 1.
+ * @param[in]		maxWords	The maximum number of words in the vector, 0 for no limit.
+ * @return	Return the status of the routine.
+ */
+static RetStatus markup_text_emit(Tokenizer *tok, WordBufferVector *vec,
+		const uint8_t *text, const size_t len, const size_t maxWords)
+{
+	size_t fed = 0;
+	if(text_feed(tok, vec, text, len, maxWords, &fed) != SUCCESS) return GEN_FAIL;
+	memmove(tok->markupText, text + fed, len - fed);
+	tok->markupTextLen = (uint32_t)(len - fed);
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Tokenizes the bytes of a character reference which turned out
+ * not to be one, as text.
+ *
+ * @param[in, out]	tok			Pointer to the tokenizer.
+ * @param[out]		vec			Pointer to the Word Buffer Vector to be filled.
+ * @param[in]		maxWords	The maximum number of words in the vector, 0 for no limit.
+ * @return	Return the status of the routine.
+ */
+static RetStatus markup_reference_emit(Tokenizer *tok, WordBufferVector *vec,
+		const size_t maxWords)
+{
+	uint8_t text[MARKUP_NAME_LENGTH + 1];
+	text[0] = '&';
+	memcpy(text + 1, tok->markupName, tok->markupNameLen);
+	tok->markupState = MARKUP_TEXT;
+
+	return markup_text_emit(tok, vec, text, tok->markupNameLen + 1, maxWords);
+}
+
+/**
+ * @brief Concludes a tag at its '>'.
+ * @details The content of script and style elements is skipped up to their end tag.
+ *
+ * @param[in, out]	tok	Pointer to the tokenizer.
+ * @return	Void
+ */
+static void markup_tag_end(Tokenizer *tok)
+{
+	const char *name = tok->markupName;
+	const uint32_t nameLen = tok->markupNameLen;
+	const bool rawText = !tok->markupEndTag && (tok->markupLast != '/') &&
+			(((nameLen == 6) && (memcmp(name, "script", 6) == 0)) ||
+			((nameLen == 5) && (memcmp(name, "style", 5) == 0)));
+	tok->markupState = rawText ? MARKUP_RAW_TEXT : MARKUP_TEXT;
+	tok->markupProgress = 0;
+}
+
+/**
+ * @brief Tokenizes the next bytes of HTML or XML, skipping its markup.
+ * @details Tags, comments, declarations, processing instructions and the
+ * content of script and style elements are skipped, each tag separating
+ * words like a space, while character references are decoded. Chunks
+ * only end in text, so that the bytes consumed end outside markup.
+ *
+ * @param[in, out]	tok			Pointer to the tokenizer.
+ * @param[out]		vec			Pointer to the Word Buffer Vector to be filled.
+ * @param[in]		in			Pointer to the bytes.
+ * @param[in]		len			The number of bytes.
+ * @param[in]		maxWords	The maximum number of words in the vector, 0 for no limit.
+ * @param[out]		consumed	Pointer to the number of bytes tokenized.
+ * @return	Return the status of the routine.
+ */
+static RetStatus markup_feed(Tokenizer *tok, WordBufferVector *vec, const uint8_t *in,
+		const size_t len, const size_t maxWords, size_t *consumed)
+{
+	size_t pos = 0;
+	/// Decoded text which did not fit in the last chunk comes first.
+	if((tok->markupTextLen != 0) && !vector_full(vec, maxWords))
+	{
+		uint8_t text[MARKUP_NAME_LENGTH + 1];
+		const size_t textLen = tok->markupTextLen;
+		memcpy(text, tok->markupText, textLen);
+		if(markup_text_emit(tok, vec, text, textLen, maxWords) != SUCCESS) return GEN_FAIL;
+	}
+
+	while((pos < len) && (tok->markupTextLen == 0) && !vector_full(vec, maxWords))
+	{
+		const uint8_t ch = in[pos];
+		switch(tok->markupState)
+		{
+			case MARKUP_TEXT:
+			{
+				/// Runs of text up to the next markup are tokenized as they are.
+				const uint8_t *tagStart = (const uint8_t*) memchr(in + pos, '<', len - pos);
+				const size_t runEnd = (tagStart != NULL) ? (size_t)(tagStart - in) : len;
+				const uint8_t *refStart = (const uint8_t*) memchr(in + pos, '&', runEnd - pos);
+				const size_t textEnd = (refStart != NULL) ? (size_t)(refStart - in) : runEnd;
+				if(textEnd != pos)
+				{
+					size_t fed = 0;
+					if(text_feed(tok, vec, in + pos, textEnd - pos, maxWords, &fed) != SUCCESS)
+						return GEN_FAIL;
+					pos += fed;
+					break;
+				}
+				if(ch == '&')
+				{
+					tok->markupState = MARKUP_REFERENCE;
+					tok->markupNameLen = 0;
+					pos++;
+					break;
+				}
+				/// Markup separates words like a space. If that ends the chunk,
+				/// the '<' is processed again with the next one, so that it
+				/// does not end inside markup.
+				size_t fed = 0;
+				if(text_feed(tok, vec, (const uint8_t*)" ", 1, maxWords, &fed) != SUCCESS)
+					return GEN_FAIL;
+				if(vector_full(vec, maxWords)) break;
+				tok->markupState = MARKUP_TAG_OPEN;
+				pos++;
+				break;
+			}
+			case MARKUP_TAG_OPEN:
+			{
+				tok->markupNameLen = 0;
+				tok->markupEndTag = (ch == '/');
+				tok->markupLast = 0;
+				if(is_letter(ch))
+				{
+					tok->markupState = MARKUP_TAG_NAME;
+					break;
+				}
+				if(ch == '!') tok->markupState = MARKUP_DECL;
+				else if(ch == '?') tok->markupState = MARKUP_TAG;
+				else if(ch == '/') tok->markupState = MARKUP_TAG_NAME;
+				else
+				{
+					/// A '<' starting no markup is text, which the space replaced.
+					tok->markupState = MARKUP_TEXT;
+					break;
+				}
+				pos++;
+				break;
+			}
+			case MARKUP_TAG_NAME:
+			{
+				if(is_letter(ch) || is_number(ch) || (ch == '-') || (ch == ':') || (ch == '_'))
+				{
+					if(tok->markupNameLen < MARKUP_NAME_LENGTH)
+						tok->markupName[tok->markupNameLen++] =
+								(char)(is_letter(ch) ? to_lowercase(ch) : ch);
+					pos++;
+				}
+				else tok->markupState = MARKUP_TAG;
+				break;
+			}
+			case MARKUP_TAG:
+			{
+				pos++;
+				if(ch == '>') markup_tag_end(tok);
+				/// Quotes only delimit attribute values, after a '='.
+				else if(((ch == '"') || (ch == '\'')) && (tok->markupLast == '='))
+				{
+					tok->markupQuote = ch;
+					tok->markupState = MARKUP_TAG_QUOTE;
+				}
+				else if((ch != ' ') && (ch != '\t') && (ch != '\n') && (ch != '\r'))
+					tok->markupLast = ch;
+				break;
+			}
+			case MARKUP_TAG_QUOTE:
+			{
+				const uint8_t *quoteEnd = (const uint8_t*) memchr(in + pos, tok->markupQuote,
+						len - pos);
+				if(quoteEnd == NULL)
+				{
+					pos = len;
+					break;
+				}
+				pos = (size_t)(quoteEnd - in) + 1;
+				tok->markupLast = tok->markupQuote;
+				tok->markupState = MARKUP_TAG;
+				break;
+			}
+			case MARKUP_DECL:
+			{
+				/// The characters after "<!" start a comment with "--" and
+				/// a CDATA section, whose content is text, with "[CDATA[".
+				const uint32_t n = tok->markupNameLen;
+				const bool comment = (n < 2) && ("--"[n] == (char)ch) &&
+						(memcmp(tok->markupName, "--", n) == 0);
+				const bool cdata = (n < 7) && ("[CDATA["[n] == (char)ch) &&
+						(memcmp(tok->markupName, "[CDATA[", n) == 0);
+				if(!comment && !cdata)
+				{
+					tok->markupNameLen = 0;
+					tok->markupState = MARKUP_TAG;
+					break;
+				}
+				tok->markupName[tok->markupNameLen++] = (char)ch;
+				pos++;
+				if(comment && (tok->markupNameLen == 2))
+				{
+					tok->markupState = MARKUP_COMMENT;
+					tok->markupProgress = 0;
+				}
+				else if(cdata && (tok->markupNameLen == 7)) tok->markupState = MARKUP_TEXT;
+				break;
+			}
+			case MARKUP_COMMENT:
+			{
+				pos++;
+				if((ch == '>') && (tok->markupProgress >= 2)) tok->markupState = MARKUP_TEXT;
+				else tok->markupProgress = (ch == '-') ? tok->markupProgress + 1 : 0;
+				break;
+			}
+			case MARKUP_RAW_TEXT:
+			{
+				/// The end tag is "</" followed by the name of the element.
+				const uint32_t progress = tok->markupProgress;
+				if(progress == 0)
+				{
+					const uint8_t *tagStart = (const uint8_t*) memchr(in + pos, '<', len - pos);
+					pos = (tagStart != NULL) ? (size_t)(tagStart - in) + 1 : len;
+					tok->markupProgress = (tagStart != NULL) ? 1 : 0;
+				}
+				else if(progress == tok->markupNameLen + 2)
+				{
+					if(is_letter(ch) || is_number(ch) || (ch == '-') || (ch == ':') || (ch == '_'))
+						tok->markupProgress = 0;
+					else
+					{
+						tok->markupEndTag = true;
+						tok->markupNameLen = 0;
+						tok->markupLast = 0;
+						tok->markupState = MARKUP_TAG;
+					}
+				}
+				else if(((progress == 1) && (ch == '/')) || ((progress > 1) &&
+						(to_lowercase(ch) == tok->markupName[progress - 2])))
+				{
+					tok->markupProgress++;
+					pos++;
+				}
+				else tok->markupProgress = 0;
+				break;
+			}
+			case MARKUP_REFERENCE:
+			{
+				if((is_letter(ch) || is_number(ch) || (ch == '#')) &&
+					(tok->markupNameLen < MARKUP_NAME_LENGTH))
+				{
+					tok->markupName[tok->markupNameLen++] = (char)ch;
+					pos++;
+					break;
+				}
+				uint32_t cp = 0;
+				if((ch == ';') &&
+					markup_reference_decode(tok->markupName, tok->markupNameLen, &cp))
+				{
+					pos++;
+					uint8_t text[4];
+					tok->markupState = MARKUP_TEXT;
+					if(markup_text_emit(tok, vec, text, utf8_encode(cp, text), maxWords) != SUCCESS)
+						return GEN_FAIL;
+				}
+				/// Anything else than a reference is text.
+				else if(markup_reference_emit(tok, vec, maxWords) != SUCCESS) return GEN_FAIL;
+				break;
+			}
+		}
+	}
+	*consumed = pos;
+
+	return SUCCESS;
+}
+
+RetStatus Tokenizer_feed(Tokenizer *tok, WordBufferVector *vec, const char *bytes,
+		const size_t len, const size_t maxWords, size_t *consumed)
+{
+	const uint8_t *in = (const uint8_t*)bytes;
+	if(tok->rules->stripMarkup) return markup_feed(tok, vec, in, len, maxWords, consumed);
+
+	return text_feed(tok, vec, in, len, maxWords, consumed);
+}
+
+RetStatus Tokenizer_finish(Tokenizer *tok, WordBufferVector *vec)
+{
+	/// Markup is skipped across the lines of timestamped input, while
+	/// text decoded from it ends with them.
+	if(tok->rules->stripMarkup)
+	{
+		if((tok->markupTextLen != 0) &&
+			(markup_text_emit(tok, vec, tok->markupText, tok->markupTextLen, 0) != SUCCESS))
+			return GEN_FAIL;
+		if((tok->markupState == MARKUP_REFERENCE) &&
+			(markup_reference_emit(tok, vec, 0) != SUCCESS)) return GEN_FAIL;
+	}
+	if(tok->rules->dfa != NULL) return regex_finish(tok, vec);
+
+	/// A character left incomplete at the end of the stream is invalid.
+	if(tok->numPending != 0)
+	{
+		static const uint8_t invalidChar = 0xFF;
+		tok->numPending = 0;
+		if(Tokenizer_push_char(tok, vec, &invalidChar, 1, UNICODE_INVALID, OTHER_SYMBOL) != SUCCESS)
+			return GEN_FAIL;
+	}
+
+	switch(tok->state)
+	{
+		/// At the end of the input, if the last character was alpharithmetic
+		/// the word was concluded and the containing buffer is pushed
+		/// to the vector.
+		case IN_WORD_AFTER_ALPHARITH:
+		{
+			if(word_push(tok, vec) != SUCCESS) return GEN_FAIL;
+			break;
+		}
+		/// At the end of the input, if the last character was an In Word
+		/// symbol, the word was concluded before that, so the extra character
+		/// is discarded and the containing buffer is pushed to the vector.
+		case IN_WORD_AFTER_SYMBOL:
+		{
+			if(!tok->overflow) WordBuffer_backspace(tok->wbuf);
+			if(word_push(tok, vec) != SUCCESS) return GEN_FAIL;
+			break;
+		}
+		default:
+		{
+			break;
+		}
+	}
+
+	WordBuffer_clear(tok->wbuf);
+	tok->state = BETWEEN_WORDS;
+
+	return SUCCESS;
+}
+
+size_t Tokenizer_truncated(const Tokenizer *tok)
+{
+	return tok->truncated;
+}
+
+void Tokenizer_reset(Tokenizer *tok)
+{
+	const Tokenizer kept = *tok;
+	memset(tok, 0, sizeof(Tokenizer));
+	tok->rules = kept.rules;
+	tok->wbuf = kept.wbuf;
+	tok->match = kept.match;
+	tok->matchCapacity = kept.matchCapacity;
+	tok->replay = kept.replay;
+	tok->replayCapacity = kept.replayCapacity;
+	tok->hot = kept.hot;
+
+	WordBuffer_clear(tok->wbuf);
+	tok->state = BETWEEN_WORDS;
+	if(tok->rules->dfa != NULL) tok->dfaState = tok->rules->dfa->start;
+}
+
+void Tokenizer_destroy(Tokenizer **tok)
+{
+	WordBuffer_destroy(&((*tok)->wbuf));
+	free((*tok)->match);
+	free((*tok)->replay);
+	free(*tok);
+	*tok = NULL;
+}
+
+InputReader* InputReader_create(InputStream *stream, const bool streamed,
+		const TokenRules *rules, HotWords *hot)
+{
+	InputReader *inp = (InputReader*) calloc(1, sizeof(InputReader));
+	if(inp == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the input reader.\n");
+		return NULL;
+	}
+
+	inp->tok = Tokenizer_create(rules);
+	if(inp->tok == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the tokenizer of the input reader.\n");
+		InputReader_destroy(&inp);
+		return NULL;
+	}
+	inp->tok->hot = hot;
+	inp->stream = stream;
+	inp->offset = InputStream_offset(stream);
+	inp->streamed = streamed;
+
+	return inp;
+}
+
+void InputReader_reset(InputReader *inp, InputStream *stream)
+{
+	Tokenizer_reset(inp->tok);
+	inp->stream = stream;
+	inp->bytes = NULL;
+	inp->length = 0;
+	inp->position = 0;
+	inp->offset = InputStream_offset(stream);
+	inp->eof = false;
+}
+
+/**
+ * @brief Reads the next bytes of the input stream, which are
+ * tokenized in place.
+ *
+ * @param[in, out]	inp	Pointer to the reader.
+ * @return	Return the status of the routine.
+ */
+static RetStatus buffer_fill(InputReader *inp)
+{
+	inp->position = 0;
+	inp->length = 0;
+	/// A stream is read a line at a time, as soon as each line arrives.
+	return InputStream_next(inp->stream, inp->streamed, &(inp->bytes), &(inp->length));
+}
+
+RetStatus InputReader_read(InputReader *inp, WordBufferVector *vec, const size_t maxWords)
+{
+	/// The input is processed a buffer at a time, until the chunk is full.
+	while(!inp->eof && ((maxWords == 0) || (WordBufferVector_get_size(vec) < maxWords)))
+	{
+		if(inp->position == inp->length)
+		{
+			if(buffer_fill(inp) != SUCCESS) return GEN_FAIL;
+			if(inp->length == 0)
+			{
+				inp->eof = true;
+				return Tokenizer_finish(inp->tok, vec);
+			}
+		}
+
+		size_t consumed = 0;
+		if(Tokenizer_feed(inp->tok, vec, inp->bytes + inp->position,
+				inp->length - inp->position, maxWords, &consumed) != SUCCESS)
+			return GEN_FAIL;
+		inp->position += consumed;
+		inp->offset += consumed;
+	}
+
+	return SUCCESS;
+}
+
+bool InputReader_eof(const InputReader *inp)
+{
+	return inp->eof;
+}
+
+uint64_t InputReader_offset(const InputReader *inp)
+{
+	return inp->offset;
+}
+
+size_t InputReader_truncated(const InputReader *inp)
+{
+	return Tokenizer_truncated(inp->tok);
+}
+
+size_t InputReader_hot_words(const InputReader *inp)
+{
+	return inp->tok->hotWords;
+}
+
+void InputReader_destroy(InputReader **inp)
+{
+	if((*inp)->tok != NULL) Tokenizer_destroy(&((*inp)->tok));
+	free(*inp);
+	*inp = NULL;
+}
@@ -0,0 +1,173 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tokenstream.h"
+#include "utils.h"
+#include <string.h>
+
+/// The number of ids buffered before being written to the stream.
+#define ID_BUFFER_LENGTH (1 << 16)
+
+/// Identifies the binary stream of word ids.
+static const char idsMagic[8] = {'W', 'C', 'T', 'O', 'K', 'I', 'D', '1'};
+/// Identifies the binary dictionary of word ids.
+static const char dictMagic[8] = {'W', 'C', 'T', 'O', 'K', 'D', 'C', '1'};
+
+struct TokenStream
+{
+	/// The file of the stream of ids.
+	FILE *idsFile;
+	/// The file of the dictionary of the ids.
+	FILE *dictFile;
+	/// The ids not yet written to the stream.
+	uint32_t *ids;
+	/// The number of ids buffered.
+	size_t numBuffered;
+	/// The total number of ids appended to the stream.
+	uint64_t numTokens;
+};
+
+TokenStream* TokenStream_create(const char *path)
+{
+	TokenStream *ts = (TokenStream*) calloc(1, sizeof(TokenStream));
+	if(ts == NULL)
+	{
+		fprintf(stderr, "Initial allocation for the Token Stream failed.\n");
+		return NULL;
+	}
+
+	ts->ids = (uint32_t*) malloc(ID_BUFFER_LENGTH * sizeof(uint32_t));
+	const size_t pathLen = strlen(path);
+	char *dictPath = (char*) malloc(pathLen + sizeof(".dict"));
+	if((ts->ids == NULL) || (dictPath == NULL))
+	{
+		fprintf(stderr, "Failed to allocate the buffers of the Token Stream.\n");
+		free(dictPath);
+		TokenStream_destroy(&ts);
+		return NULL;
+	}
+	memcpy(dictPath, path, pathLen);
+	memcpy(dictPath + pathLen, ".dict", sizeof(".dict"));
+
+	if(!file_open(&(ts->idsFile), path, "wb") ||
+		!file_open(&(ts->dictFile), dictPath, "wb"))
+	{
+		fprintf(stderr, "Failed to create the token stream: %s\n", path);
+		free(dictPath);
+		TokenStream_destroy(&ts);
+		return NULL;
+	}
+	free(dictPath);
+
+	if(fwrite(idsMagic, sizeof(idsMagic), 1, ts->idsFile) != 1)
+	{
+		fprintf(stderr, "Failed to write the header of the token stream.\n");
+		TokenStream_destroy(&ts);
+		return NULL;
+	}
+
+	return ts;
+}
+
+/**
+ * @brief Writes the buffered ids to the stream.
+ *
+ * @param[in, out]	ts	Pointer to the stream.
+ * @return	Returns the status of the routine.
+ */
+static RetStatus ids_flush(TokenStream *ts)
+{
+	if(fwrite(ts->ids, sizeof(uint32_t), ts->numBuffered, ts->idsFile) != ts->numBuffered)
+	{
+		fprintf(stderr, "Failed to write %ld ids to the token stream.\n", ts->numBuffered);
+		return GEN_FAIL;
+	}
+	ts->numBuffered = 0;
+
+	return SUCCESS;
+}
+
+RetStatus TokenStream_count_word(TokenStream *ts, WordHashTable *whtab,
+		const WordBuffer *wbuf)
+{
+	uint32_t id = 0;
+	if(WordHashTable_count_word_id(whtab, wbuf, &id) != SUCCESS) return GEN_FAIL;
+
+	ts->ids[ts->numBuffered++] = id;
+	ts->numTokens++;
+	if(ts->numBuffered == ID_BUFFER_LENGTH) return ids_flush(ts);
+
+	return SUCCESS;
+}
+
+RetStatus TokenStream_finish(TokenStream *ts, const WordHashTable *whtab)
+{
+	if((ids_flush(ts) != SUCCESS) || (fflush(ts->idsFile) != 0))
+	{
+		fprintf(stderr, "Failed to complete the token stream.\n");
+		return GEN_FAIL;
+	}
+
+	/// The dictionary lists the words in the order of their ids, so that
+	/// the id of each word is its position.
+	const uint32_t numIds = WordHashTable_num_ids(whtab);
+	if((fwrite(dictMagic, sizeof(dictMagic), 1, ts->dictFile) != 1) ||
+		(fwrite(&numIds, sizeof(numIds), 1, ts->dictFile) != 1))
+	{
+		fprintf(stderr, "Failed to write the header of the token dictionary.\n");
+		return GEN_FAIL;
+	}
+	for(uint32_t id = 0; id < numIds; id++)
+	{
+		size_t count = 0;
+		const char *word = WordHashTable_id_word(whtab, id, &count);
+		/// Words no longer in the table keep their position, left empty.
+		const uint32_t wordLength = (word != NULL) ? (uint32_t)strlen(word) : 0;
+		const uint64_t wordCount = (word != NULL) ? count : 0;
+		if((fwrite(&wordLength, sizeof(wordLength), 1, ts->dictFile) != 1) ||
+			(fwrite(word, sizeof(char), wordLength, ts->dictFile) != wordLength) ||
+			(fwrite(&wordCount, sizeof(wordCount), 1, ts->dictFile) != 1))
+		{
+			fprintf(stderr, "Failed to write the word of id %u "
+					"to the token dictionary.\n", id);
+			return GEN_FAIL;
+		}
+	}
+	if(fflush(ts->dictFile) != 0)
+	{
+		fprintf(stderr, "Failed to complete the token dictionary.\n");
+		return GEN_FAIL;
+	}
+
+	return SUCCESS;
+}
+
+void TokenStream_stats_print(const TokenStream *ts)
+{
+	printf("\nToken Stream statistics:\n");
+	printf("\tTokens written: %ld\n", ts->numTokens);
+}
+
+void TokenStream_destroy(TokenStream **ts)
+{
+	if((*ts)->idsFile != NULL) fclose((*ts)->idsFile);
+	if((*ts)->dictFile != NULL) fclose((*ts)->dictFile);
+	free((*ts)->ids);
+	free(*ts);
+	*ts = NULL;
+}
@@ -0,0 +1,146 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "unicode.h"
+
+UnicodeClass unicode_class(const uint32_t cp)
+{
+	if(cp < 0x800)
+	{
+		return (UnicodeClass)((unicodeSmallClasses[cp >> 2] >> ((cp & 3) * 2)) & 3);
+	}
+
+	/// Binary search for the last range starting at or before the code point.
+	size_t low = 0;
+	size_t high = unicodeNumRanges;
+	while(low < high)
+	{
+		const size_t mid = (low + high) / 2;
+		if(unicodeRanges[mid].first <= cp) low = mid + 1;
+		else high = mid;
+	}
+	if(low == 0) return UNICODE_OTHER;
+
+	const UnicodeRange *range = &(unicodeRanges[low - 1]);
+	return (cp - range->first <= range->span) ? (UnicodeClass)range->cls : UNICODE_OTHER;
+}
+
+uint32_t unicode_fold(const uint32_t cp)
+{
+	if(cp >= 0x110000) return cp;
+
+	/// The block of the code point gives the distance from its folding.
+	return (uint32_t)((int32_t)cp + unicodeFoldBlocks[unicodeFoldIndex[cp >> 8]][cp & 0xFF]);
+}
+
+uint32_t utf8_decode(const uint8_t *bytes, const size_t len, uint32_t *cp)
+{
+	const uint8_t lead = bytes[0];
+	uint32_t numBytes = 0;
+	uint32_t code = 0;
+	/// The smallest code point which needs that many bytes,
+	/// so that overlong sequences are rejected.
+	uint32_t minCode = 0;
+	if(lead < 0x80)
+	{
+		*cp = lead;
+		return 1;
+	}
+	else if((lead & 0xE0) == 0xC0)
+	{
+		numBytes = 2;
+		code = lead & 0x1F;
+		minCode = 0x80;
+	}
+	else if((lead & 0xF0) == 0xE0)
+	{
+		numBytes = 3;
+		code = lead & 0x0F;
+		minCode = 0x800;
+	}
+	else if((lead & 0xF8) == 0xF0)
+	{
+		numBytes = 4;
+		code = lead & 0x07;
+		minCode = 0x10000;
+	}
+	else
+	{
+		*cp = UNICODE_INVALID;
+		return 1;
+	}
+
+	for(uint32_t i = 1; i < numBytes; i++)
+	{
+		if(i >= len) return 0;
+		if((bytes[i] & 0xC0) != 0x80)
+		{
+			*cp = UNICODE_INVALID;
+			return 1;
+		}
+		code = (code << 6) | (bytes[i] & 0x3F);
+	}
+
+	if((code < minCode) || (code > 0x10FFFF) || ((code >= 0xD800) && (code <= 0xDFFF)))
+	{
+		*cp = UNICODE_INVALID;
+		return 1;
+	}
+	*cp = code;
+
+	return numBytes;
+}
+
+uint32_t utf8_encode(const uint32_t cp, uint8_t *bytes)
+{
+	if(cp < 0x80)
+	{
+		bytes[0] = (uint8_t)cp;
+		return 1;
+	}
+	else if(cp < 0x800)
+	{
+		bytes[0] = (uint8_t)(0xC0 | (cp >> 6));
+		bytes[1] = (uint8_t)(0x80 | (cp & 0x3F));
+		return 2;
+	}
+	else if(cp < 0x10000)
+	{
+		bytes[0] = (uint8_t)(0xE0 | (cp >> 12));
+		bytes[1] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+		bytes[2] = (uint8_t)(0x80 | (cp & 0x3F));
+		return 3;
+	}
+
+	bytes[0] = (uint8_t)(0xF0 | (cp >> 18));
+	bytes[1] = (uint8_t)(0x80 | ((cp >> 12) & 0x3F));
+	bytes[2] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+	bytes[3] = (uint8_t)(0x80 | (cp & 0x3F));
+	return 4;
+}
+
+uint32_t utf8_length(const uint8_t *bytes, const size_t len)
+{
+	uint32_t numCodePoints = 0;
+	for(size_t i = 0; i < len; i++)
+	{
+		if((bytes[i] & 0xC0) != 0x80) numCodePoints++;
+	}
+
+	return numCodePoints;
+}
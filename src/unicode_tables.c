@@ -0,0 +1,1574 @@
+/**
+ * Generated by tools/unicode_tables.py from the Unicode Character
+ * Database version 14.0.0 and its CaseFolding.txt. Do not edit.
+ */
+
+#include "unicode.h"
+
+const char unicodeVersion[] = "14.0.0";
+
+const uint8_t unicodeSmallClasses[512] =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x0a, 0x00,
+	0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xa0, 0x04, 0x18, 0x2a,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x05, 0x50, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x50, 0x45,
+	0x00, 0x10, 0x15, 0x51, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x01, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45,
+	0x14, 0x45, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x15, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0x0a, 0x50, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x41, 0x55, 0x55, 0x51, 0x55, 0xaa, 0xaa, 0x5a, 0x41,
+	0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x15, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00,
+	0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x10, 0x04,
+};
+
+const UnicodeRange unicodeRanges[794] =
+{
+	{0x00800, 0x002d, UNICODE_LETTER},
+	{0x00840, 0x001b, UNICODE_LETTER},
+	{0x00860, 0x000a, UNICODE_LETTER},
+	{0x00870, 0x0017, UNICODE_LETTER},
+	{0x00889, 0x0005, UNICODE_LETTER},
+	{0x00898, 0x0049, UNICODE_LETTER},
+	{0x008e3, 0x0080, UNICODE_LETTER},
+	{0x00966, 0x0009, UNICODE_NUMBER},
+	{0x00971, 0x0012, UNICODE_LETTER},
+	{0x00985, 0x0007, UNICODE_LETTER},
+	{0x0098f, 0x0001, UNICODE_LETTER},
+	{0x00993, 0x0015, UNICODE_LETTER},
+	{0x009aa, 0x0006, UNICODE_LETTER},
+	{0x009b2, 0x0000, UNICODE_LETTER},
+	{0x009b6, 0x0003, UNICODE_LETTER},
+	{0x009bc, 0x0008, UNICODE_LETTER},
+	{0x009c7, 0x0001, UNICODE_LETTER},
+	{0x009cb, 0x0003, UNICODE_LETTER},
+	{0x009d7, 0x0000, UNICODE_LETTER},
+	{0x009dc, 0x0001, UNICODE_LETTER},
+	{0x009df, 0x0004, UNICODE_LETTER},
+	{0x009e6, 0x0009, UNICODE_NUMBER},
+	{0x009f0, 0x0001, UNICODE_LETTER},
+	{0x009f4, 0x0005, UNICODE_NUMBER},
+	{0x009fc, 0x0000, UNICODE_LETTER},
+	{0x009fe, 0x0000, UNICODE_LETTER},
+	{0x00a01, 0x0002, UNICODE_LETTER},
+	{0x00a05, 0x0005, UNICODE_LETTER},
+	{0x00a0f, 0x0001, UNICODE_LETTER},
+	{0x00a13, 0x0015, UNICODE_LETTER},
+	{0x00a2a, 0x0006, UNICODE_LETTER},
+	{0x00a32, 0x0001, UNICODE_LETTER},
+	{0x00a35, 0x0001, UNICODE_LETTER},
+	{0x00a38, 0x0001, UNICODE_LETTER},
+	{0x00a3c, 0x0000, UNICODE_LETTER},
+	{0x00a3e, 0x0004, UNICODE_LETTER},
+	{0x00a47, 0x0001, UNICODE_LETTER},
+	{0x00a4b, 0x0002, UNICODE_LETTER},
+	{0x00a51, 0x0000, UNICODE_LETTER},
+	{0x00a59, 0x0003, UNICODE_LETTER},
+	{0x00a5e, 0x0000, UNICODE_LETTER},
+	{0x00a66, 0x0009, UNICODE_NUMBER},
+	{0x00a70, 0x0005, UNICODE_LETTER},
+	{0x00a81, 0x0002, UNICODE_LETTER},
+	{0x00a85, 0x0008, UNICODE_LETTER},
+	{0x00a8f, 0x0002, UNICODE_LETTER},
+	{0x00a93, 0x0015, UNICODE_LETTER},
+	{0x00aaa, 0x0006, UNICODE_LETTER},
+	{0x00ab2, 0x0001, UNICODE_LETTER},
+	{0x00ab5, 0x0004, UNICODE_LETTER},
+	{0x00abc, 0x0009, UNICODE_LETTER},
+	{0x00ac7, 0x0002, UNICODE_LETTER},
+	{0x00acb, 0x0002, UNICODE_LETTER},
+	{0x00ad0, 0x0000, UNICODE_LETTER},
+	{0x00ae0, 0x0003, UNICODE_LETTER},
+	{0x00ae6, 0x0009, UNICODE_NUMBER},
+	{0x00af9, 0x0006, UNICODE_LETTER},
+	{0x00b01, 0x0002, UNICODE_LETTER},
+	{0x00b05, 0x0007, UNICODE_LETTER},
+	{0x00b0f, 0x0001, UNICODE_LETTER},
+	{0x00b13, 0x0015, UNICODE_LETTER},
+	{0x00b2a, 0x0006, UNICODE_LETTER},
+	{0x00b32, 0x0001, UNICODE_LETTER},
+	{0x00b35, 0x0004, UNICODE_LETTER},
+	{0x00b3c, 0x0008, UNICODE_LETTER},
+	{0x00b47, 0x0001, UNICODE_LETTER},
+	{0x00b4b, 0x0002, UNICODE_LETTER},
+	{0x00b55, 0x0002, UNICODE_LETTER},
+	{0x00b5c, 0x0001, UNICODE_LETTER},
+	{0x00b5f, 0x0004, UNICODE_LETTER},
+	{0x00b66, 0x0009, UNICODE_NUMBER},
+	{0x00b71, 0x0000, UNICODE_LETTER},
+	{0x00b72, 0x0005, UNICODE_NUMBER},
+	{0x00b82, 0x0001, UNICODE_LETTER},
+	{0x00b85, 0x0005, UNICODE_LETTER},
+	{0x00b8e, 0x0002, UNICODE_LETTER},
+	{0x00b92, 0x0003, UNICODE_LETTER},
+	{0x00b99, 0x0001, UNICODE_LETTER},
+	{0x00b9c, 0x0000, UNICODE_LETTER},
+	{0x00b9e, 0x0001, UNICODE_LETTER},
+	{0x00ba3, 0x0001, UNICODE_LETTER},
+	{0x00ba8, 0x0002, UNICODE_LETTER},
+	{0x00bae, 0x000b, UNICODE_LETTER},
+	{0x00bbe, 0x0004, UNICODE_LETTER},
+	{0x00bc6, 0x0002, UNICODE_LETTER},
+	{0x00bca, 0x0003, UNICODE_LETTER},
+	{0x00bd0, 0x0000, UNICODE_LETTER},
+	{0x00bd7, 0x0000, UNICODE_LETTER},
+	{0x00be6, 0x000c, UNICODE_NUMBER},
+	{0x00c00, 0x000c, UNICODE_LETTER},
+	{0x00c0e, 0x0002, UNICODE_LETTER},
+	{0x00c12, 0x0016, UNICODE_LETTER},
+	{0x00c2a, 0x000f, UNICODE_LETTER},
+	{0x00c3c, 0x0008, UNICODE_LETTER},
+	{0x00c46, 0x0002, UNICODE_LETTER},
+	{0x00c4a, 0x0003, UNICODE_LETTER},
+	{0x00c55, 0x0001, UNICODE_LETTER},
+	{0x00c58, 0x0002, UNICODE_LETTER},
+	{0x00c5d, 0x0000, UNICODE_LETTER},
+	{0x00c60, 0x0003, UNICODE_LETTER},
+	{0x00c66, 0x0009, UNICODE_NUMBER},
+	{0x00c78, 0x0006, UNICODE_NUMBER},
+	{0x00c80, 0x0003, UNICODE_LETTER},
+	{0x00c85, 0x0007, UNICODE_LETTER},
+	{0x00c8e, 0x0002, UNICODE_LETTER},
+	{0x00c92, 0x0016, UNICODE_LETTER},
+	{0x00caa, 0x0009, UNICODE_LETTER},
+	{0x00cb5, 0x0004, UNICODE_LETTER},
+	{0x00cbc, 0x0008, UNICODE_LETTER},
+	{0x00cc6, 0x0002, UNICODE_LETTER},
+	{0x00cca, 0x0003, UNICODE_LETTER},
+	{0x00cd5, 0x0001, UNICODE_LETTER},
+	{0x00cdd, 0x0001, UNICODE_LETTER},
+	{0x00ce0, 0x0003, UNICODE_LETTER},
+	{0x00ce6, 0x0009, UNICODE_NUMBER},
+	{0x00cf1, 0x0001, UNICODE_LETTER},
+	{0x00d00, 0x000c, UNICODE_LETTER},
+	{0x00d0e, 0x0002, UNICODE_LETTER},
+	{0x00d12, 0x0032, UNICODE_LETTER},
+	{0x00d46, 0x0002, UNICODE_LETTER},
+	{0x00d4a, 0x0004, UNICODE_LETTER},
+	{0x00d54, 0x0003, UNICODE_LETTER},
+	{0x00d58, 0x0006, UNICODE_NUMBER},
+	{0x00d5f, 0x0004, UNICODE_LETTER},
+	{0x00d66, 0x0012, UNICODE_NUMBER},
+	{0x00d7a, 0x0005, UNICODE_LETTER},
+	{0x00d81, 0x0002, UNICODE_LETTER},
+	{0x00d85, 0x0011, UNICODE_LETTER},
+	{0x00d9a, 0x0017, UNICODE_LETTER},
+	{0x00db3, 0x0008, UNICODE_LETTER},
+	{0x00dbd, 0x0000, UNICODE_LETTER},
+	{0x00dc0, 0x0006, UNICODE_LETTER},
+	{0x00dca, 0x0000, UNICODE_LETTER},
+	{0x00dcf, 0x0005, UNICODE_LETTER},
+	{0x00dd6, 0x0000, UNICODE_LETTER},
+	{0x00dd8, 0x0007, UNICODE_LETTER},
+	{0x00de6, 0x0009, UNICODE_NUMBER},
+	{0x00df2, 0x0001, UNICODE_LETTER},
+	{0x00e01, 0x0039, UNICODE_LETTER},
+	{0x00e40, 0x000e, UNICODE_LETTER},
+	{0x00e50, 0x0009, UNICODE_NUMBER},
+	{0x00e81, 0x0001, UNICODE_LETTER},
+	{0x00e84, 0x0000, UNICODE_LETTER},
+	{0x00e86, 0x0004, UNICODE_LETTER},
+	{0x00e8c, 0x0017, UNICODE_LETTER},
+	{0x00ea5, 0x0000, UNICODE_LETTER},
+	{0x00ea7, 0x0016, UNICODE_LETTER},
+	{0x00ec0, 0x0004, UNICODE_LETTER},
+	{0x00ec6, 0x0000, UNICODE_LETTER},
+	{0x00ec8, 0x0005, UNICODE_LETTER},
+	{0x00ed0, 0x0009, UNICODE_NUMBER},
+	{0x00edc, 0x0003, UNICODE_LETTER},
+	{0x00f00, 0x0000, UNICODE_LETTER},
+	{0x00f18, 0x0001, UNICODE_LETTER},
+	{0x00f20, 0x0013, UNICODE_NUMBER},
+	{0x00f35, 0x0000, UNICODE_LETTER},
+	{0x00f37, 0x0000, UNICODE_LETTER},
+	{0x00f39, 0x0000, UNICODE_LETTER},
+	{0x00f3e, 0x0009, UNICODE_LETTER},
+	{0x00f49, 0x0023, UNICODE_LETTER},
+	{0x00f71, 0x0013, UNICODE_LETTER},
+	{0x00f86, 0x0011, UNICODE_LETTER},
+	{0x00f99, 0x0023, UNICODE_LETTER},
+	{0x00fc6, 0x0000, UNICODE_LETTER},
+	{0x01000, 0x003f, UNICODE_LETTER},
+	{0x01040, 0x0009, UNICODE_NUMBER},
+	{0x01050, 0x003f, UNICODE_LETTER},
+	{0x01090, 0x0009, UNICODE_NUMBER},
+	{0x0109a, 0x0003, UNICODE_LETTER},
+	{0x010a0, 0x0025, UNICODE_LETTER},
+	{0x010c7, 0x0000, UNICODE_LETTER},
+	{0x010cd, 0x0000, UNICODE_LETTER},
+	{0x010d0, 0x002a, UNICODE_LETTER},
+	{0x010fc, 0x014c, UNICODE_LETTER},
+	{0x0124a, 0x0003, UNICODE_LETTER},
+	{0x01250, 0x0006, UNICODE_LETTER},
+	{0x01258, 0x0000, UNICODE_LETTER},
+	{0x0125a, 0x0003, UNICODE_LETTER},
+	{0x01260, 0x0028, UNICODE_LETTER},
+	{0x0128a, 0x0003, UNICODE_LETTER},
+	{0x01290, 0x0020, UNICODE_LETTER},
+	{0x012b2, 0x0003, UNICODE_LETTER},
+	{0x012b8, 0x0006, UNICODE_LETTER},
+	{0x012c0, 0x0000, UNICODE_LETTER},
+	{0x012c2, 0x0003, UNICODE_LETTER},
+	{0x012c8, 0x000e, UNICODE_LETTER},
+	{0x012d8, 0x0038, UNICODE_LETTER},
+	{0x01312, 0x0003, UNICODE_LETTER},
+	{0x01318, 0x0042, UNICODE_LETTER},
+	{0x0135d, 0x0002, UNICODE_LETTER},
+	{0x01369, 0x0013, UNICODE_NUMBER},
+	{0x01380, 0x000f, UNICODE_LETTER},
+	{0x013a0, 0x0055, UNICODE_LETTER},
+	{0x013f8, 0x0005, UNICODE_LETTER},
+	{0x01401, 0x026b, UNICODE_LETTER},
+	{0x0166f, 0x0010, UNICODE_LETTER},
+	{0x01681, 0x0019, UNICODE_LETTER},
+	{0x016a0, 0x004a, UNICODE_LETTER},
+	{0x016ee, 0x0002, UNICODE_NUMBER},
+	{0x016f1, 0x0007, UNICODE_LETTER},
+	{0x01700, 0x0015, UNICODE_LETTER},
+	{0x0171f, 0x0015, UNICODE_LETTER},
+	{0x01740, 0x0013, UNICODE_LETTER},
+	{0x01760, 0x000c, UNICODE_LETTER},
+	{0x0176e, 0x0002, UNICODE_LETTER},
+	{0x01772, 0x0001, UNICODE_LETTER},
+	{0x01780, 0x0053, UNICODE_LETTER},
+	{0x017d7, 0x0000, UNICODE_LETTER},
+	{0x017dc, 0x0001, UNICODE_LETTER},
+	{0x017e0, 0x0009, UNICODE_NUMBER},
+	{0x017f0, 0x0009, UNICODE_NUMBER},
+	{0x0180b, 0x0002, UNICODE_LETTER},
+	{0x0180f, 0x0000, UNICODE_LETTER},
+	{0x01810, 0x0009, UNICODE_NUMBER},
+	{0x01820, 0x0058, UNICODE_LETTER},
+	{0x01880, 0x002a, UNICODE_LETTER},
+	{0x018b0, 0x0045, UNICODE_LETTER},
+	{0x01900, 0x001e, UNICODE_LETTER},
+	{0x01920, 0x000b, UNICODE_LETTER},
+	{0x01930, 0x000b, UNICODE_LETTER},
+	{0x01946, 0x0009, UNICODE_NUMBER},
+	{0x01950, 0x001d, UNICODE_LETTER},
+	{0x01970, 0x0004, UNICODE_LETTER},
+	{0x01980, 0x002b, UNICODE_LETTER},
+	{0x019b0, 0x0019, UNICODE_LETTER},
+	{0x019d0, 0x000a, UNICODE_NUMBER},
+	{0x01a00, 0x001b, UNICODE_LETTER},
+	{0x01a20, 0x003e, UNICODE_LETTER},
+	{0x01a60, 0x001c, UNICODE_LETTER},
+	{0x01a7f, 0x0000, UNICODE_LETTER},
+	{0x01a80, 0x0009, UNICODE_NUMBER},
+	{0x01a90, 0x0009, UNICODE_NUMBER},
+	{0x01aa7, 0x0000, UNICODE_LETTER},
+	{0x01ab0, 0x001e, UNICODE_LETTER},
+	{0x01b00, 0x004c, UNICODE_LETTER},
+	{0x01b50, 0x0009, UNICODE_NUMBER},
+	{0x01b6b, 0x0008, UNICODE_LETTER},
+	{0x01b80, 0x002f, UNICODE_LETTER},
+	{0x01bb0, 0x0009, UNICODE_NUMBER},
+	{0x01bba, 0x0039, UNICODE_LETTER},
+	{0x01c00, 0x0037, UNICODE_LETTER},
+	{0x01c40, 0x0009, UNICODE_NUMBER},
+	{0x01c4d, 0x0002, UNICODE_LETTER},
+	{0x01c50, 0x0009, UNICODE_NUMBER},
+	{0x01c5a, 0x0023, UNICODE_LETTER},
+	{0x01c80, 0x0008, UNICODE_LETTER},
+	{0x01c90, 0x002a, UNICODE_LETTER},
+	{0x01cbd, 0x0002, UNICODE_LETTER},
+	{0x01cd0, 0x0002, UNICODE_LETTER},
+	{0x01cd4, 0x0026, UNICODE_LETTER},
+	{0x01d00, 0x0215, UNICODE_LETTER},
+	{0x01f18, 0x0005, UNICODE_LETTER},
+	{0x01f20, 0x0025, UNICODE_LETTER},
+	{0x01f48, 0x0005, UNICODE_LETTER},
+	{0x01f50, 0x0007, UNICODE_LETTER},
+	{0x01f59, 0x0000, UNICODE_LETTER},
+	{0x01f5b, 0x0000, UNICODE_LETTER},
+	{0x01f5d, 0x0000, UNICODE_LETTER},
+	{0x01f5f, 0x001e, UNICODE_LETTER},
+	{0x01f80, 0x0034, UNICODE_LETTER},
+	{0x01fb6, 0x0006, UNICODE_LETTER},
+	{0x01fbe, 0x0000, UNICODE_LETTER},
+	{0x01fc2, 0x0002, UNICODE_LETTER},
+	{0x01fc6, 0x0006, UNICODE_LETTER},
+	{0x01fd0, 0x0003, UNICODE_LETTER},
+	{0x01fd6, 0x0005, UNICODE_LETTER},
+	{0x01fe0, 0x000c, UNICODE_LETTER},
+	{0x01ff2, 0x0002, UNICODE_LETTER},
+	{0x01ff6, 0x0006, UNICODE_LETTER},
+	{0x02070, 0x0000, UNICODE_NUMBER},
+	{0x02071, 0x0000, UNICODE_LETTER},
+	{0x02074, 0x0005, UNICODE_NUMBER},
+	{0x0207f, 0x0000, UNICODE_LETTER},
+	{0x02080, 0x0009, UNICODE_NUMBER},
+	{0x02090, 0x000c, UNICODE_LETTER},
+	{0x020d0, 0x0020, UNICODE_LETTER},
+	{0x02102, 0x0000, UNICODE_LETTER},
+	{0x02107, 0x0000, UNICODE_LETTER},
+	{0x0210a, 0x0009, UNICODE_LETTER},
+	{0x02115, 0x0000, UNICODE_LETTER},
+	{0x02119, 0x0004, UNICODE_LETTER},
+	{0x02124, 0x0000, UNICODE_LETTER},
+	{0x02126, 0x0000, UNICODE_LETTER},
+	{0x02128, 0x0000, UNICODE_LETTER},
+	{0x0212a, 0x0003, UNICODE_LETTER},
+	{0x0212f, 0x000a, UNICODE_LETTER},
+	{0x0213c, 0x0003, UNICODE_LETTER},
+	{0x02145, 0x0004, UNICODE_LETTER},
+	{0x0214e, 0x0000, UNICODE_LETTER},
+	{0x02150, 0x0032, UNICODE_NUMBER},
+	{0x02183, 0x0001, UNICODE_LETTER},
+	{0x02185, 0x0004, UNICODE_NUMBER},
+	{0x02460, 0x003b, UNICODE_NUMBER},
+	{0x024ea, 0x0015, UNICODE_NUMBER},
+	{0x02776, 0x001d, UNICODE_NUMBER},
+	{0x02c00, 0x00e4, UNICODE_LETTER},
+	{0x02ceb, 0x0008, UNICODE_LETTER},
+	{0x02cfd, 0x0000, UNICODE_NUMBER},
+	{0x02d00, 0x0025, UNICODE_LETTER},
+	{0x02d27, 0x0000, UNICODE_LETTER},
+	{0x02d2d, 0x0000, UNICODE_LETTER},
+	{0x02d30, 0x0037, UNICODE_LETTER},
+	{0x02d6f, 0x0000, UNICODE_LETTER},
+	{0x02d7f, 0x0017, UNICODE_LETTER},
+	{0x02da0, 0x0006, UNICODE_LETTER},
+	{0x02da8, 0x0006, UNICODE_LETTER},
+	{0x02db0, 0x0006, UNICODE_LETTER},
+	{0x02db8, 0x0006, UNICODE_LETTER},
+	{0x02dc0, 0x0006, UNICODE_LETTER},
+	{0x02dc8, 0x0006, UNICODE_LETTER},
+	{0x02dd0, 0x0006, UNICODE_LETTER},
+	{0x02dd8, 0x0006, UNICODE_LETTER},
+	{0x02de0, 0x001f, UNICODE_LETTER},
+	{0x02e2f, 0x0000, UNICODE_LETTER},
+	{0x03005, 0x0001, UNICODE_LETTER},
+	{0x03007, 0x0000, UNICODE_NUMBER},
+	{0x03021, 0x0008, UNICODE_NUMBER},
+	{0x0302a, 0x0005, UNICODE_LETTER},
+	{0x03031, 0x0004, UNICODE_LETTER},
+	{0x03038, 0x0002, UNICODE_NUMBER},
+	{0x0303b, 0x0001, UNICODE_LETTER},
+	{0x03041, 0x0055, UNICODE_LETTER},
+	{0x03099, 0x0001, UNICODE_LETTER},
+	{0x0309d, 0x0002, UNICODE_LETTER},
+	{0x030a1, 0x0059, UNICODE_LETTER},
+	{0x030fc, 0x0003, UNICODE_LETTER},
+	{0x03105, 0x002a, UNICODE_LETTER},
+	{0x03131, 0x005d, UNICODE_LETTER},
+	{0x03192, 0x0003, UNICODE_NUMBER},
+	{0x031a0, 0x001f, UNICODE_LETTER},
+	{0x031f0, 0x000f, UNICODE_LETTER},
+	{0x03220, 0x0009, UNICODE_NUMBER},
+	{0x03248, 0x0007, UNICODE_NUMBER},
+	{0x03251, 0x000e, UNICODE_NUMBER},
+	{0x03280, 0x0009, UNICODE_NUMBER},
+	{0x032b1, 0x000e, UNICODE_NUMBER},
+	{0x03400, 0x19bf, UNICODE_LETTER},
+	{0x04e00, 0x568c, UNICODE_LETTER},
+	{0x0a4d0, 0x002d, UNICODE_LETTER},
+	{0x0a500, 0x010c, UNICODE_LETTER},
+	{0x0a610, 0x000f, UNICODE_LETTER},
+	{0x0a620, 0x0009, UNICODE_NUMBER},
+	{0x0a62a, 0x0001, UNICODE_LETTER},
+	{0x0a640, 0x0032, UNICODE_LETTER},
+	{0x0a674, 0x0009, UNICODE_LETTER},
+	{0x0a67f, 0x0066, UNICODE_LETTER},
+	{0x0a6e6, 0x0009, UNICODE_NUMBER},
+	{0x0a6f0, 0x0001, UNICODE_LETTER},
+	{0x0a717, 0x0008, UNICODE_LETTER},
+	{0x0a722, 0x0066, UNICODE_LETTER},
+	{0x0a78b, 0x003f, UNICODE_LETTER},
+	{0x0a7d0, 0x0001, UNICODE_LETTER},
+	{0x0a7d3, 0x0000, UNICODE_LETTER},
+	{0x0a7d5, 0x0004, UNICODE_LETTER},
+	{0x0a7f2, 0x0035, UNICODE_LETTER},
+	{0x0a82c, 0x0000, UNICODE_LETTER},
+	{0x0a830, 0x0005, UNICODE_NUMBER},
+	{0x0a840, 0x0033, UNICODE_LETTER},
+	{0x0a880, 0x0045, UNICODE_LETTER},
+	{0x0a8d0, 0x0009, UNICODE_NUMBER},
+	{0x0a8e0, 0x0017, UNICODE_LETTER},
+	{0x0a8fb, 0x0000, UNICODE_LETTER},
+	{0x0a8fd, 0x0002, UNICODE_LETTER},
+	{0x0a900, 0x0009, UNICODE_NUMBER},
+	{0x0a90a, 0x0023, UNICODE_LETTER},
+	{0x0a930, 0x0023, UNICODE_LETTER},
+	{0x0a960, 0x001c, UNICODE_LETTER},
+	{0x0a980, 0x0040, UNICODE_LETTER},
+	{0x0a9cf, 0x0000, UNICODE_LETTER},
+	{0x0a9d0, 0x0009, UNICODE_NUMBER},
+	{0x0a9e0, 0x000f, UNICODE_LETTER},
+	{0x0a9f0, 0x0009, UNICODE_NUMBER},
+	{0x0a9fa, 0x0004, UNICODE_LETTER},
+	{0x0aa00, 0x0036, UNICODE_LETTER},
+	{0x0aa40, 0x000d, UNICODE_LETTER},
+	{0x0aa50, 0x0009, UNICODE_NUMBER},
+	{0x0aa60, 0x0016, UNICODE_LETTER},
+	{0x0aa7a, 0x0048, UNICODE_LETTER},
+	{0x0aadb, 0x0002, UNICODE_LETTER},
+	{0x0aae0, 0x000f, UNICODE_LETTER},
+	{0x0aaf2, 0x0004, UNICODE_LETTER},
+	{0x0ab01, 0x0005, UNICODE_LETTER},
+	{0x0ab09, 0x0005, UNICODE_LETTER},
+	{0x0ab11, 0x0005, UNICODE_LETTER},
+	{0x0ab20, 0x0006, UNICODE_LETTER},
+	{0x0ab28, 0x0006, UNICODE_LETTER},
+	{0x0ab30, 0x002a, UNICODE_LETTER},
+	{0x0ab5c, 0x000d, UNICODE_LETTER},
+	{0x0ab70, 0x007a, UNICODE_LETTER},
+	{0x0abec, 0x0001, UNICODE_LETTER},
+	{0x0abf0, 0x0009, UNICODE_NUMBER},
+	{0x0ac00, 0x2ba3, UNICODE_LETTER},
+	{0x0d7b0, 0x0016, UNICODE_LETTER},
+	{0x0d7cb, 0x0030, UNICODE_LETTER},
+	{0x0f900, 0x016d, UNICODE_LETTER},
+	{0x0fa70, 0x0069, UNICODE_LETTER},
+	{0x0fb00, 0x0006, UNICODE_LETTER},
+	{0x0fb13, 0x0004, UNICODE_LETTER},
+	{0x0fb1d, 0x000b, UNICODE_LETTER},
+	{0x0fb2a, 0x000c, UNICODE_LETTER},
+	{0x0fb38, 0x0004, UNICODE_LETTER},
+	{0x0fb3e, 0x0000, UNICODE_LETTER},
+	{0x0fb40, 0x0001, UNICODE_LETTER},
+	{0x0fb43, 0x0001, UNICODE_LETTER},
+	{0x0fb46, 0x006b, UNICODE_LETTER},
+	{0x0fbd3, 0x016a, UNICODE_LETTER},
+	{0x0fd50, 0x003f, UNICODE_LETTER},
+	{0x0fd92, 0x0035, UNICODE_LETTER},
+	{0x0fdf0, 0x000b, UNICODE_LETTER},
+	{0x0fe00, 0x000f, UNICODE_LETTER},
+	{0x0fe20, 0x000f, UNICODE_LETTER},
+	{0x0fe70, 0x0004, UNICODE_LETTER},
+	{0x0fe76, 0x0086, UNICODE_LETTER},
+	{0x0ff10, 0x0009, UNICODE_NUMBER},
+	{0x0ff21, 0x0019, UNICODE_LETTER},
+	{0x0ff41, 0x0019, UNICODE_LETTER},
+	{0x0ff66, 0x0058, UNICODE_LETTER},
+	{0x0ffc2, 0x0005, UNICODE_LETTER},
+	{0x0ffca, 0x0005, UNICODE_LETTER},
+	{0x0ffd2, 0x0005, UNICODE_LETTER},
+	{0x0ffda, 0x0002, UNICODE_LETTER},
+	{0x10000, 0x000b, UNICODE_LETTER},
+	{0x1000d, 0x0019, UNICODE_LETTER},
+	{0x10028, 0x0012, UNICODE_LETTER},
+	{0x1003c, 0x0001, UNICODE_LETTER},
+	{0x1003f, 0x000e, UNICODE_LETTER},
+	{0x10050, 0x000d, UNICODE_LETTER},
+	{0x10080, 0x007a, UNICODE_LETTER},
+	{0x10107, 0x002c, UNICODE_NUMBER},
+	{0x10140, 0x0038, UNICODE_NUMBER},
+	{0x1018a, 0x0001, UNICODE_NUMBER},
+	{0x101fd, 0x0000, UNICODE_LETTER},
+	{0x10280, 0x001c, UNICODE_LETTER},
+	{0x102a0, 0x0030, UNICODE_LETTER},
+	{0x102e0, 0x0000, UNICODE_LETTER},
+	{0x102e1, 0x001a, UNICODE_NUMBER},
+	{0x10300, 0x001f, UNICODE_LETTER},
+	{0x10320, 0x0003, UNICODE_NUMBER},
+	{0x1032d, 0x0013, UNICODE_LETTER},
+	{0x10341, 0x0000, UNICODE_NUMBER},
+	{0x10342, 0x0007, UNICODE_LETTER},
+	{0x1034a, 0x0000, UNICODE_NUMBER},
+	{0x10350, 0x002a, UNICODE_LETTER},
+	{0x10380, 0x001d, UNICODE_LETTER},
+	{0x103a0, 0x0023, UNICODE_LETTER},
+	{0x103c8, 0x0007, UNICODE_LETTER},
+	{0x103d1, 0x0004, UNICODE_NUMBER},
+	{0x10400, 0x009d, UNICODE_LETTER},
+	{0x104a0, 0x0009, UNICODE_NUMBER},
+	{0x104b0, 0x0023, UNICODE_LETTER},
+	{0x104d8, 0x0023, UNICODE_LETTER},
+	{0x10500, 0x0027, UNICODE_LETTER},
+	{0x10530, 0x0033, UNICODE_LETTER},
+	{0x10570, 0x000a, UNICODE_LETTER},
+	{0x1057c, 0x000e, UNICODE_LETTER},
+	{0x1058c, 0x0006, UNICODE_LETTER},
+	{0x10594, 0x0001, UNICODE_LETTER},
+	{0x10597, 0x000a, UNICODE_LETTER},
+	{0x105a3, 0x000e, UNICODE_LETTER},
+	{0x105b3, 0x0006, UNICODE_LETTER},
+	{0x105bb, 0x0001, UNICODE_LETTER},
+	{0x10600, 0x0136, UNICODE_LETTER},
+	{0x10740, 0x0015, UNICODE_LETTER},
+	{0x10760, 0x0007, UNICODE_LETTER},
+	{0x10780, 0x0005, UNICODE_LETTER},
+	{0x10787, 0x0029, UNICODE_LETTER},
+	{0x107b2, 0x0008, UNICODE_LETTER},
+	{0x10800, 0x0005, UNICODE_LETTER},
+	{0x10808, 0x0000, UNICODE_LETTER},
+	{0x1080a, 0x002b, UNICODE_LETTER},
+	{0x10837, 0x0001, UNICODE_LETTER},
+	{0x1083c, 0x0000, UNICODE_LETTER},
+	{0x1083f, 0x0016, UNICODE_LETTER},
+	{0x10858, 0x0007, UNICODE_NUMBER},
+	{0x10860, 0x0016, UNICODE_LETTER},
+	{0x10879, 0x0006, UNICODE_NUMBER},
+	{0x10880, 0x001e, UNICODE_LETTER},
+	{0x108a7, 0x0008, UNICODE_NUMBER},
+	{0x108e0, 0x0012, UNICODE_LETTER},
+	{0x108f4, 0x0001, UNICODE_LETTER},
+	{0x108fb, 0x0004, UNICODE_NUMBER},
+	{0x10900, 0x0015, UNICODE_LETTER},
+	{0x10916, 0x0005, UNICODE_NUMBER},
+	{0x10920, 0x0019, UNICODE_LETTER},
+	{0x10980, 0x0037, UNICODE_LETTER},
+	{0x109bc, 0x0001, UNICODE_NUMBER},
+	{0x109be, 0x0001, UNICODE_LETTER},
+	{0x109c0, 0x000f, UNICODE_NUMBER},
+	{0x109d2, 0x002d, UNICODE_NUMBER},
+	{0x10a00, 0x0003, UNICODE_LETTER},
+	{0x10a05, 0x0001, UNICODE_LETTER},
+	{0x10a0c, 0x0007, UNICODE_LETTER},
+	{0x10a15, 0x0002, UNICODE_LETTER},
+	{0x10a19, 0x001c, UNICODE_LETTER},
+	{0x10a38, 0x0002, UNICODE_LETTER},
+	{0x10a3f, 0x0000, UNICODE_LETTER},
+	{0x10a40, 0x0008, UNICODE_NUMBER},
+	{0x10a60, 0x001c, UNICODE_LETTER},
+	{0x10a7d, 0x0001, UNICODE_NUMBER},
+	{0x10a80, 0x001c, UNICODE_LETTER},
+	{0x10a9d, 0x0002, UNICODE_NUMBER},
+	{0x10ac0, 0x0007, UNICODE_LETTER},
+	{0x10ac9, 0x001d, UNICODE_LETTER},
+	{0x10aeb, 0x0004, UNICODE_NUMBER},
+	{0x10b00, 0x0035, UNICODE_LETTER},
+	{0x10b40, 0x0015, UNICODE_LETTER},
+	{0x10b58, 0x0007, UNICODE_NUMBER},
+	{0x10b60, 0x0012, UNICODE_LETTER},
+	{0x10b78, 0x0007, UNICODE_NUMBER},
+	{0x10b80, 0x0011, UNICODE_LETTER},
+	{0x10ba9, 0x0006, UNICODE_NUMBER},
+	{0x10c00, 0x0048, UNICODE_LETTER},
+	{0x10c80, 0x0032, UNICODE_LETTER},
+	{0x10cc0, 0x0032, UNICODE_LETTER},
+	{0x10cfa, 0x0005, UNICODE_NUMBER},
+	{0x10d00, 0x0027, UNICODE_LETTER},
+	{0x10d30, 0x0009, UNICODE_NUMBER},
+	{0x10e60, 0x001e, UNICODE_NUMBER},
+	{0x10e80, 0x0029, UNICODE_LETTER},
+	{0x10eab, 0x0001, UNICODE_LETTER},
+	{0x10eb0, 0x0001, UNICODE_LETTER},
+	{0x10f00, 0x001c, UNICODE_LETTER},
+	{0x10f1d, 0x0009, UNICODE_NUMBER},
+	{0x10f27, 0x0000, UNICODE_LETTER},
+	{0x10f30, 0x0020, UNICODE_LETTER},
+	{0x10f51, 0x0003, UNICODE_NUMBER},
+	{0x10f70, 0x0015, UNICODE_LETTER},
+	{0x10fb0, 0x0014, UNICODE_LETTER},
+	{0x10fc5, 0x0006, UNICODE_NUMBER},
+	{0x10fe0, 0x0016, UNICODE_LETTER},
+	{0x11000, 0x0046, UNICODE_LETTER},
+	{0x11052, 0x001d, UNICODE_NUMBER},
+	{0x11070, 0x0005, UNICODE_LETTER},
+	{0x1107f, 0x003b, UNICODE_LETTER},
+	{0x110c2, 0x0000, UNICODE_LETTER},
+	{0x110d0, 0x0018, UNICODE_LETTER},
+	{0x110f0, 0x0009, UNICODE_NUMBER},
+	{0x11100, 0x0034, UNICODE_LETTER},
+	{0x11136, 0x0009, UNICODE_NUMBER},
+	{0x11144, 0x0003, UNICODE_LETTER},
+	{0x11150, 0x0023, UNICODE_LETTER},
+	{0x11176, 0x0000, UNICODE_LETTER},
+	{0x11180, 0x0044, UNICODE_LETTER},
+	{0x111c9, 0x0003, UNICODE_LETTER},
+	{0x111ce, 0x0001, UNICODE_LETTER},
+	{0x111d0, 0x0009, UNICODE_NUMBER},
+	{0x111da, 0x0000, UNICODE_LETTER},
+	{0x111dc, 0x0000, UNICODE_LETTER},
+	{0x111e1, 0x0013, UNICODE_NUMBER},
+	{0x11200, 0x0011, UNICODE_LETTER},
+	{0x11213, 0x0024, UNICODE_LETTER},
+	{0x1123e, 0x0000, UNICODE_LETTER},
+	{0x11280, 0x0006, UNICODE_LETTER},
+	{0x11288, 0x0000, UNICODE_LETTER},
+	{0x1128a, 0x0003, UNICODE_LETTER},
+	{0x1128f, 0x000e, UNICODE_LETTER},
+	{0x1129f, 0x0009, UNICODE_LETTER},
+	{0x112b0, 0x003a, UNICODE_LETTER},
+	{0x112f0, 0x0009, UNICODE_NUMBER},
+	{0x11300, 0x0003, UNICODE_LETTER},
+	{0x11305, 0x0007, UNICODE_LETTER},
+	{0x1130f, 0x0001, UNICODE_LETTER},
+	{0x11313, 0x0015, UNICODE_LETTER},
+	{0x1132a, 0x0006, UNICODE_LETTER},
+	{0x11332, 0x0001, UNICODE_LETTER},
+	{0x11335, 0x0004, UNICODE_LETTER},
+	{0x1133b, 0x0009, UNICODE_LETTER},
+	{0x11347, 0x0001, UNICODE_LETTER},
+	{0x1134b, 0x0002, UNICODE_LETTER},
+	{0x11350, 0x0000, UNICODE_LETTER},
+	{0x11357, 0x0000, UNICODE_LETTER},
+	{0x1135d, 0x0006, UNICODE_LETTER},
+	{0x11366, 0x0006, UNICODE_LETTER},
+	{0x11370, 0x0004, UNICODE_LETTER},
+	{0x11400, 0x004a, UNICODE_LETTER},
+	{0x11450, 0x0009, UNICODE_NUMBER},
+	{0x1145e, 0x0003, UNICODE_LETTER},
+	{0x11480, 0x0045, UNICODE_LETTER},
+	{0x114c7, 0x0000, UNICODE_LETTER},
+	{0x114d0, 0x0009, UNICODE_NUMBER},
+	{0x11580, 0x0035, UNICODE_LETTER},
+	{0x115b8, 0x0008, UNICODE_LETTER},
+	{0x115d8, 0x0005, UNICODE_LETTER},
+	{0x11600, 0x0040, UNICODE_LETTER},
+	{0x11644, 0x0000, UNICODE_LETTER},
+	{0x11650, 0x0009, UNICODE_NUMBER},
+	{0x11680, 0x0038, UNICODE_LETTER},
+	{0x116c0, 0x0009, UNICODE_NUMBER},
+	{0x11700, 0x001a, UNICODE_LETTER},
+	{0x1171d, 0x000e, UNICODE_LETTER},
+	{0x11730, 0x000b, UNICODE_NUMBER},
+	{0x11740, 0x0006, UNICODE_LETTER},
+	{0x11800, 0x003a, UNICODE_LETTER},
+	{0x118a0, 0x003f, UNICODE_LETTER},
+	{0x118e0, 0x0012, UNICODE_NUMBER},
+	{0x118ff, 0x0007, UNICODE_LETTER},
+	{0x11909, 0x0000, UNICODE_LETTER},
+	{0x1190c, 0x0007, UNICODE_LETTER},
+	{0x11915, 0x0001, UNICODE_LETTER},
+	{0x11918, 0x001d, UNICODE_LETTER},
+	{0x11937, 0x0001, UNICODE_LETTER},
+	{0x1193b, 0x0008, UNICODE_LETTER},
+	{0x11950, 0x0009, UNICODE_NUMBER},
+	{0x119a0, 0x0007, UNICODE_LETTER},
+	{0x119aa, 0x002d, UNICODE_LETTER},
+	{0x119da, 0x0007, UNICODE_LETTER},
+	{0x119e3, 0x0001, UNICODE_LETTER},
+	{0x11a00, 0x003e, UNICODE_LETTER},
+	{0x11a47, 0x0000, UNICODE_LETTER},
+	{0x11a50, 0x0049, UNICODE_LETTER},
+	{0x11a9d, 0x0000, UNICODE_LETTER},
+	{0x11ab0, 0x0048, UNICODE_LETTER},
+	{0x11c00, 0x0008, UNICODE_LETTER},
+	{0x11c0a, 0x002c, UNICODE_LETTER},
+	{0x11c38, 0x0008, UNICODE_LETTER},
+	{0x11c50, 0x001c, UNICODE_NUMBER},
+	{0x11c72, 0x001d, UNICODE_LETTER},
+	{0x11c92, 0x0015, UNICODE_LETTER},
+	{0x11ca9, 0x000d, UNICODE_LETTER},
+	{0x11d00, 0x0006, UNICODE_LETTER},
+	{0x11d08, 0x0001, UNICODE_LETTER},
+	{0x11d0b, 0x002b, UNICODE_LETTER},
+	{0x11d3a, 0x0000, UNICODE_LETTER},
+	{0x11d3c, 0x0001, UNICODE_LETTER},
+	{0x11d3f, 0x0008, UNICODE_LETTER},
+	{0x11d50, 0x0009, UNICODE_NUMBER},
+	{0x11d60, 0x0005, UNICODE_LETTER},
+	{0x11d67, 0x0001, UNICODE_LETTER},
+	{0x11d6a, 0x0024, UNICODE_LETTER},
+	{0x11d90, 0x0001, UNICODE_LETTER},
+	{0x11d93, 0x0005, UNICODE_LETTER},
+	{0x11da0, 0x0009, UNICODE_NUMBER},
+	{0x11ee0, 0x0016, UNICODE_LETTER},
+	{0x11fb0, 0x0000, UNICODE_LETTER},
+	{0x11fc0, 0x0014, UNICODE_NUMBER},
+	{0x12000, 0x0399, UNICODE_LETTER},
+	{0x12400, 0x006e, UNICODE_NUMBER},
+	{0x12480, 0x00c3, UNICODE_LETTER},
+	{0x12f90, 0x0060, UNICODE_LETTER},
+	{0x13000, 0x042e, UNICODE_LETTER},
+	{0x14400, 0x0246, UNICODE_LETTER},
+	{0x16800, 0x0238, UNICODE_LETTER},
+	{0x16a40, 0x001e, UNICODE_LETTER},
+	{0x16a60, 0x0009, UNICODE_NUMBER},
+	{0x16a70, 0x004e, UNICODE_LETTER},
+	{0x16ac0, 0x0009, UNICODE_NUMBER},
+	{0x16ad0, 0x001d, UNICODE_LETTER},
+	{0x16af0, 0x0004, UNICODE_LETTER},
+	{0x16b00, 0x0036, UNICODE_LETTER},
+	{0x16b40, 0x0003, UNICODE_LETTER},
+	{0x16b50, 0x0009, UNICODE_NUMBER},
+	{0x16b5b, 0x0006, UNICODE_NUMBER},
+	{0x16b63, 0x0014, UNICODE_LETTER},
+	{0x16b7d, 0x0012, UNICODE_LETTER},
+	{0x16e40, 0x003f, UNICODE_LETTER},
+	{0x16e80, 0x0016, UNICODE_NUMBER},
+	{0x16f00, 0x004a, UNICODE_LETTER},
+	{0x16f4f, 0x0038, UNICODE_LETTER},
+	{0x16f8f, 0x0010, UNICODE_LETTER},
+	{0x16fe0, 0x0001, UNICODE_LETTER},
+	{0x16fe3, 0x0001, UNICODE_LETTER},
+	{0x16ff0, 0x0001, UNICODE_LETTER},
+	{0x17000, 0x17f7, UNICODE_LETTER},
+	{0x18800, 0x04d5, UNICODE_LETTER},
+	{0x18d00, 0x0008, UNICODE_LETTER},
+	{0x1aff0, 0x0003, UNICODE_LETTER},
+	{0x1aff5, 0x0006, UNICODE_LETTER},
+	{0x1affd, 0x0001, UNICODE_LETTER},
+	{0x1b000, 0x0122, UNICODE_LETTER},
+	{0x1b150, 0x0002, UNICODE_LETTER},
+	{0x1b164, 0x0003, UNICODE_LETTER},
+	{0x1b170, 0x018b, UNICODE_LETTER},
+	{0x1bc00, 0x006a, UNICODE_LETTER},
+	{0x1bc70, 0x000c, UNICODE_LETTER},
+	{0x1bc80, 0x0008, UNICODE_LETTER},
+	{0x1bc90, 0x0009, UNICODE_LETTER},
+	{0x1bc9d, 0x0001, UNICODE_LETTER},
+	{0x1cf00, 0x002d, UNICODE_LETTER},
+	{0x1cf30, 0x0016, UNICODE_LETTER},
+	{0x1d165, 0x0004, UNICODE_LETTER},
+	{0x1d16d, 0x0005, UNICODE_LETTER},
+	{0x1d17b, 0x0007, UNICODE_LETTER},
+	{0x1d185, 0x0006, UNICODE_LETTER},
+	{0x1d1aa, 0x0003, UNICODE_LETTER},
+	{0x1d242, 0x0002, UNICODE_LETTER},
+	{0x1d2e0, 0x0013, UNICODE_NUMBER},
+	{0x1d360, 0x0018, UNICODE_NUMBER},
+	{0x1d400, 0x0054, UNICODE_LETTER},
+	{0x1d456, 0x0046, UNICODE_LETTER},
+	{0x1d49e, 0x0001, UNICODE_LETTER},
+	{0x1d4a2, 0x0000, UNICODE_LETTER},
+	{0x1d4a5, 0x0001, UNICODE_LETTER},
+	{0x1d4a9, 0x0003, UNICODE_LETTER},
+	{0x1d4ae, 0x000b, UNICODE_LETTER},
+	{0x1d4bb, 0x0000, UNICODE_LETTER},
+	{0x1d4bd, 0x0006, UNICODE_LETTER},
+	{0x1d4c5, 0x0040, UNICODE_LETTER},
+	{0x1d507, 0x0003, UNICODE_LETTER},
+	{0x1d50d, 0x0007, UNICODE_LETTER},
+	{0x1d516, 0x0006, UNICODE_LETTER},
+	{0x1d51e, 0x001b, UNICODE_LETTER},
+	{0x1d53b, 0x0003, UNICODE_LETTER},
+	{0x1d540, 0x0004, UNICODE_LETTER},
+	{0x1d546, 0x0000, UNICODE_LETTER},
+	{0x1d54a, 0x0006, UNICODE_LETTER},
+	{0x1d552, 0x0153, UNICODE_LETTER},
+	{0x1d6a8, 0x0018, UNICODE_LETTER},
+	{0x1d6c2, 0x0018, UNICODE_LETTER},
+	{0x1d6dc, 0x001e, UNICODE_LETTER},
+	{0x1d6fc, 0x0018, UNICODE_LETTER},
+	{0x1d716, 0x001e, UNICODE_LETTER},
+	{0x1d736, 0x0018, UNICODE_LETTER},
+	{0x1d750, 0x001e, UNICODE_LETTER},
+	{0x1d770, 0x0018, UNICODE_LETTER},
+	{0x1d78a, 0x001e, UNICODE_LETTER},
+	{0x1d7aa, 0x0018, UNICODE_LETTER},
+	{0x1d7c4, 0x0007, UNICODE_LETTER},
+	{0x1d7ce, 0x0031, UNICODE_NUMBER},
+	{0x1da00, 0x0036, UNICODE_LETTER},
+	{0x1da3b, 0x0031, UNICODE_LETTER},
+	{0x1da75, 0x0000, UNICODE_LETTER},
+	{0x1da84, 0x0000, UNICODE_LETTER},
+	{0x1da9b, 0x0004, UNICODE_LETTER},
+	{0x1daa1, 0x000e, UNICODE_LETTER},
+	{0x1df00, 0x001e, UNICODE_LETTER},
+	{0x1e000, 0x0006, UNICODE_LETTER},
+	{0x1e008, 0x0010, UNICODE_LETTER},
+	{0x1e01b, 0x0006, UNICODE_LETTER},
+	{0x1e023, 0x0001, UNICODE_LETTER},
+	{0x1e026, 0x0004, UNICODE_LETTER},
+	{0x1e100, 0x002c, UNICODE_LETTER},
+	{0x1e130, 0x000d, UNICODE_LETTER},
+	{0x1e140, 0x0009, UNICODE_NUMBER},
+	{0x1e14e, 0x0000, UNICODE_LETTER},
+	{0x1e290, 0x001e, UNICODE_LETTER},
+	{0x1e2c0, 0x002f, UNICODE_LETTER},
+	{0x1e2f0, 0x0009, UNICODE_NUMBER},
+	{0x1e7e0, 0x0006, UNICODE_LETTER},
+	{0x1e7e8, 0x0003, UNICODE_LETTER},
+	{0x1e7ed, 0x0001, UNICODE_LETTER},
+	{0x1e7f0, 0x000e, UNICODE_LETTER},
+	{0x1e800, 0x00c4, UNICODE_LETTER},
+	{0x1e8c7, 0x0008, UNICODE_NUMBER},
+	{0x1e8d0, 0x0006, UNICODE_LETTER},
+	{0x1e900, 0x004b, UNICODE_LETTER},
+	{0x1e950, 0x0009, UNICODE_NUMBER},
+	{0x1ec71, 0x003a, UNICODE_NUMBER},
+	{0x1ecad, 0x0002, UNICODE_NUMBER},
+	{0x1ecb1, 0x0003, UNICODE_NUMBER},
+	{0x1ed01, 0x002c, UNICODE_NUMBER},
+	{0x1ed2f, 0x000e, UNICODE_NUMBER},
+	{0x1ee00, 0x0003, UNICODE_LETTER},
+	{0x1ee05, 0x001a, UNICODE_LETTER},
+	{0x1ee21, 0x0001, UNICODE_LETTER},
+	{0x1ee24, 0x0000, UNICODE_LETTER},
+	{0x1ee27, 0x0000, UNICODE_LETTER},
+	{0x1ee29, 0x0009, UNICODE_LETTER},
+	{0x1ee34, 0x0003, UNICODE_LETTER},
+	{0x1ee39, 0x0000, UNICODE_LETTER},
+	{0x1ee3b, 0x0000, UNICODE_LETTER},
+	{0x1ee42, 0x0000, UNICODE_LETTER},
+	{0x1ee47, 0x0000, UNICODE_LETTER},
+	{0x1ee49, 0x0000, UNICODE_LETTER},
+	{0x1ee4b, 0x0000, UNICODE_LETTER},
+	{0x1ee4d, 0x0002, UNICODE_LETTER},
+	{0x1ee51, 0x0001, UNICODE_LETTER},
+	{0x1ee54, 0x0000, UNICODE_LETTER},
+	{0x1ee57, 0x0000, UNICODE_LETTER},
+	{0x1ee59, 0x0000, UNICODE_LETTER},
+	{0x1ee5b, 0x0000, UNICODE_LETTER},
+	{0x1ee5d, 0x0000, UNICODE_LETTER},
+	{0x1ee5f, 0x0000, UNICODE_LETTER},
+	{0x1ee61, 0x0001, UNICODE_LETTER},
+	{0x1ee64, 0x0000, UNICODE_LETTER},
+	{0x1ee67, 0x0003, UNICODE_LETTER},
+	{0x1ee6c, 0x0006, UNICODE_LETTER},
+	{0x1ee74, 0x0003, UNICODE_LETTER},
+	{0x1ee79, 0x0003, UNICODE_LETTER},
+	{0x1ee7e, 0x0000, UNICODE_LETTER},
+	{0x1ee80, 0x0009, UNICODE_LETTER},
+	{0x1ee8b, 0x0010, UNICODE_LETTER},
+	{0x1eea1, 0x0002, UNICODE_LETTER},
+	{0x1eea5, 0x0004, UNICODE_LETTER},
+	{0x1eeab, 0x0010, UNICODE_LETTER},
+	{0x1f100, 0x000c, UNICODE_NUMBER},
+	{0x1fbf0, 0x0009, UNICODE_NUMBER},
+	{0x20000, 0xa6df, UNICODE_LETTER},
+	{0x2a700, 0x1038, UNICODE_LETTER},
+	{0x2b740, 0x00dd, UNICODE_LETTER},
+	{0x2b820, 0x1681, UNICODE_LETTER},
+	{0x2ceb0, 0x1d30, UNICODE_LETTER},
+	{0x2f800, 0x021d, UNICODE_LETTER},
+	{0x30000, 0x134a, UNICODE_LETTER},
+	{0xe0100, 0x00ef, UNICODE_LETTER},
+};
+
+const size_t unicodeNumRanges = 794;
+
+const uint8_t unicodeFoldIndex[4352] =
+{
+	0, 1, 2, 3, 4, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	7, 6, 6, 8, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 10, 11,
+	6, 12, 6, 6, 13, 6, 6, 6, 6, 6, 6, 6, 14, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 15, 16, 6, 6, 6, 17, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 18,
+	6, 6, 6, 6, 19, 20, 6, 6, 6, 6, 6, 6, 21, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 22, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 23, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 24, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+};
+
+const int32_t unicodeFoldBlocks[25][256] =
+{
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 775, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 0, 32, 32, 32, 32, 32, 32, 32, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 1,
+		0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, -121, 1, 0, 1, 0, 1, 0, -268,
+		0, 210, 1, 0, 1, 0, 206, 1, 0, 205, 205, 1, 0, 0, 79, 202,
+		203, 1, 0, 205, 207, 0, 211, 209, 1, 0, 0, 0, 211, 213, 0, 214,
+		1, 0, 1, 0, 1, 0, 218, 1, 0, 218, 0, 0, 1, 0, 218, 1,
+		0, 217, 217, 1, 0, 1, 0, 219, 1, 0, 0, 0, 1, 0, 0, 0,
+		0, 0, 0, 0, 2, 1, 0, 2, 1, 0, 2, 1, 0, 1, 0, 1,
+		0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		0, 2, 1, 0, 1, 0, -97, -56, 1, 0, 1, 0, 1, 0, 1, 0,
+	},
+	{
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		-130, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 10795, 1, 0, -163, 10792, 0,
+		0, 1, 0, -195, 69, 71, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 116,
+		0, 0, 0, 0, 0, 0, 38, 0, 37, 37, 37, 0, 64, 0, 63, 63,
+		0, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 0, 32, 32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+		-30, -25, 0, 0, 0, -15, -22, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		-54, -48, 0, 0, -60, -64, 0, 1, 0, -7, 1, 0, 0, -130, -130, -130,
+	},
+	{
+		80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+		32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		15, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+	},
+	{
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		0, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264,
+		7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264,
+		7264, 7264, 7264, 7264, 7264, 7264, 0, 7264, 0, 0, 0, 0, 0, 7264, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -8, -8, -8, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		-6222, -6221, -6212, -6210, -6210, -6211, -6204, -6180, 35267, 0, 0, 0, 0, 0, 0, 0,
+		-3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008,
+		-3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008,
+		-3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008, 0, 0, -3008, -3008, -3008,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -58, 0, 0, -7615, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -8, -8, -8, -8, -8,
+		0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -8, -8, -8, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -8, -8, -8, -8, -8,
+		0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -8, -8, -8, -8, -8,
+		0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -8, -8, -8, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, -8, 0, -8, 0, -8, 0, -8,
+		0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -8, -8, -8, -8, -8,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -8, -8, -8, -8, -8,
+		0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -8, -8, -8, -8, -8,
+		0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -8, -8, -8, -8, -8, -8,
+		0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -74, -74, -9, 0, -7173, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, -86, -86, -86, -86, -9, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -100, -100, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, -8, -8, -112, -112, -7, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, -128, -128, -126, -126, -9, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, -7517, 0, 0, 0, -8383, -8262, 0, 0, 0, 0,
+		0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, -10743, -3814, -10727, 0, 0, 1, 0, 1, 0, 1, 0, -10780, -10749, -10783,
+		-10782, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -10815, -10815,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0,
+		0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, -35332, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, -42280, 0, 0,
+		1, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, 1, 0, 1, 0, 1, 0, -42308, -42319, -42315, -42305, -42308, 0,
+		-42258, -42282, -42261, 928, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+		1, 0, 1, 0, -48, -42307, -35384, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+		1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		-38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864,
+		-38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864,
+		-38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864,
+		-38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864,
+		-38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+		40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+		40, 40, 40, 40, 40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+		40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+		40, 40, 40, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39,
+		39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 0, 39, 39, 39, 39,
+		39, 39, 39, 0, 39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+		64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+		64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+		64, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		34, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+};
@@ -20,6 +20,17 @@
 #include "utils.h"
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _MSC_VER
+#include <direct.h>
+#endif //MSC_VER
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif //_WIN32
 
 
 bool string_copy(char *dst, const char *src, const size_t cnt)
@@ -58,6 +69,86 @@ bool file_open(FILE **filePointer, const char *path, const char *flags)
 #endif //MSC_VER
 }
 
+bool file_tell(FILE *filePointer, uint64_t *offset)
+{
+#ifndef _MSC_VER
+	const off_t pos = ftello(filePointer);
+#else
+	const __int64 pos = _ftelli64(filePointer);
+#endif //MSC_VER
+	if (pos < 0) return false;
+
+	*offset = (uint64_t)pos;
+	return true;
+}
+
+bool file_seek(FILE *filePointer, const uint64_t offset)
+{
+#ifndef _MSC_VER
+	return (fseeko(filePointer, (off_t)offset, SEEK_SET) == 0);
+#else
+	return (_fseeki64(filePointer, (__int64)offset, SEEK_SET) == 0);
+#endif //MSC_VER
+}
+
+bool file_stats(const char *path, uint64_t *size, int64_t *mtime)
+{
+#ifndef _MSC_VER
+	struct stat st;
+	if (stat(path, &st) != 0) return false;
+#else
+	struct _stat64 st;
+	if (_stat64(path, &st) != 0) return false;
+#endif //MSC_VER
+
+	*size = (uint64_t)st.st_size;
+	*mtime = (int64_t)st.st_mtime;
+	return true;
+}
+
+bool dir_create(const char *path)
+{
+#ifndef _MSC_VER
+	if (mkdir(path, 0777) == 0) return true;
+#else
+	if (_mkdir(path) == 0) return true;
+#endif //MSC_VER
+
+	return (errno == EEXIST);
+}
+
+void* file_map(const char *path, const size_t length)
+{
+#ifndef _WIN32
+	const int fd = open(path, O_RDONLY);
+	if(fd < 0) return NULL;
+	void *mapping = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	return (mapping != MAP_FAILED) ? mapping : NULL;
+#else
+	FILE *fp = NULL;
+	if(!file_open(&fp, path, "rb")) return NULL;
+	void *mapping = malloc(length);
+	if((mapping != NULL) && (fread(mapping, length, 1, fp) != 1))
+	{
+		free(mapping);
+		mapping = NULL;
+	}
+	fclose(fp);
+	return mapping;
+#endif //_WIN32
+}
+
+void file_unmap(void *mapping, const size_t length)
+{
+#ifndef _WIN32
+	munmap(mapping, length);
+#else
+	(void)length;
+	free(mapping);
+#endif //_WIN32
+}
+
 size_t next_2power(const size_t num)
 {
 	if (num == 0) return 1;
@@ -96,3 +187,15 @@ uint64_t fnvhash(const uint8_t *hword, const uint32_t wlen)
 
 	return hash;
 }
+
+uint32_t num_of_digits(const size_t num)
+{
+	return(uint32_t)snprintf(NULL, 0, "%ld", num);
+}
+
+void print_dash_line(const uint32_t dashNum)
+{
+	for(uint32_t i = 0; i < dashNum; i++)
+		printf("%c", '-');
+	printf("\n");
+}
@@ -0,0 +1,225 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "vocabulary.h"
+#include "wordset.h"
+#include <string.h>
+
+struct Vocabulary
+{
+	/// The words of the vocabulary.
+	WordSet *set;
+	/// The count of each word, at the index of the word in the set.
+	size_t *counts;
+	/// The number of occurrences of the words of the vocabulary.
+	size_t counted;
+	/// The number of occurrences of the words outside the vocabulary.
+	size_t discarded;
+};
+
+/// @brief A word found in the input, gathered to be printed.
+typedef struct
+{
+	/// Pointer to the characters of the word.
+	const char *letters;
+	/// The length of the word.
+	uint32_t length;
+	/// The number of occurrences of the word.
+	size_t count;
+}VocabEntry;
+
+Vocabulary* Vocabulary_create(const char *path, const TokenRules *rules)
+{
+	Vocabulary *vocab = (Vocabulary*) calloc(1, sizeof(Vocabulary));
+	if(vocab == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the vocabulary.\n");
+		return NULL;
+	}
+	vocab->set = WordSet_create(path, rules, "vocabulary");
+	if(vocab->set == NULL)
+	{
+		Vocabulary_destroy(&vocab);
+		return NULL;
+	}
+	vocab->counts = (size_t*) calloc((size_t)WordSet_size(vocab->set) + 1, sizeof(size_t));
+	if(vocab->counts == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the counts of the vocabulary.\n");
+		Vocabulary_destroy(&vocab);
+		return NULL;
+	}
+
+	return vocab;
+}
+
+RetStatus Vocabulary_compile(const char *path, const char *outPath, const TokenRules *rules)
+{
+	WordSet *set = WordSet_create(path, rules, "vocabulary");
+	if(set == NULL) return GEN_FAIL;
+	/// Compiled files hold at least one word, so that any slot can be checked.
+	if(WordSet_size(set) == 0)
+	{
+		fprintf(stderr, "No words found in vocabulary file: %s\n", path);
+		WordSet_destroy(&set);
+		return GEN_FAIL;
+	}
+	const RetStatus rst = WordSet_save(set, rules, outPath);
+#ifdef _STATS
+	if(rst == SUCCESS)
+	{
+		printf("Compiled %u words of %s to %s.\n", WordSet_size(set), path, outPath);
+	}
+#endif //_STATS
+	WordSet_destroy(&set);
+
+	return rst;
+}
+
+void Vocabulary_count_word(Vocabulary *vocab, const WordBuffer *wbuf, const size_t count)
+{
+	const uint32_t index = WordSet_find(vocab->set, wbuf);
+	if(index == WORD_SET_MISSING)
+	{
+		vocab->discarded += count;
+		return;
+	}
+	vocab->counts[index] += count;
+	vocab->counted += count;
+}
+
+/**
+ * @brief Orders two entries alphabetically, like strcmp orders their words.
+ *
+ * @param[in]	a	Pointer to the first entry.
+ * @param[in]	b	Pointer to the second entry.
+ * @return	Negative, zero or positive if the first entry precedes, equals
+ * or follows the second.
+ */
+static int entry_compare(const void *a, const void *b)
+{
+	const VocabEntry *ea = (const VocabEntry*) a;
+	const VocabEntry *eb = (const VocabEntry*) b;
+	const int cmp = memcmp(ea->letters, eb->letters,
+			(ea->length < eb->length) ? ea->length : eb->length);
+	if(cmp != 0) return cmp;
+	return (ea->length > eb->length) - (ea->length < eb->length);
+}
+
+/// @brief The state of an iteration over the sorted words found.
+typedef struct
+{
+	/// Pointer to the array of the entries of the words.
+	const VocabEntry *entries;
+	/// The number of entries.
+	size_t numEntries;
+	/// The position of the next entry.
+	size_t pos;
+}EntryIter;
+
+/**
+ * @brief Gets the next word found in the input.
+ *
+ * @param[in, out]	iter	Pointer to the state of the iteration.
+ * @param[out]		word	Pointer to the bytes of the word, or NULL past the last word.
+ * @param[out]		length	Pointer to the length of the word.
+ * @param[out]		count	Pointer to the count of the word.
+ * @return	Return the status of the routine.
+ */
+static RetStatus entry_next(void *iter, const char **word, uint32_t *length, size_t *count)
+{
+	EntryIter *it = (EntryIter*)iter;
+	if(it->pos == it->numEntries)
+	{
+		*word = NULL;
+		return SUCCESS;
+	}
+	const VocabEntry *entry = &(it->entries[it->pos++]);
+	*word = entry->letters;
+	*length = entry->length;
+	*count = entry->count;
+
+	return SUCCESS;
+}
+
+RetStatus Vocabulary_count_print(const Vocabulary *vocab)
+{
+	/// Only the words found in the input are printed, sorted once at the end.
+	const uint32_t numWords = WordSet_size(vocab->set);
+	VocabEntry *entries = (VocabEntry*) malloc(((size_t)numWords + 1) * sizeof(VocabEntry));
+	if(entries == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the words of the vocabulary.\n");
+		return GEN_FAIL;
+	}
+	size_t numFound = 0;
+	uint32_t maxLength = 0;
+	size_t maxCount = 0;
+	for(uint32_t i = 0; i < numWords; i++)
+	{
+		if(vocab->counts[i] == 0) continue;
+		VocabEntry *entry = &(entries[numFound++]);
+		entry->letters = WordSet_word(vocab->set, i, &(entry->length));
+		entry->count = vocab->counts[i];
+		if(entry->length > maxLength) maxLength = entry->length;
+		if(entry->count > maxCount) maxCount = entry->count;
+	}
+	if(numFound == 0)
+	{
+		free(entries);
+		return SUCCESS;
+	}
+	qsort(entries, numFound, sizeof(VocabEntry), entry_compare);
+
+	EntryIter iter = {entries, numFound, 0};
+	if(CountTable_print("word", "Word", maxLength, maxCount, entry_next, &iter) != SUCCESS)
+	{
+		free(entries);
+		return GEN_FAIL;
+	}
+
+#ifdef _STATS
+	for(size_t i = 0; i < numFound; i++)
+	{
+		if(entries[i].count != maxCount) continue;
+		printf("Most common word: \"%.*s\", appearing %ld time(s)",
+				(int)entries[i].length, entries[i].letters, maxCount);
+		break;
+	}
+#endif //_STATS
+	free(entries);
+
+	return SUCCESS;
+}
+
+void Vocabulary_stats_print(const Vocabulary *vocab)
+{
+	printf("\nVocabulary statistics:\n");
+	printf("\tVocabulary words: %u\n", WordSet_size(vocab->set));
+	printf("\tOccurrences counted: %ld\n", vocab->counted);
+	printf("\tOccurrences discarded: %ld\n", vocab->discarded);
+}
+
+void Vocabulary_destroy(Vocabulary **vocab)
+{
+	if((*vocab)->set != NULL) WordSet_destroy(&((*vocab)->set));
+	free((*vocab)->counts);
+	free(*vocab);
+	*vocab = NULL;
+}
@@ -0,0 +1,191 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "window.h"
+#include <string.h>
+
+/// The initial capacity of the ring of a window without a word limit.
+#define INITIAL_RING_CAPACITY 1024
+/// The percentage of unused pool characters triggering a compaction.
+#define POOL_WASTE_LIMIT 50
+
+struct SlidingWindow
+{
+	/// The ring of the references of the words in the window.
+	size_t *refs;
+	/// The ring of the arrival times of the words, NULL without an age limit.
+	int64_t *times;
+	/// The capacity of the rings.
+	size_t capacity;
+	/// The position of the oldest word in the rings.
+	size_t head;
+	/// The number of words in the window.
+	size_t length;
+	/// The maximum number of words in the window, 0 for no limit.
+	size_t maxWords;
+	/// The maximum age of the words in the window, 0 for no limit.
+	int64_t maxSeconds;
+	/// The number of words removed from the window.
+	uint64_t retired;
+	/// The number of compactions of the table's strings pool.
+	uint64_t compactions;
+};
+
+SlidingWindow* SlidingWindow_create(const size_t maxWords, const int64_t maxSeconds)
+{
+	SlidingWindow *win = (SlidingWindow*) calloc(1, sizeof(SlidingWindow));
+	if(win == NULL)
+	{
+		fprintf(stderr, "Initial allocation for the Sliding Window failed.\n");
+		return NULL;
+	}
+
+	win->maxWords = maxWords;
+	win->maxSeconds = maxSeconds;
+	/// A window limited in words never needs a larger ring.
+	win->capacity = (maxWords != 0) ? maxWords : INITIAL_RING_CAPACITY;
+	win->refs = (size_t*) calloc(win->capacity, sizeof(size_t));
+	if(maxSeconds != 0) win->times = (int64_t*) calloc(win->capacity, sizeof(int64_t));
+	if((win->refs == NULL) || ((maxSeconds != 0) && (win->times == NULL)))
+	{
+		fprintf(stderr, "Failed to allocate a ring of %ld words "
+				"for the Sliding Window.\n", win->capacity);
+		SlidingWindow_destroy(&win);
+		return NULL;
+	}
+
+	return win;
+}
+
+/**
+ * @brief Moves the words of the window to new rings of the specified capacity,
+ * starting from their first position.
+ *
+ * @param[in, out]	win			Pointer to the window.
+ * @param[in]		newCapacity	The capacity of the new rings.
+ * @return	Returns the status of the routine.
+ */
+static RetStatus ring_realloc(SlidingWindow *win, const size_t newCapacity)
+{
+	size_t *newRefs = (size_t*) calloc(newCapacity, sizeof(size_t));
+	int64_t *newTimes = NULL;
+	if(win->times != NULL) newTimes = (int64_t*) calloc(newCapacity, sizeof(int64_t));
+	if((newRefs == NULL) || ((win->times != NULL) && (newTimes == NULL)))
+	{
+		fprintf(stderr, "Failed to allocate a ring of %ld words "
+				"for the Sliding Window.\n", newCapacity);
+		free(newRefs);
+		free(newTimes);
+		return GEN_FAIL;
+	}
+
+	for(size_t i = 0; i < win->length; i++)
+	{
+		const size_t pos = (win->head + i) % win->capacity;
+		newRefs[i] = win->refs[pos];
+		if(newTimes != NULL) newTimes[i] = win->times[pos];
+	}
+
+	free(win->refs);
+	free(win->times);
+	win->refs = newRefs;
+	win->times = newTimes;
+	win->capacity = newCapacity;
+	win->head = 0;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Removes the oldest word of the window from the table.
+ *
+ * @param[in, out]	win		Pointer to the window.
+ * @param[in, out]	whtab	Pointer to the table counting the window's words.
+ * @return	Returns the status of the routine.
+ */
+static RetStatus window_retire(SlidingWindow *win, WordHashTable *whtab)
+{
+	if(WordHashTable_remove_ref(whtab, win->refs[win->head]) != SUCCESS) return GEN_FAIL;
+
+	win->head = (win->head + 1) % win->capacity;
+	win->length--;
+	win->retired++;
+
+	return SUCCESS;
+}
+
+RetStatus SlidingWindow_push(SlidingWindow *win, WordHashTable *whtab,
+		const WordBuffer *wbuf, const int64_t now)
+{
+	/// Words older than the age limit are retired first.
+	while((win->maxSeconds != 0) && (win->length > 0) &&
+		(now - win->times[win->head] >= win->maxSeconds))
+	{
+		if(window_retire(win, whtab) != SUCCESS) return GEN_FAIL;
+	}
+
+	if(win->length == win->capacity)
+	{
+		/// A full window retires its oldest word to make room for the new one,
+		/// unless it is only limited in age.
+		if(win->maxWords != 0)
+		{
+			if(window_retire(win, whtab) != SUCCESS) return GEN_FAIL;
+		}
+		else if(ring_realloc(win, 2 * win->capacity) != SUCCESS) return GEN_FAIL;
+	}
+
+	size_t ref = 0;
+	if(WordHashTable_count_word_ref(whtab, wbuf, &ref) != SUCCESS) return GEN_FAIL;
+
+	const size_t tail = (win->head + win->length) % win->capacity;
+	win->refs[tail] = ref;
+	if(win->times != NULL) win->times[tail] = now;
+	win->length++;
+
+	/// Compaction moves the strings of the words, so the references
+	/// of the window are updated along, once placed contiguously.
+	if(WordHashTable_pool_waste_above(whtab, POOL_WASTE_LIMIT))
+	{
+		if((ring_realloc(win, win->capacity) != SUCCESS) ||
+			(WordHashTable_compact(whtab, win->refs, win->length) != SUCCESS))
+		{
+			fprintf(stderr, "Failed to compact the table of the Sliding Window.\n");
+			return GEN_FAIL;
+		}
+		win->compactions++;
+	}
+
+	return SUCCESS;
+}
+
+void SlidingWindow_stats_print(const SlidingWindow *win)
+{
+	printf("\nSliding Window statistics:\n");
+	printf("\tWords in the window: %ld\n", win->length);
+	printf("\tWords retired from the window: %ld\n", win->retired);
+	printf("\tStrings pool compactions: %ld\n", win->compactions);
+}
+
+void SlidingWindow_destroy(SlidingWindow **win)
+{
+	free((*win)->refs);
+	free((*win)->times);
+	free(*win);
+	*win = NULL;
+}
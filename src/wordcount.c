@@ -19,467 +19,954 @@
 
 #include "utils.h"
 #include "memstructs.h"
+#include "options.h"
+#include "checkpoint.h"
+#include "filecache.h"
+#include "window.h"
+#include "timebuckets.h"
+#include "tokenstream.h"
+#include "tokenizer.h"
+#include "inputstream.h"
+#include "stopwords.h"
+#include "stemmer.h"
+#include "linetable.h"
+#include "hotwords.h"
+#include "wordtree.h"
+#include "vocabulary.h"
+#include "wordfst.h"
+#include "rollup.h"
+#include "countdiff.h"
+#include "manifest.h"
+#include <string.h>
+#include <time.h>
+
+#define INITIAL_WORD_VECTOR_LENGTH 128
+/// The maximum number of words tokenized before being counted.
+#define INPUT_CHUNK_WORDS (1 << 20)
+/// The initial capacity of a table merging the counts of several inputs.
+#define MERGED_TABLE_CAPACITY 1024
+/// The maximum number of distinct lines gathered before being tokenized.
+#define DEDUP_TABLE_LINES (1 << 16)
+/// The maximum number of characters of the lines gathered before being tokenized.
+#define DEDUP_TABLE_BYTES (1 << 24)
+/// The exit status of a run whose manifest listed documents that could not be opened.
+#define EXIT_SKIPPED_DOCUMENTS 2
+
+/// @brief The state of the counting, shared by all the inputs.
+typedef struct
+{
+	/// The table the words are counted in, NULL until the first input is read.
+	WordHashTable *whtab;
+	/// The radix tree the words are counted in instead of the table, NULL if disabled.
+	WordTree *tree;
+	/// The fixed vocabulary the words are counted in instead of the table,
+	/// NULL if disabled.
+	Vocabulary *vocab;
+	/// The checkpoint of the run, NULL if disabled.
+	Checkpoint *chkp;
+	/// The cache of the counts of each input file, NULL if disabled.
+	FileCache *cache;
+	/// The sliding window over the words counted, NULL if disabled.
+	SlidingWindow *window;
+	/// The counts per time bucket of timestamped lines, NULL if disabled.
+	TimeBuckets *buckets;
+	/// The stream of the ids of the words counted, NULL if disabled.
+	TokenStream *tokens;
+	/// The rules splitting the input into words.
+	TokenRules *rules;
+	/// The words excluded from the counts, NULL if none.
+	StopWords *stop;
+	/// The stemmer the words are counted through, NULL if disabled.
+	Stemmer *stemmer;
+	/// The distinct lines of the input waiting to be tokenized,
+	/// NULL unless repeated lines are tokenized once.
+	LineTable *lines;
+	/// The cache of the most frequent words in front of the table,
+	/// NULL unless the words are only counted.
+	HotWords *hot;
+	/// The counts of the prefixes of the words, NULL unless they are rolled up.
+	PrefixRollup *rollup;
+	/// The reader kept warm across the inputs, NULL to create one per input.
+	InputReader *reader;
+	/// Whether the reader of the first input is kept for the next ones.
+	bool keepReader;
+	/// The number of words counted between two reports of the window,
+	/// 0 if disabled.
+	size_t reportInterval;
+	/// The maximum number of words tokenized before being counted.
+	size_t chunkWords;
+	/// Whether the input is tokenized as it arrives rather than in blocks.
+	bool streamed;
+	/// The total number of words counted.
+	size_t totalWords;
+	/// The number of lines skipped for preceding any timestamp.
+	size_t untimedLines;
+	/// The number of words cut at the maximum length.
+	size_t truncatedWords;
+}CountContext;
 
 /**
- * @brief Tokenization of the input text to a vector of Word Buffers.
- * @details Reads the stream input on a character basis to construct words,
- * which are then pushed as Word Buffers in a vector.
+ * @brief Counts the words of a chunk of the input.
+ * @details Chunks of repeated lines are counted once for all their occurrences,
+ * which is never the case for sliding windows and token id streams.
  *
- * @param[out]	vec	Pointer to the Word Buffer Vector to be filled.
- * @param[in]	fp	Pointer to the input file, NULL if the stdin is to be used.
+ * @param[in, out]	ctx				Pointer to the counting context.
+ * @param[in]		vec				Pointer to the Word Buffer Vector holding the chunk.
+ * @param[in]		multiplicity	The number of times the chunk occurs in the input.
  * @return	Return the status of the routine.
  */
-RetStatus get_input(WordBufferVector *vec, FILE *fp);
+static RetStatus count_chunk(CountContext *ctx, const WordBufferVector *vec,
+		const size_t multiplicity)
+{
+	const size_t chunkSize = WordBufferVector_get_size(vec);
+	const int64_t now = (int64_t)time(NULL);
 
+	/// Iterating over the WordBuffers in the vector,
+	/// each word is added to the Hash Table or
+	/// its counter is incremented if it already exists,
+	for(size_t i = 0; i < chunkSize; i++)
+	{
+		const WordBuffer *word = WordBufferVector_at(vec, i);
+		const WordBuffer *wbuf = word;
+		/// Stop words never reach the table, while the rest
+		/// are counted by their stem if requested.
+		if((ctx->stop != NULL) && StopWords_contains(ctx->stop, wbuf)) continue;
+		if((ctx->stemmer != NULL) && (Stemmer_stem(ctx->stemmer, wbuf, &wbuf) != SUCCESS))
+			return GEN_FAIL;
+		RetStatus rst = SUCCESS;
+		if(ctx->window != NULL) rst = SlidingWindow_push(ctx->window, ctx->whtab, wbuf, now);
+		else if(ctx->tokens != NULL) rst = TokenStream_count_word(ctx->tokens, ctx->whtab, wbuf);
+		else if(ctx->tree != NULL) rst = WordTree_count_word(ctx->tree, wbuf, multiplicity);
+		else if(ctx->vocab != NULL) Vocabulary_count_word(ctx->vocab, wbuf, multiplicity);
+		/// The cache is looked up by the words as they are read, so it only
+		/// takes those which are counted as they are.
+		else if((ctx->hot != NULL) && (wbuf == word))
+			rst = HotWords_count_word(ctx->hot, ctx->whtab, wbuf, multiplicity);
+		else rst = WordHashTable_count_word(ctx->whtab, wbuf, multiplicity);
+		if(rst != SUCCESS)
+		{
+			fprintf(stderr, "Failed to insert word '%s' in the table.\n",
+					WordBufferVector_word_at(vec, i));
+			return GEN_FAIL;
+		}
+		ctx->totalWords += multiplicity;
+
+		if((ctx->reportInterval != 0) && (ctx->totalWords % ctx->reportInterval == 0))
+		{
+			WordHashTable_count_print(ctx->whtab);
+			printf("\n");
+			fflush(stdout);
+		}
+	}
+
+	return SUCCESS;
+}
 
-#define INITIAL_WORD_VECTOR_LENGTH 128
 /**
- * @brief Uses a Hash Table of to count the occurrences of each unique word
- * and prints the result in alphabetical order.
+ * @brief Counts the words of a line in the time bucket of its timestamp.
+ *
+ * @param[in, out]	ctx			Pointer to the counting context.
+ * @param[in, out]	tok			Pointer to the tokenizer of the line.
+ * @param[in, out]	vec			Pointer to the Word Buffer Vector holding the line.
+ * @param[in]		timed		Whether a timestamp preceded the line.
+ * @param[in]		lineTime	The time of the line in seconds since the Epoch.
+ * @return	Return the status of the routine.
  */
-int main(int argc, char *argv[])
+static RetStatus count_timed_line(CountContext *ctx, Tokenizer *tok,
+		WordBufferVector *vec, const bool timed, const int64_t lineTime)
 {
-	FILE* inpf;
-	/// At most one argument expected, which is the name of the input text file.
-	switch(argc)
+	if(Tokenizer_finish(tok, vec) != SUCCESS) return GEN_FAIL;
+
+	const size_t lineWords = WordBufferVector_get_size(vec);
+	if(!timed)
 	{
-		case 1:
-		{
-			inpf = NULL;
-			break;
-		}
-		case 2:
+		if(lineWords != 0) ctx->untimedLines++;
+		return SUCCESS;
+	}
+	for(size_t i = 0; i < lineWords; i++)
+	{
+		const WordBuffer *wbuf = WordBufferVector_at(vec, i);
+		if((ctx->stop != NULL) && StopWords_contains(ctx->stop, wbuf)) continue;
+		if((ctx->stemmer != NULL) && (Stemmer_stem(ctx->stemmer, wbuf, &wbuf) != SUCCESS))
+			return GEN_FAIL;
+		if(TimeBuckets_count_word(ctx->buckets, ctx->whtab, wbuf, lineTime) != SUCCESS)
 		{
-			if(!file_open(&inpf, argv[1], "r"))
-			{
-				printf("Failed to open file: %s. Exiting...\n", argv[1]);
-				return EXIT_FAILURE;
-			}
-			break;
+			fprintf(stderr, "Failed to insert word '%s' in the time buckets.\n",
+					WordBufferVector_word_at(vec, i));
+			return GEN_FAIL;
 		}
-		default:
+		ctx->totalWords++;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Counts the words of each timestamped line of the input
+ * in the time bucket of the line.
+ * @details Lines without a timestamp continue the previous line,
+ * like the stack traces of log records, while those preceding
+ * the first timestamp of the input are skipped.
+ *
+ * @param[in, out]	ctx		Pointer to the counting context.
+ * @param[in, out]	vec		Pointer to the Word Buffer Vector used for the lines.
+ * @param[in, out]	stream	Pointer to the input stream.
+ * @return	Return the status of the routine.
+ */
+static RetStatus count_timed_input(CountContext *ctx, WordBufferVector *vec,
+		InputStream *stream)
+{
+	if(ctx->whtab == NULL)
+	{
+		ctx->whtab = WordHashTable_create(MERGED_TABLE_CAPACITY);
+		if(ctx->whtab == NULL)
 		{
-			printf("Too many arguments. %d were passed with a maximum of 1 "
-					"accepted. Exiting...\n", argc - 1);
-			return EXIT_FAILURE;
+			fprintf(stderr, "Insufficient memory for creating the Hash Table.\n");
+			return GEN_FAIL;
 		}
 	}
+	Tokenizer *tok = Tokenizer_create(ctx->rules);
+	if(tok == NULL) return GEN_FAIL;
+
+	RetStatus rst = SUCCESS;
+	bool timed = false;
+	int64_t lineTime = 0;
+	/// Lines longer than the buffers are read in several parts,
+	/// the first of which holds the timestamp.
+	const char *line = NULL;
+	size_t lineLen = 0;
+	bool lineStart = true;
+	while(((rst = InputStream_next(stream, true, &line, &lineLen)) == SUCCESS) && (lineLen != 0))
+	{
+		const bool lineEnd = (lineLen > 0) && (line[lineLen - 1] == '\n');
+
+		size_t tsLen = 0;
+		if(lineStart && TimeBuckets_parse_timestamp(line, lineLen, &lineTime, &tsLen))
+			timed = true;
+		if(lineStart) WordBufferVector_clear(vec);
+		lineStart = lineEnd;
+
+		size_t consumed = 0;
+		rst = Tokenizer_feed(tok, vec, line + tsLen, lineLen - tsLen, 0, &consumed);
+		if((rst != SUCCESS) || !lineEnd) continue;
+		rst = count_timed_line(ctx, tok, vec, timed, lineTime);
+	}
+	/// The last line may not end with a new line.
+	if((rst == SUCCESS) && !lineStart) rst = count_timed_line(ctx, tok, vec, timed, lineTime);
+	ctx->truncatedWords += Tokenizer_truncated(tok);
+	Tokenizer_destroy(&tok);
 
-	/// Creates a Vector of WordBuffers of a predefined initial length
-	/// to host the words of the text.
-	WordBufferVector *inputVector =
-			WordBufferVector_create(INITIAL_WORD_VECTOR_LENGTH);
-	if(inputVector == NULL)
+	return rst;
+}
+
+/**
+ * @brief Counts the words of the lines gathered in the line table,
+ * tokenizing each distinct line once, and empties the table.
+ * @details A checkpoint is saved afterwards if due, as the lines read
+ * up to the offset are then all counted.
+ *
+ * @param[in, out]	ctx		Pointer to the counting context.
+ * @param[in, out]	tok		Pointer to the tokenizer, placed between lines.
+ * @param[in, out]	vec		Pointer to the Word Buffer Vector used for the lines.
+ * @param[in, out]	stream	Pointer to the input stream.
+ * @param[in]		offset	The offset of the input following the lines.
+ * @return	Return the status of the routine.
+ */
+static RetStatus count_dedup_lines(CountContext *ctx, Tokenizer *tok, WordBufferVector *vec,
+		InputStream *stream, const uint64_t offset)
+{
+	const size_t numLines = LineTable_get_size(ctx->lines);
+	for(size_t i = 0; i < numLines; i++)
 	{
-		if(inpf != NULL) fclose(inpf);
-		fprintf(stderr, "Failed to create Word Buffer Vector "
-				"for input processing. Exiting...\n");
-		return EXIT_FAILURE;
+		size_t lineLen = 0;
+		size_t count = 0;
+		const char *line = LineTable_line_at(ctx->lines, i, &lineLen, &count);
+		size_t consumed = 0;
+		WordBufferVector_clear(vec);
+		if((Tokenizer_feed(tok, vec, line, lineLen, 0, &consumed) != SUCCESS) ||
+			(Tokenizer_finish(tok, vec) != SUCCESS) ||
+			(count_chunk(ctx, vec, count) != SUCCESS)) return GEN_FAIL;
 	}
+	LineTable_clear(ctx->lines);
+	if((ctx->hot != NULL) && (HotWords_flush(ctx->hot, ctx->whtab) != SUCCESS)) return GEN_FAIL;
 
-	/// Converts the text passed on input to a Vector of WordBuffers.
-	if(get_input(inputVector, inpf) != SUCCESS)
+	if((ctx->chkp != NULL) && Checkpoint_due(ctx->chkp, ctx->totalWords) &&
+		(Checkpoint_save(ctx->chkp, ctx->whtab, stream, offset, ctx->totalWords) != SUCCESS))
 	{
-		fprintf(stderr, "Failed to read input. Exiting...\n");
-		WordBufferVector_destroy(&inputVector);
-		if(inpf != NULL) fclose(inpf);
-		return EXIT_FAILURE;
+		fprintf(stderr, "Failed to save checkpoint.\n");
+		return GEN_FAIL;
 	}
-	if(inpf != NULL) fclose(inpf);
 
-	/// Based on the total number of words appearing in the input, selects as
-	/// inital size for the Hash Table the closest power of 2.
-	const size_t inputSize = WordBufferVector_get_size(inputVector);
-	const size_t ceilSize = next_2power(inputSize);
-	const size_t floorSize = ceilSize / 2;
-	const size_t wtabInitSize = (inputSize - floorSize >= floorSize / 2)
-			? ceilSize : floorSize;
-#ifdef _STATS
-	printf("Input Length: %ld words\n", inputSize);
-#endif
-#ifdef _DEBUG
-	printf("Initial table size: %ld slots\n", wtabInitSize);
-#endif //_DEBUG
+	return SUCCESS;
+}
 
-	WordHashTable *hashTable = WordHashTable_create(wtabInitSize);
-	if(hashTable == NULL)
+/**
+ * @brief Counts the words of the input line by line, tokenizing
+ * each distinct line once however many times it is repeated.
+ * @details Lines are gathered in the line table along with the number
+ * of times they are read, until the table is full or the input ends.
+ * Lines too long for the buffers, read in several parts, and a last line
+ * without a new line are counted as they are read instead.
+ *
+ * @param[in, out]	ctx		Pointer to the counting context.
+ * @param[in, out]	vec		Pointer to the Word Buffer Vector used for the lines.
+ * @param[in, out]	stream	Pointer to the input stream.
+ * @return	Return the status of the routine.
+ */
+static RetStatus count_dedup_input(CountContext *ctx, WordBufferVector *vec,
+		InputStream *stream)
+{
+	if((ctx->whtab == NULL) && (ctx->tree == NULL) && (ctx->vocab == NULL))
 	{
-		fprintf(stderr, "Insufficient memory for creating "
-				"the Hash Table. Exiting...\n");
-		WordBufferVector_destroy(&inputVector);
-		return EXIT_FAILURE;
+		ctx->whtab = WordHashTable_create(MERGED_TABLE_CAPACITY);
+		if(ctx->whtab == NULL)
+		{
+			fprintf(stderr, "Insufficient memory for creating the Hash Table.\n");
+			return GEN_FAIL;
+		}
 	}
-
-	/// Iterating over the WordBuffers in the vector,
-	/// each word is added to the Hash Table or
-	/// its counter is incremented if it already exists,
-	for(size_t i = 0; i<inputSize; i++)
+	Tokenizer *tok = Tokenizer_create(ctx->rules);
+	if(tok == NULL) return GEN_FAIL;
+
+	RetStatus rst = SUCCESS;
+	const char *line = NULL;
+	size_t lineLen = 0;
+	bool lineStart = true;
+	while(((rst = InputStream_next(stream, true, &line, &lineLen)) == SUCCESS) && (lineLen != 0))
 	{
-		RetStatus rst = SUCCESS;
-		/// The memory pool used by the Table to allocate new strings,
-		/// keeps expanding if the insertion process failed due to
-		/// limited pool space.
-		while((rst = WordHashTable_add_word(hashTable, WordBufferVector_at(inputVector,i)))
-				== DATA_STRUCT_FULL)
+		const bool lineEnd = (line[lineLen - 1] == '\n');
+		if(lineStart && lineEnd)
 		{
-			if(WordHashTable_MemoryPool_expand(hashTable) != SUCCESS)
+			rst = LineTable_add(ctx->lines, line, lineLen);
+			if(rst == DATA_STRUCT_FULL)
 			{
-				fprintf(stderr, "Hash Table's String Pool is out of memory.\n");
-				WordHashTable_destroy(&hashTable);
-				WordBufferVector_destroy(&inputVector);
-				return EXIT_FAILURE;
+				/// The lines gathered so far precede this one.
+				rst = count_dedup_lines(ctx, tok, vec, stream, InputStream_offset(stream) - lineLen);
+				if(rst == SUCCESS) rst = LineTable_add(ctx->lines, line, lineLen);
+			}
+			if(rst != DATA_STRUCT_FULL)
+			{
+				if(rst != SUCCESS) break;
+				continue;
 			}
 		}
 
-		if(rst != SUCCESS)
+		/// The tokenizer is only between lines when the table is counted.
+		size_t consumed = 0;
+		WordBufferVector_clear(vec);
+		rst = Tokenizer_feed(tok, vec, line, lineLen, 0, &consumed);
+		if((rst == SUCCESS) && lineEnd) rst = Tokenizer_finish(tok, vec);
+		if(rst == SUCCESS) rst = count_chunk(ctx, vec, 1);
+		if(rst != SUCCESS) break;
+		lineStart = lineEnd;
+	}
+	if((rst == SUCCESS) && !lineStart)
+	{
+		WordBufferVector_clear(vec);
+		rst = Tokenizer_finish(tok, vec);
+		if(rst == SUCCESS) rst = count_chunk(ctx, vec, 1);
+	}
+	/// No checkpoint is due at the end of the input.
+	if(rst == SUCCESS)
+	{
+		Checkpoint *chkp = ctx->chkp;
+		ctx->chkp = NULL;
+		rst = count_dedup_lines(ctx, tok, vec, stream, InputStream_offset(stream));
+		ctx->chkp = chkp;
+	}
+	ctx->truncatedWords += Tokenizer_truncated(tok);
+	Tokenizer_destroy(&tok);
+
+	return rst;
+}
+
+/**
+ * @brief Counts the words of the input in chunks, saving checkpoints
+ * between the chunks if requested.
+ * @details The Hash Table is created based on the size of the first chunk,
+ * unless it was already created or restored from a checkpoint.
+ *
+ * @param[in, out]	ctx		Pointer to the counting context.
+ * @param[in, out]	vec		Pointer to the Word Buffer Vector used for the chunks.
+ * @param[in, out]	stream	Pointer to the input stream.
+ * @return	Return the status of the routine.
+ */
+static RetStatus count_input(CountContext *ctx, WordBufferVector *vec, InputStream *stream)
+{
+	if(ctx->buckets != NULL) return count_timed_input(ctx, vec, stream);
+	if(ctx->lines != NULL) return count_dedup_input(ctx, vec, stream);
+
+	InputReader *inp = ctx->reader;
+	if(inp != NULL) InputReader_reset(inp, stream);
+	else
+	{
+		inp = InputReader_create(stream, ctx->streamed, ctx->rules, ctx->hot);
+		if(inp == NULL) return GEN_FAIL;
+		if(ctx->keepReader) ctx->reader = inp;
+	}
+	size_t hotWords = 0;
+
+	RetStatus rst = SUCCESS;
+	do
+	{
+		/// Converts the next chunk of the input to a Vector of WordBuffers.
+		WordBufferVector_clear(vec);
+		if(InputReader_read(inp, vec, ctx->chunkWords) != SUCCESS)
 		{
-			fprintf(stderr, "Failed to insert word '%s' in the table. "
-					"Exiting...\n",	WordBufferVector_word_at(inputVector,i));
-			WordHashTable_destroy(&hashTable);
-			WordBufferVector_destroy(&inputVector);
-			return EXIT_FAILURE;
+			fprintf(stderr, "Failed to read input.\n");
+			rst = GEN_FAIL;
+			break;
 		}
 
-		/// If the Hash table reaches an occupancy percentage of at least 70%,
-		/// the table expands to avoid an increased collision rate
-		/// slowing down the insertions.
-		if(!WordHashTable_size_below(hashTable, 70))
+		if((ctx->whtab == NULL) && (ctx->tree == NULL) && (ctx->vocab == NULL))
 		{
-			if(WordHashTable_expand(hashTable) != SUCCESS)
+			/// Based on the number of words appearing in the first chunk,
+			/// selects as inital size for the Hash Table the closest power of 2.
+			const size_t chunkSize = WordBufferVector_get_size(vec) +
+					InputReader_hot_words(inp);
+			const size_t ceilSize = next_2power(chunkSize);
+			const size_t floorSize = ceilSize / 2;
+			const size_t wtabInitSize = (chunkSize - floorSize >= floorSize / 2)
+					? ceilSize : floorSize;
+#ifdef _DEBUG
+			printf("Initial table size: %ld slots\n", wtabInitSize);
+#endif //_DEBUG
+			ctx->whtab = WordHashTable_create(wtabInitSize);
+			if(ctx->whtab == NULL)
 			{
-				fprintf(stderr, "Hash Table Expansion failed! Exiting...\n");
-				WordHashTable_destroy(&hashTable);
-				WordBufferVector_destroy(&inputVector);
-				return EXIT_FAILURE;
+				fprintf(stderr, "Insufficient memory for creating "
+						"the Hash Table.\n");
+				rst = GEN_FAIL;
+				break;
 			}
 		}
-	}
 
-	/// After all words are counted, they are printed in alphabetical order.
-	WordHashTable_count_print(hashTable);
-#ifdef _STATS
-	WordHashTable_hstats_update(hashTable);
-	WordHashTable_hstats_print(hashTable);
-#endif //_STATS
+		rst = count_chunk(ctx, vec, 1);
+		/// The table is brought up to date after each chunk, along with the
+		/// words counted in the cache as they were read.
+		if((rst == SUCCESS) && (ctx->hot != NULL))
+		{
+			rst = HotWords_flush(ctx->hot, ctx->whtab);
+			ctx->totalWords += InputReader_hot_words(inp) - hotWords;
+			hotWords = InputReader_hot_words(inp);
+		}
+		if(rst != SUCCESS) break;
 
-	WordHashTable_destroy(&hashTable);
-	WordBufferVector_destroy(&inputVector);
+		/// Chunks end at word boundaries, so the offset tokenized up to
+		/// is a valid point to resume from.
+		if((ctx->chkp != NULL) && !InputReader_eof(inp) &&
+			Checkpoint_due(ctx->chkp, ctx->totalWords))
+		{
+			rst = Checkpoint_save(ctx->chkp, ctx->whtab, stream, InputReader_offset(inp),
+					ctx->totalWords);
+			if(rst != SUCCESS)
+			{
+				fprintf(stderr, "Failed to save checkpoint.\n");
+				break;
+			}
+		}
+	} while(!InputReader_eof(inp));
+	ctx->truncatedWords += InputReader_truncated(inp);
+	if(inp != ctx->reader) InputReader_destroy(&inp);
 
-	return EXIT_SUCCESS;
+	return rst;
 }
 
-
 /**
- * @brief Converts a Latin Alphabet letter to its lowercase form.
+ * @brief Counts the words of an input file.
+ * @details If a checkpoint is set, counting resumes from it when possible.
+ * If a cache is set, the counts of unchanged files are taken from it
+ * and those of the rest are cached after being counted.
  *
- * @param[in]	let	Letter to be converted
- * @return	Corresponding lowercase letter
+ * @param[in, out]	ctx		Pointer to the counting context.
+ * @param[in, out]	vec		Pointer to the Word Buffer Vector used for the chunks.
+ * @param[in]		path	Pointer to the string containing the path of the file.
+ * @return	Return the status of the routine.
  */
-static inline int to_lowercase(const int let)
+static RetStatus count_file(CountContext *ctx, WordBufferVector *vec, const char *path)
 {
-	return (let | 0x20);
+	if(ctx->cache != NULL)
+	{
+		if(ctx->whtab == NULL)
+		{
+			ctx->whtab = WordHashTable_create(MERGED_TABLE_CAPACITY);
+			if(ctx->whtab == NULL) return GEN_FAIL;
+		}
+
+		size_t fileWords = 0;
+		bool found = false;
+		if(FileCache_lookup(ctx->cache, path, ctx->whtab, &fileWords, &found) != SUCCESS)
+			return GEN_FAIL;
+		if(found)
+		{
+			ctx->totalWords += fileWords;
+			return SUCCESS;
+		}
+
+		/// The file is counted separately so that its own counts are cached,
+		/// then merged to the counts of the rest of the files.
+		CountContext fileCtx = *ctx;
+		fileCtx.whtab = NULL;
+		fileCtx.cache = NULL;
+		fileCtx.totalWords = 0;
+		fileCtx.truncatedWords = 0;
+		RetStatus rst = count_file(&fileCtx, vec, path);
+		if(rst == SUCCESS)
+			rst = FileCache_store(ctx->cache, path, fileCtx.whtab, fileCtx.totalWords);
+		if(rst == SUCCESS) rst = WordHashTable_merge(ctx->whtab, fileCtx.whtab);
+		if(fileCtx.whtab != NULL) WordHashTable_destroy(&(fileCtx.whtab));
+		ctx->reader = fileCtx.reader;
+		ctx->totalWords += fileCtx.totalWords;
+		ctx->truncatedWords += fileCtx.truncatedWords;
+
+		return rst;
+	}
+
+	/// Files are opened as binary, as they may be compressed.
+	FILE* inpf;
+	if(!file_open(&inpf, path, "rb"))
+	{
+		fprintf(stderr, "Failed to open file: %s\n", path);
+		return GEN_FAIL;
+	}
+	InputStream *stream = InputStream_open(inpf);
+	if(stream == NULL)
+	{
+		fprintf(stderr, "Failed to read file: %s\n", path);
+		fclose(inpf);
+		return GEN_FAIL;
+	}
+
+	if(ctx->chkp != NULL)
+	{
+		/// A previous interrupted run is resumed from its last checkpoint.
+		WordHashTable *restored = NULL;
+		uint64_t offset = 0;
+		if((Checkpoint_restore(ctx->chkp, &restored, &offset, &(ctx->totalWords))
+				!= SUCCESS) ||
+			((restored != NULL) && (InputStream_seek(stream, offset) != SUCCESS)))
+		{
+			fprintf(stderr, "Failed to resume from checkpoint.\n");
+			if(restored != NULL) WordHashTable_destroy(&restored);
+			InputStream_close(&stream);
+			fclose(inpf);
+			return GEN_FAIL;
+		}
+		if(restored != NULL)
+		{
+#ifdef _DEBUG
+			printf("Resuming from offset %ld after %ld words.\n",
+					offset, ctx->totalWords);
+#endif //_DEBUG
+			ctx->whtab = restored;
+		}
+	}
+
+	const RetStatus rst = count_input(ctx, vec, stream);
+	InputStream_close(&stream);
+	fclose(inpf);
+
+	return rst;
 }
 
 /**
- * @brief Evaluates whether the input character is a Latin Alphabet letter
+ * @brief Counts and prints separately each document listed in a manifest.
+ * @details The table is emptied rather than recreated between the documents,
+ * and a single reader is reset for each of them, so that many small documents
+ * are counted without allocating their structs over and over. The documents
+ * which can not be opened are reported and skipped, while any other failure
+ * stops the run.
  *
- * @param[in]	ch	Character to to be evaluated
- * @return	True if the character is a Latin Alphabet letter
+ * @param[in, out]	ctx			Pointer to the counting context.
+ * @param[in, out]	vec			Pointer to the Word Buffer Vector used for the chunks.
+ * @param[in]		opts		Pointer to the options of the run.
+ * @param[out]		numSkipped	Pointer to the number of documents skipped.
+ * @return	Return the status of the routine.
  */
-static inline bool is_letter(const int ch)
+static RetStatus count_manifest(CountContext *ctx, WordBufferVector *vec,
+		const ProgramOptions *opts, size_t *numSkipped)
 {
-	int lowch = to_lowercase(ch);
+	Manifest *manifest = Manifest_open(opts->manifestPath, opts->manifestNul);
+	if(manifest == NULL) return GEN_FAIL;
+	ctx->keepReader = true;
+
+	RetStatus rst = SUCCESS;
+	size_t numDocuments = 0;
+	*numSkipped = 0;
+	const char *path = NULL;
+	while((rst == SUCCESS) && ((path = Manifest_next(manifest)) != NULL))
+	{
+		/// A missing or unreadable document leaves the rest of the batch
+		/// to be counted.
+		FILE *doc = NULL;
+		if(!file_open(&doc, path, "rb"))
+		{
+			fprintf(stderr, "Failed to open document: %s\n", path);
+			(*numSkipped)++;
+			continue;
+		}
+		fclose(doc);
+
+		if(ctx->whtab != NULL) WordHashTable_clear(ctx->whtab);
+		const size_t startWords = ctx->totalWords;
+		rst = count_file(ctx, vec, path);
+		if(rst != SUCCESS) break;
+
+		/// The documents are printed to a single stream, each under its path.
+		if(numDocuments++ != 0) printf("\n");
+		printf("Document %s (%ld words):\n", path, ctx->totalWords - startWords);
+		WordHashTable_count_print(ctx->whtab);
+		if(opts->rollupSeparators != NULL)
+		{
+			PrefixRollup *rollup = PrefixRollup_create(ctx->whtab, opts->rollupSeparators);
+			if(rollup == NULL)
+			{
+				rst = GEN_FAIL;
+				break;
+			}
+			PrefixRollup_print(rollup);
+			PrefixRollup_destroy(&rollup);
+		}
+	}
+	if((rst == SUCCESS) && Manifest_failed(manifest)) rst = GEN_FAIL;
+	Manifest_close(&manifest);
+	if(*numSkipped != 0)
+	{
+		fprintf(stderr, "Skipped %ld of %ld documents that could not be opened.\n",
+				*numSkipped, numDocuments + *numSkipped);
+	}
+#ifdef _STATS
+	/// The statistics follow the last document on a line of their own.
+	if(numDocuments != 0) printf("\n");
+#endif
 
-	return (lowch >= 'a' && lowch <= 'z');
+	return rst;
 }
 
 /**
- * @brief Evaluates whether the input character is a number
+ * @brief Frees the memory allocated for the structs of the counting context.
  *
- * @param[in]	ch	Character to to be evaluated
- * @return	True if the character is a number
+ * @param[in, out]	ctx	Pointer to the counting context.
+ * @return	Void
  */
-static inline bool is_number(const int ch)
+static void CountContext_free(CountContext *ctx)
 {
-	return (ch >= '0' && ch <= '9');
+	/// The prefixes of the rollup point to the words of the table.
+	if(ctx->rollup != NULL) PrefixRollup_destroy(&(ctx->rollup));
+	if(ctx->whtab != NULL) WordHashTable_destroy(&(ctx->whtab));
+	if(ctx->reader != NULL) InputReader_destroy(&(ctx->reader));
+	if(ctx->tree != NULL) WordTree_destroy(&(ctx->tree));
+	if(ctx->vocab != NULL) Vocabulary_destroy(&(ctx->vocab));
+	if(ctx->window != NULL) SlidingWindow_destroy(&(ctx->window));
+	if(ctx->buckets != NULL) TimeBuckets_destroy(&(ctx->buckets));
+	if(ctx->tokens != NULL) TokenStream_destroy(&(ctx->tokens));
+	if(ctx->stop != NULL) StopWords_destroy(&(ctx->stop));
+	if(ctx->stemmer != NULL) Stemmer_destroy(&(ctx->stemmer));
+	if(ctx->lines != NULL) LineTable_destroy(&(ctx->lines));
+	if(ctx->hot != NULL) HotWords_destroy(&(ctx->hot));
+	if(ctx->cache != NULL) FileCache_destroy(&(ctx->cache));
+	if(ctx->chkp != NULL) Checkpoint_destroy(&(ctx->chkp));
+	if(ctx->rules != NULL) TokenRules_destroy(&(ctx->rules));
 }
 
 /**
- * @brief Evaluates whether the input character is among those
- * which can possibly appear inside a word.
- *
- * @param[in]	ch	Character to to be evaluated
- * @return	True if the character is an inside word number
+ * @brief Uses a Hash Table of to count the occurrences of each unique word
+ * and prints the result in alphabetical order.
  */
-static inline bool is_inword_symbol(const int ch)
+int main(int argc, char *argv[])
 {
-	static const char inWrdSymbols[] = {'-', '\'', '%', ',', '.', '@'};
-
-	bool isSym = false;
-	for(uint32_t i = 0; i<sizeof(inWrdSymbols); i++)
+	ProgramOptions opts;
+	if(!ProgramOptions_parse(&opts, argc, argv))
 	{
-		isSym |= (ch == inWrdSymbols[i]);
+		ProgramOptions_print_usage(argv[0]);
+		printf("Exiting...\n");
+		return EXIT_FAILURE;
 	}
-	return isSym;
-}
-
-/// @brief The type of the processed character
-typedef enum
-{
-	/// The processed character is a Latin alphabet letter.
-	LETTER,
-	/// The processed character is a number.
-	NUMBER,
-	/// The processed character is among those
-	/// which can possibly appear inside a word.
-	IN_WORD_SYMBOL,
-	/// The processed character is not used in words.
-	OTHER_SYMBOL
-}InputCharType;
-
-/**
- * @brief Categorizes a character on the available InputCharTypes
- *
- * @param[in]	ch	Character to to be evaluated
- * @return	The InputCharType of the character
- */
-static inline InputCharType get_char_type(const int ch)
-{
-	if(is_letter(ch)) return LETTER;
-	else
+	/// Querying an FST reads no input and needs no token rules.
+	if(opts.queryFst)
 	{
-		if(is_number(ch)) return NUMBER;
-		else
+		WordFst *fst = WordFst_open(opts.inputPaths[0]);
+		RetStatus rst = GEN_FAIL;
+		if(fst != NULL)
 		{
-			if(is_inword_symbol(ch)) return IN_WORD_SYMBOL;
-			else return OTHER_SYMBOL;
+			if(opts.queryPrefix != NULL) rst = WordFst_print_prefix(fst, opts.queryPrefix);
+			else rst = WordFst_print_range(fst, (opts.rangeFrom != NULL) ? opts.rangeFrom : "",
+					opts.rangeTo);
+			WordFst_destroy(&fst);
 		}
+		ProgramOptions_free(&opts);
+		return (rst == SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	/// Comparing two sets of counts only reads the files holding them.
+	if(opts.diff)
+	{
+		const RetStatus rst = CountDiff_print(opts.inputPaths[0], opts.inputPaths[1],
+				opts.diffThreshold);
+		ProgramOptions_free(&opts);
+		return (rst == SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE;
 	}
-}
-
-/// @brief The state of the input processor. Where the processing cursor is.
-typedef enum
-{
-	/// Input Processing Cursor is between words.
-	BETWEEN_WORDS,
-	/// Input Processing Cursor is inside a word, after an Alpharithmetic.
-	IN_WORD_AFTER_ALPHARITH,
-	/// Input Processing Cursor is inside a word, after an In Word character.
-	IN_WORD_AFTER_SYMBOL
-}InputState;
 
-#define INITIAL_WORD_BUFFER_LENGTH 16
+	CountContext ctx = {0};
+	ctx.chunkWords = INPUT_CHUNK_WORDS;
+	ctx.rules = TokenRules_create(opts.wordChars, opts.inwordSymbols, opts.tokenRegex,
+			opts.caseSensitive, opts.stripMarkup, opts.maxTokenLength);
+	if(ctx.rules == NULL)
+	{
+		ProgramOptions_print_usage(argv[0]);
+		printf("Exiting...\n");
+		ProgramOptions_free(&opts);
+		return EXIT_FAILURE;
+	}
+	/// The kernels of the CPU are overridden to compare them on one machine.
+	if(opts.isaForced && (TokenRules_set_isa(ctx.rules, opts.forcedIsa) != SUCCESS))
+	{
+		CountContext_free(&ctx);
+		ProgramOptions_free(&opts);
+		return EXIT_FAILURE;
+	}
+	/// Compiling a vocabulary ends the run before any input is read.
+	if(opts.compileVocab)
+	{
+		const RetStatus rst = Vocabulary_compile(opts.inputPaths[0], opts.inputPaths[1],
+				ctx.rules);
+		CountContext_free(&ctx);
+		ProgramOptions_free(&opts);
+		return (rst == SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	if(opts.stopwordsPath != NULL)
+	{
+		ctx.stop = StopWords_create(opts.stopwordsPath, ctx.rules);
+		if(ctx.stop == NULL)
+		{
+			CountContext_free(&ctx);
+			ProgramOptions_free(&opts);
+			return EXIT_FAILURE;
+		}
+	}
+	if(opts.stem)
+	{
+		ctx.stemmer = Stemmer_create();
+		if(ctx.stemmer == NULL)
+		{
+			CountContext_free(&ctx);
+			ProgramOptions_free(&opts);
+			return EXIT_FAILURE;
+		}
+	}
+	if(opts.dedupLines)
+	{
+		ctx.lines = LineTable_create(DEDUP_TABLE_LINES, DEDUP_TABLE_BYTES);
+		if(ctx.lines == NULL)
+		{
+			CountContext_free(&ctx);
+			ProgramOptions_free(&opts);
+			return EXIT_FAILURE;
+		}
+	}
+	/// Counts saved excluding other words or without stemming
+	/// are not reused either.
+	uint64_t rulesSignature = TokenRules_signature(ctx.rules);
+	if(ctx.stop != NULL) rulesSignature ^= StopWords_signature(ctx.stop);
+	if(ctx.stemmer != NULL) rulesSignature ^= fnvhash((const uint8_t*) "porter", 6);
+	if(opts.checkpointPath != NULL)
+	{
+		ctx.chkp = Checkpoint_create(opts.checkpointPath, opts.checkpointInterval,
+				rulesSignature);
+		if(ctx.chkp == NULL)
+		{
+			CountContext_free(&ctx);
+			ProgramOptions_free(&opts);
+			return EXIT_FAILURE;
+		}
+	}
+	if(opts.cacheDir != NULL)
+	{
+		ctx.cache = FileCache_create(opts.cacheDir, rulesSignature);
+		if(ctx.cache == NULL)
+		{
+			CountContext_free(&ctx);
+			ProgramOptions_free(&opts);
+			return EXIT_FAILURE;
+		}
+	}
+	if((opts.windowWords != 0) || (opts.windowSeconds != 0))
+	{
+		ctx.window = SlidingWindow_create(opts.windowWords, (int64_t)opts.windowSeconds);
+		if(ctx.window == NULL)
+		{
+			CountContext_free(&ctx);
+			ProgramOptions_free(&opts);
+			return EXIT_FAILURE;
+		}
+		ctx.reportInterval = opts.windowReport;
+		/// The table is sized after the first chunk, so chunks are kept
+		/// within the window. Words are timestamped per chunk, so streams
+		/// are counted word by word when their age matters.
+		if((opts.windowWords != 0) && (opts.windowWords < ctx.chunkWords))
+			ctx.chunkWords = opts.windowWords;
+		if(opts.windowSeconds != 0)
+		{
+			ctx.chunkWords = 1;
+			ctx.streamed = true;
+		}
+	}
+	if(opts.bucketSeconds != 0)
+	{
+		ctx.buckets = TimeBuckets_create((int64_t)opts.bucketSeconds, opts.topWords);
+		if(ctx.buckets == NULL)
+		{
+			CountContext_free(&ctx);
+			ProgramOptions_free(&opts);
+			return EXIT_FAILURE;
+		}
+	}
+	if(opts.tokenIdsPath != NULL)
+	{
+		ctx.tokens = TokenStream_create(opts.tokenIdsPath);
+		if(ctx.tokens == NULL)
+		{
+			CountContext_free(&ctx);
+			ProgramOptions_free(&opts);
+			return EXIT_FAILURE;
+		}
+	}
+	/// The words are kept in order as they are counted, so they are printed
+	/// without being sorted.
+	if(opts.radixTree)
+	{
+		ctx.tree = WordTree_create();
+		if(ctx.tree == NULL)
+		{
+			CountContext_free(&ctx);
+			ProgramOptions_free(&opts);
+			return EXIT_FAILURE;
+		}
+	}
+	/// The words outside the vocabulary are discarded as they are counted.
+	else if(opts.vocabPath != NULL)
+	{
+		ctx.vocab = Vocabulary_create(opts.vocabPath, ctx.rules);
+		if(ctx.vocab == NULL)
+		{
+			CountContext_free(&ctx);
+			ProgramOptions_free(&opts);
+			return EXIT_FAILURE;
+		}
+	}
+	/// Windows, time buckets and token id streams follow each word to the table,
+	/// so only plain counts gather the frequent words in a cache.
+	else if((ctx.window == NULL) && (ctx.tokens == NULL) && (ctx.buckets == NULL))
+	{
+		ctx.hot = HotWords_create();
+		if(ctx.hot == NULL)
+		{
+			CountContext_free(&ctx);
+			ProgramOptions_free(&opts);
+			return EXIT_FAILURE;
+		}
+	}
 
-RetStatus get_input(WordBufferVector* vec, FILE* fp)
-{
-	WordBuffer* wbuf = WordBuffer_create(INITIAL_WORD_BUFFER_LENGTH);
-	if(wbuf == NULL)
+	/// Creates a Vector of WordBuffers of a predefined initial length
+	/// to host the words of each chunk of the text.
+	WordBufferVector *inputVector =
+			WordBufferVector_create(INITIAL_WORD_VECTOR_LENGTH);
+	if(inputVector == NULL)
 	{
-		fprintf(stderr, "Failed to initialize word buffer for input "
-				"processing.\n");
-		return GEN_FAIL;
+		fprintf(stderr, "Failed to create Word Buffer Vector "
+				"for input processing. Exiting...\n");
+		CountContext_free(&ctx);
+		ProgramOptions_free(&opts);
+		return EXIT_FAILURE;
 	}
 
-	FILE* source;
+	RetStatus rst = SUCCESS;
+	size_t skippedDocuments = 0;
+	/// The documents of a manifest are printed as they are counted.
+	if(opts.manifestPath != NULL)
+		rst = count_manifest(&ctx, inputVector, &opts, &skippedDocuments);
 	/// If no file is passed, the input text is read from the standard input.
-	if(fp == NULL)
+	else if(opts.numInputs == 0)
 	{
 		/// The user provides the input using an 'EOF' to signify its end.
 		printf("Enter input followed by an 'EOF'([Enter - Ctrl+D] for Unix "
 				"and [Enter - Ctrl+Z - Enter] for Windows)\n");
-		source = stdin;
+		InputStream *stream = InputStream_open(stdin);
+		rst = (stream != NULL) ? count_input(&ctx, inputVector, stream) : GEN_FAIL;
+		if(stream != NULL) InputStream_close(&stream);
+	}
+	for(size_t i = 0; (i < opts.numInputs) && (rst == SUCCESS); i++)
+	{
+		rst = count_file(&ctx, inputVector, opts.inputPaths[i]);
+	}
+	WordBufferVector_destroy(&inputVector);
+	/// The dictionary is written once all the ids are assigned.
+	if((rst == SUCCESS) && (ctx.tokens != NULL))
+	{
+		rst = TokenStream_finish(ctx.tokens, ctx.whtab);
 	}
-	else source = fp;
-
 
-	int newChar;
-	InputState state = BETWEEN_WORDS;
-	/// The input is processed on a character basis
-	while((newChar = fgetc(source)) != EOF)
+	if(rst != SUCCESS)
 	{
-		InputCharType inpType = get_char_type(newChar);
-		switch(state)
-		{
-			case BETWEEN_WORDS:
-			{
-				/// While being between words only Alpharithmetic characters
-				/// change the input's state. Other characters can't be in
-				/// the beginning of a word.
-				switch(inpType)
-				{
-					case LETTER:
-					{
-						/// Letters are converted to lowercase
-						/// before being appended to the buffer
-						if(WordBuffer_push_char(wbuf, to_lowercase(newChar))
-								!= SUCCESS)
-						{
-							WordBuffer_destroy(&wbuf);
-							return GEN_FAIL;
-						}
-						state = IN_WORD_AFTER_ALPHARITH;
-						break;
-					}
-					case NUMBER:
-					{
-						if(WordBuffer_push_char(wbuf, newChar) != SUCCESS)
-						{
-							WordBuffer_destroy(&wbuf);
-							return GEN_FAIL;
-						}
-						state = IN_WORD_AFTER_ALPHARITH;
-						break;
-					}
-					default:
-					{
-						state = BETWEEN_WORDS;
-						break;
-					}
-				}
-				break;
-			}
-			case IN_WORD_AFTER_ALPHARITH:
-			{
-				switch(inpType)
-				{
-					/// After an Alpharithmetic, a new one signifies
-					/// the continuation of the word
-					case LETTER:
-					{
-						if(WordBuffer_push_char(wbuf, to_lowercase(newChar))
-								!= SUCCESS)
-						{
-							WordBuffer_destroy(&wbuf);
-							return GEN_FAIL;
-						}
-						state = IN_WORD_AFTER_ALPHARITH;
-						break;
-					}
-					case NUMBER:
-					{
-						if(WordBuffer_push_char(wbuf, newChar) != SUCCESS)
-						{
-							WordBuffer_destroy(&wbuf);
-							return GEN_FAIL;
-						}
-						state = IN_WORD_AFTER_ALPHARITH;
-						break;
-					}
-
-					/// After an Alpharithmetic, an In Word Symbol signifies
-					/// that the word possibly ended so the state changes.
-					case IN_WORD_SYMBOL:
-					{
-						if(WordBuffer_push_char(wbuf, newChar) != SUCCESS)
-						{
-							WordBuffer_destroy(&wbuf);
-							return GEN_FAIL;
-						}
-						state = IN_WORD_AFTER_SYMBOL;
-						break;
-					}
-
-					/// After an Alpharithmetic, any other symbol signifies
-					/// the definite end of the word, which is subsequently
-					/// pushed to the vector.
-					case OTHER_SYMBOL:
-					{
-						if(WordBufferVector_push(vec, wbuf) != SUCCESS)
-						{
-							WordBuffer_destroy(&wbuf);
-							return GEN_FAIL;
-						}
-						WordBuffer_clear(wbuf);
-						state = BETWEEN_WORDS;
-						break;
-					}
-				}
-				break;
-			}
-			case IN_WORD_AFTER_SYMBOL:
-			{
-				/// After an In Word symbol only Alpharithmetic characters
-				/// signify the continuation of the word.
-				switch(inpType)
-				{
-					case LETTER:
-					{
-						if(WordBuffer_push_char(wbuf, to_lowercase(newChar))
-								!= SUCCESS)
-						{
-							WordBuffer_destroy(&wbuf);
-							return GEN_FAIL;
-						}
-						state = IN_WORD_AFTER_ALPHARITH;
-						break;
-					}
-					case NUMBER:
-					{
-						if(WordBuffer_push_char(wbuf, newChar) != SUCCESS)
-						{
-							WordBuffer_destroy(&wbuf);
-							return GEN_FAIL;
-						}
-						state = IN_WORD_AFTER_ALPHARITH;
-						break;
-					}
-					/// Any symbol signifies that the word had already ended
-					/// before the previous symbol, as 2 consecutive symbols
-					/// are not allowed inside words.
-					default:
-					{
-						/// The extra symbol is discarded and the word buffer
-						/// is pushed to the vector.
-						WordBuffer_backspace(wbuf);
-						if(WordBufferVector_push(vec, wbuf) != SUCCESS)
-						{
-							WordBuffer_destroy(&wbuf);
-							return GEN_FAIL;
-						}
-						WordBuffer_clear(wbuf);
-						state = BETWEEN_WORDS;
-						break;
-					}
-				}
-				break;
-			}
-		}
+		fprintf(stderr, "Failed to count the input. Exiting...\n");
+		CountContext_free(&ctx);
+		ProgramOptions_free(&opts);
+		return EXIT_FAILURE;
+	}
+#ifdef _STATS
+	printf("Input Length: %ld words\n", ctx.totalWords);
+	printf("Tokenizer kernels: %s\n", CpuIsa_name(TokenRules_isa(ctx.rules)));
+#endif
+	if(ctx.truncatedWords != 0)
+	{
+		fprintf(stderr, "Cut %ld words longer than %ld bytes.\n",
+				ctx.truncatedWords, opts.maxTokenLength);
 	}
 
-	switch(state)
+	/// After all words are counted, they are printed in alphabetical order,
+	/// separately for each time bucket if requested.
+	if(ctx.buckets != NULL)
 	{
-		/// After the 'EOF' is reached, if the last character was alpharithmetic
-		/// the word was concluded and the containing buffer is pushed
-		/// to the vector.
-		case IN_WORD_AFTER_ALPHARITH:
+		if(ctx.untimedLines != 0)
 		{
-			if(WordBufferVector_push(vec, wbuf) != SUCCESS)
-			{
-				WordBuffer_destroy(&wbuf);
-				return GEN_FAIL;
-			}
-			break;
-		}
-		/// After the 'EOF' is reached, if the last character was an In Word
-		/// symbol, the word was concluded before that, so the extra character
-		/// is discarded and the containing buffer is pushed to the vector.
-		case IN_WORD_AFTER_SYMBOL:
-		{
-			WordBuffer_backspace(wbuf);
-			if(WordBufferVector_push(vec, wbuf) != SUCCESS)
-			{
-				WordBuffer_destroy(&wbuf);
-				return GEN_FAIL;
-			}
-			break;
-		}
-		default:
-		{
-			break;
+			fprintf(stderr, "Skipped %ld lines preceding any timestamp.\n",
+					ctx.untimedLines);
 		}
+		rst = TimeBuckets_print(ctx.buckets, ctx.whtab);
 	}
+	else if(ctx.tree != NULL) rst = WordTree_count_print(ctx.tree);
+	else if(ctx.vocab != NULL) rst = Vocabulary_count_print(ctx.vocab);
+	else if(opts.manifestPath == NULL) WordHashTable_count_print(ctx.whtab);
+	if((rst == SUCCESS) && (opts.rollupSeparators != NULL) && (opts.manifestPath == NULL))
+	{
+		ctx.rollup = PrefixRollup_create(ctx.whtab, opts.rollupSeparators);
+		if(ctx.rollup != NULL) PrefixRollup_print(ctx.rollup);
+		else rst = GEN_FAIL;
+	}
+	if((rst == SUCCESS) && (opts.fstPath != NULL)) rst = WordFst_export(ctx.whtab, opts.fstPath);
+#ifdef _STATS
+	if(ctx.whtab != NULL)
+	{
+		WordHashTable_hstats_update(ctx.whtab);
+		WordHashTable_hstats_print(ctx.whtab);
+	}
+	if(ctx.tree != NULL) WordTree_stats_print(ctx.tree);
+	if(ctx.vocab != NULL) Vocabulary_stats_print(ctx.vocab);
+	if(ctx.cache != NULL) FileCache_stats_print(ctx.cache);
+	if(ctx.window != NULL) SlidingWindow_stats_print(ctx.window);
+	if(ctx.buckets != NULL) TimeBuckets_stats_print(ctx.buckets);
+	if(ctx.tokens != NULL) TokenStream_stats_print(ctx.tokens);
+	if(ctx.stop != NULL) StopWords_stats_print(ctx.stop);
+	if(ctx.stemmer != NULL) Stemmer_stats_print(ctx.stemmer);
+	if(ctx.lines != NULL) LineTable_stats_print(ctx.lines);
+	if(ctx.hot != NULL) HotWords_stats_print(ctx.hot);
+	if(ctx.rollup != NULL) PrefixRollup_stats_print(ctx.rollup);
+#endif //_STATS
 
-	WordBuffer_destroy(&wbuf);
+	/// The run completed, so there is nothing left to resume.
+	if(ctx.chkp != NULL) Checkpoint_discard(ctx.chkp);
+	CountContext_free(&ctx);
+	ProgramOptions_free(&opts);
 
-	return SUCCESS;
+	if(rst != SUCCESS) return EXIT_FAILURE;
+	return (skippedDocuments == 0) ? EXIT_SUCCESS : EXIT_SKIPPED_DOCUMENTS;
 }
@@ -0,0 +1,883 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "wordfst.h"
+#include "utils.h"
+#include <string.h>
+
+/// Identifies the file format of the transducer.
+static const char fstMagic[WORD_FST_MAGIC_LENGTH] = {'W', 'C', 'F', 'S', 'T', '0', '0', '1'};
+
+/// The initial number of arcs allocated for a state still being built.
+#define OPEN_STATE_ARCS 4
+
+/// The initial number of states and arcs allocated for the automaton.
+#define FST_INITIAL_CAPACITY 1024
+
+/// Marks a state which could not be added to the automaton.
+#define FST_NO_STATE UINT32_MAX
+
+/// @brief The header of a transducer file, followed by its states,
+/// the targets, outputs and labels of its arcs and the counts of its words.
+typedef struct
+{
+	char magic[WORD_FST_MAGIC_LENGTH];
+	uint64_t numWords;
+	uint32_t numStates;
+	uint32_t numArcs;
+	uint32_t root;
+	uint32_t maxLength;
+}FstHeader;
+
+/// @brief A state of the automaton, whose arcs are consecutive
+/// and sorted by their label.
+typedef struct
+{
+	uint32_t firstArc;
+	uint16_t numArcs;
+	/// Whether a word ends at the state.
+	uint8_t final;
+	uint8_t padding;
+}FstState;
+
+struct WordFst
+{
+	/// The header of the file, holding the numbers of each section.
+	FstHeader header;
+	const FstState *states;
+	/// The state each arc leads to.
+	const uint32_t *targets;
+	/// The number of words preceding those reached through each arc from its state.
+	const uint32_t *outputs;
+	/// The character of each arc.
+	const uint8_t *labels;
+	/// The count of each word, by its position in alphabetical order.
+	const uint64_t *counts;
+	/// The contents of the file mapped to memory.
+	void *mapping;
+	size_t mappingLength;
+};
+
+/// @brief A state on the path of the last word added, whose arcs may still grow.
+typedef struct
+{
+	uint8_t *labels;
+	uint32_t *targets;
+	uint32_t numArcs;
+	uint32_t capacity;
+	bool final;
+}OpenState;
+
+/// @brief The automaton while the words are added.
+typedef struct
+{
+	FstState *states;
+	/// The number of words accepted from each state.
+	uint32_t *sizes;
+	uint32_t numStates;
+	uint32_t stateCapacity;
+	uint8_t *labels;
+	uint32_t *targets;
+	uint32_t *outputs;
+	uint32_t numArcs;
+	uint32_t arcCapacity;
+	/// Open addressing table of the states built, by their arcs, holding
+	/// the id of each state plus one so that 0 marks an empty slot.
+	uint32_t *registry;
+	uint32_t registryCapacity;
+	/// The states on the path of the last word added, one per character.
+	OpenState *path;
+	uint32_t pathLength;
+}FstBuilder;
+
+/// @brief The position reached in a state while its words are enumerated.
+typedef struct
+{
+	uint32_t state;
+	/// The index of the next arc to follow.
+	uint32_t nextArc;
+	/// The position of the first word reached from the state.
+	uint64_t rank;
+}FstFrame;
+
+struct WordFstCursor
+{
+	const WordFst *fst;
+	/// The states on the path of the current word, one per character.
+	FstFrame *frames;
+	/// The characters of the current word.
+	uint8_t *key;
+	uint32_t depth;
+	/// Whether the word ending at the state of the current depth is yet to be visited.
+	bool visiting;
+	/// The word ending the range, excluded from it, NULL for no end.
+	char *to;
+	size_t toLength;
+	/// Whether the range was exhausted.
+	bool done;
+	/// Whether a path of the automaton was found invalid.
+	bool failed;
+};
+
+/**
+ * @brief Hashes the arcs of a state along with whether it is final.
+ *
+ * @param[in]	labels	Pointer to the characters of the arcs.
+ * @param[in]	targets	Pointer to the states the arcs lead to.
+ * @param[in]	numArcs	The number of arcs.
+ * @param[in]	final	Whether a word ends at the state.
+ * @return	Returns the hash of the state.
+ */
+static uint64_t state_hash(const uint8_t *labels, const uint32_t *targets,
+		const uint32_t numArcs, const bool final)
+{
+	uint64_t hash = fnvhash(labels, numArcs) ^ (final ? 0x9e3779b97f4a7c15ULL : 0);
+	hash ^= fnvhash((const uint8_t*)targets, numArcs * (uint32_t)sizeof(uint32_t)) * 31;
+	return hash;
+}
+
+/**
+ * @brief Doubles the capacity of the table of the states built,
+ * placing them again.
+ *
+ * @param[in, out]	fb	Pointer to the automaton being built.
+ * @return	Return the status of the routine.
+ */
+static RetStatus registry_grow(FstBuilder *fb)
+{
+	const uint32_t capacity = fb->registryCapacity * 2;
+	uint32_t *registry = (uint32_t*) calloc(capacity, sizeof(uint32_t));
+	if(registry == NULL) return GEN_FAIL;
+	for(uint32_t id = 0; id < fb->numStates; id++)
+	{
+		const FstState *state = &(fb->states[id]);
+		uint64_t slot = state_hash(&(fb->labels[state->firstArc]),
+				&(fb->targets[state->firstArc]), state->numArcs, state->final != 0);
+		while(registry[slot & (capacity - 1)] != 0) slot++;
+		registry[slot & (capacity - 1)] = id + 1;
+	}
+	free(fb->registry);
+	fb->registry = registry;
+	fb->registryCapacity = capacity;
+	return SUCCESS;
+}
+
+/**
+ * @brief Ensures the automaton has room for one more state and some more arcs.
+ *
+ * @param[in, out]	fb		Pointer to the automaton being built.
+ * @param[in]		numArcs	The number of arcs to be added.
+ * @return	Return the status of the routine.
+ */
+static RetStatus builder_reserve(FstBuilder *fb, const uint32_t numArcs)
+{
+	if(fb->numStates == fb->stateCapacity)
+	{
+		if(fb->stateCapacity > UINT32_MAX / 2) return DATA_STRUCT_FULL;
+		const uint32_t capacity = fb->stateCapacity * 2;
+		FstState *states = (FstState*) realloc(fb->states, capacity * sizeof(FstState));
+		if(states == NULL) return GEN_FAIL;
+		fb->states = states;
+		uint32_t *sizes = (uint32_t*) realloc(fb->sizes, capacity * sizeof(uint32_t));
+		if(sizes == NULL) return GEN_FAIL;
+		fb->sizes = sizes;
+		fb->stateCapacity = capacity;
+	}
+	if(numArcs > fb->arcCapacity - fb->numArcs)
+	{
+		if(fb->arcCapacity > UINT32_MAX / 2) return DATA_STRUCT_FULL;
+		const uint32_t capacity = fb->arcCapacity * 2;
+		uint8_t *labels = (uint8_t*) realloc(fb->labels, capacity);
+		if(labels == NULL) return GEN_FAIL;
+		fb->labels = labels;
+		uint32_t *targets = (uint32_t*) realloc(fb->targets, capacity * sizeof(uint32_t));
+		if(targets == NULL) return GEN_FAIL;
+		fb->targets = targets;
+		uint32_t *outputs = (uint32_t*) realloc(fb->outputs, capacity * sizeof(uint32_t));
+		if(outputs == NULL) return GEN_FAIL;
+		fb->outputs = outputs;
+		fb->arcCapacity = capacity;
+	}
+	return SUCCESS;
+}
+
+/**
+ * @brief Adds a state whose arcs are final to the automaton, unless an equal
+ * state is already part of it, and empties the open state for reuse.
+ *
+ * @param[in, out]	fb		Pointer to the automaton being built.
+ * @param[in, out]	open	Pointer to the state.
+ * @return	Returns the id of the state in the automaton, FST_NO_STATE on failure.
+ */
+static uint32_t builder_freeze(FstBuilder *fb, OpenState *open)
+{
+	const uint64_t hash = state_hash(open->labels, open->targets, open->numArcs, open->final);
+	uint64_t slot = hash;
+	for(; fb->registry[slot & (fb->registryCapacity - 1)] != 0; slot++)
+	{
+		const uint32_t id = fb->registry[slot & (fb->registryCapacity - 1)] - 1;
+		const FstState *state = &(fb->states[id]);
+		/// The arcs of states without any are not allocated.
+		if((state->numArcs == open->numArcs) && ((state->final != 0) == open->final) &&
+			((open->numArcs == 0) ||
+			((memcmp(&(fb->labels[state->firstArc]), open->labels, open->numArcs) == 0) &&
+			(memcmp(&(fb->targets[state->firstArc]), open->targets,
+					open->numArcs * sizeof(uint32_t)) == 0))))
+		{
+			open->numArcs = 0;
+			open->final = false;
+			return id;
+		}
+	}
+
+	if(builder_reserve(fb, open->numArcs) != SUCCESS) return FST_NO_STATE;
+	const uint32_t id = fb->numStates++;
+	FstState *state = &(fb->states[id]);
+	state->firstArc = fb->numArcs;
+	state->numArcs = (uint16_t)open->numArcs;
+	state->final = open->final ? 1 : 0;
+	state->padding = 0;
+	/// Each arc skips the word ending at the state and those of the arcs before it.
+	uint32_t size = open->final ? 1 : 0;
+	for(uint32_t i = 0; i < open->numArcs; i++)
+	{
+		fb->labels[fb->numArcs] = open->labels[i];
+		fb->targets[fb->numArcs] = open->targets[i];
+		fb->outputs[fb->numArcs] = size;
+		fb->numArcs++;
+		size += fb->sizes[open->targets[i]];
+	}
+	fb->sizes[id] = size;
+	fb->registry[slot & (fb->registryCapacity - 1)] = id + 1;
+	open->numArcs = 0;
+	open->final = false;
+
+	if((fb->numStates > fb->registryCapacity / 2) && (registry_grow(fb) != SUCCESS))
+	{
+		return FST_NO_STATE;
+	}
+	return id;
+}
+
+/**
+ * @brief Adds an arc to an open state, leading to the next state of the path.
+ *
+ * @param[in, out]	open	Pointer to the state.
+ * @param[in]		label	The character of the arc.
+ * @return	Return the status of the routine.
+ */
+static RetStatus open_add_arc(OpenState *open, const uint8_t label)
+{
+	if(open->numArcs == open->capacity)
+	{
+		const uint32_t capacity = (open->capacity == 0) ? OPEN_STATE_ARCS : open->capacity * 2;
+		uint8_t *labels = (uint8_t*) realloc(open->labels, capacity);
+		if(labels == NULL) return GEN_FAIL;
+		open->labels = labels;
+		uint32_t *targets = (uint32_t*) realloc(open->targets, capacity * sizeof(uint32_t));
+		if(targets == NULL) return GEN_FAIL;
+		open->targets = targets;
+		open->capacity = capacity;
+	}
+	open->labels[open->numArcs] = label;
+	open->targets[open->numArcs] = FST_NO_STATE;
+	open->numArcs++;
+	return SUCCESS;
+}
+
+/**
+ * @brief Ensures the path holds an open state for each character of a word
+ * and the state it ends at.
+ *
+ * @param[in, out]	fb		Pointer to the automaton being built.
+ * @param[in]		length	The length of the word.
+ * @return	Return the status of the routine.
+ */
+static RetStatus path_reserve(FstBuilder *fb, const uint32_t length)
+{
+	if(length < fb->pathLength) return SUCCESS;
+	const uint32_t pathLength = (uint32_t)next_2power((size_t)length + 1);
+	OpenState *path = (OpenState*) realloc(fb->path, pathLength * sizeof(OpenState));
+	if(path == NULL) return GEN_FAIL;
+	memset(&(path[fb->pathLength]), 0, (pathLength - fb->pathLength) * sizeof(OpenState));
+	fb->path = path;
+	fb->pathLength = pathLength;
+	return SUCCESS;
+}
+
+/**
+ * @brief Adds the states of the path past a depth to the automaton,
+ * pointing the last arc of each state before them to them.
+ *
+ * @param[in, out]	fb		Pointer to the automaton being built.
+ * @param[in]		from	The depth of the deepest state of the path.
+ * @param[in]		to		The depth of the last state remaining open.
+ * @return	Return the status of the routine.
+ */
+static RetStatus path_freeze(FstBuilder *fb, const uint32_t from, const uint32_t to)
+{
+	for(uint32_t d = from; d > to; d--)
+	{
+		const uint32_t id = builder_freeze(fb, &(fb->path[d]));
+		if(id == FST_NO_STATE) return GEN_FAIL;
+		OpenState *parent = &(fb->path[d - 1]);
+		parent->targets[parent->numArcs - 1] = id;
+	}
+	return SUCCESS;
+}
+
+/**
+ * @brief Frees the memory allocated for the automaton being built.
+ *
+ * @param[in, out]	fb	Pointer to the automaton.
+ * @return	Void
+ */
+static void builder_free(FstBuilder *fb)
+{
+	for(uint32_t d = 0; d < fb->pathLength; d++)
+	{
+		free(fb->path[d].labels);
+		free(fb->path[d].targets);
+	}
+	free(fb->path);
+	free(fb->registry);
+	free(fb->states);
+	free(fb->sizes);
+	free(fb->labels);
+	free(fb->targets);
+	free(fb->outputs);
+}
+
+/**
+ * @brief Builds the minimal automaton of the words of a table, in alphabetical
+ * order, and collects their counts in the same order.
+ *
+ * @param[in]	whtab	Pointer to the table.
+ * @param[out]	fb		Pointer to the automaton to be built.
+ * @param[out]	counts	Pointer to the array of counts to be set.
+ * @param[out]	header	Pointer to the header to be filled.
+ * @return	Return the status of the routine.
+ */
+static RetStatus builder_build(const WordHashTable *whtab, FstBuilder *fb,
+		uint64_t **counts, FstHeader *header)
+{
+	const size_t size = WordHashTable_get_size(whtab);
+	/// The outputs and the sizes of the states are 32-bit positions.
+	if(size >= UINT32_MAX)
+	{
+		fprintf(stderr, "Too many words for an FST: %ld\n", size);
+		return DATA_STRUCT_FULL;
+	}
+	*counts = (uint64_t*) malloc((size + 1) * sizeof(uint64_t));
+	fb->stateCapacity = FST_INITIAL_CAPACITY;
+	fb->arcCapacity = FST_INITIAL_CAPACITY;
+	fb->registryCapacity = 2 * FST_INITIAL_CAPACITY;
+	fb->states = (FstState*) malloc(fb->stateCapacity * sizeof(FstState));
+	fb->sizes = (uint32_t*) malloc(fb->stateCapacity * sizeof(uint32_t));
+	fb->labels = (uint8_t*) malloc(fb->arcCapacity);
+	fb->targets = (uint32_t*) malloc(fb->arcCapacity * sizeof(uint32_t));
+	fb->outputs = (uint32_t*) malloc(fb->arcCapacity * sizeof(uint32_t));
+	fb->registry = (uint32_t*) calloc(fb->registryCapacity, sizeof(uint32_t));
+	if((*counts == NULL) || (fb->states == NULL) || (fb->sizes == NULL) ||
+		(fb->labels == NULL) || (fb->targets == NULL) || (fb->outputs == NULL) ||
+		(fb->registry == NULL) || (path_reserve(fb, 0) != SUCCESS))
+	{
+		fprintf(stderr, "Failed to allocate the FST.\n");
+		return GEN_FAIL;
+	}
+
+	const uint8_t *prev = NULL;
+	uint32_t prevLength = 0;
+	uint64_t numWords = 0;
+	for(size_t i = 0; i < size; i++)
+	{
+		uint32_t length = 0;
+		size_t count = 0;
+		const uint8_t *word = (const uint8_t*) WordHashTable_order_word(whtab, i,
+				&length, &count);
+		if(word == NULL) continue;
+
+		uint32_t shared = 0;
+		if(prev != NULL)
+		{
+			const uint32_t limit = (length < prevLength) ? length : prevLength;
+			while((shared < limit) && (word[shared] == prev[shared])) shared++;
+			/// A word following one it does not sort after would need
+			/// the states already built to change.
+			if((shared == length) || ((shared < prevLength) && (word[shared] < prev[shared])))
+			{
+				fprintf(stderr, "Words out of order while building the FST: %s\n", word);
+				return GEN_FAIL;
+			}
+		}
+		/// Only the states past the shared prefix are final, as
+		/// the following words sort after the current one.
+		if((path_freeze(fb, prevLength, shared) != SUCCESS) ||
+			(path_reserve(fb, length) != SUCCESS))
+		{
+			fprintf(stderr, "Failed to add word '%s' to the FST.\n", word);
+			return GEN_FAIL;
+		}
+		for(uint32_t d = shared; d < length; d++)
+		{
+			if(open_add_arc(&(fb->path[d]), word[d]) != SUCCESS)
+			{
+				fprintf(stderr, "Failed to add word '%s' to the FST.\n", word);
+				return GEN_FAIL;
+			}
+		}
+		fb->path[length].final = true;
+		(*counts)[numWords++] = count;
+		if(length > header->maxLength) header->maxLength = length;
+		prev = word;
+		prevLength = length;
+	}
+	if(path_freeze(fb, prevLength, 0) != SUCCESS)
+	{
+		fprintf(stderr, "Failed to add the last word to the FST.\n");
+		return GEN_FAIL;
+	}
+	header->root = builder_freeze(fb, &(fb->path[0]));
+	if(header->root == FST_NO_STATE)
+	{
+		fprintf(stderr, "Failed to add the first state to the FST.\n");
+		return GEN_FAIL;
+	}
+	memcpy(header->magic, fstMagic, sizeof(fstMagic));
+	header->numWords = numWords;
+	header->numStates = fb->numStates;
+	header->numArcs = fb->numArcs;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Gets the number of padding bytes following the labels of the arcs,
+ * aligning the counts to 8 bytes.
+ *
+ * @param[in]	header	Pointer to the header of the file.
+ * @return	The number of padding bytes.
+ */
+static size_t labels_padding(const FstHeader *header)
+{
+	return (8 - ((sizeof(FstHeader) + (size_t)header->numStates * sizeof(FstState) +
+			(size_t)header->numArcs * (2 * sizeof(uint32_t) + 1)) % 8)) % 8;
+}
+
+RetStatus WordFst_export(const WordHashTable *whtab, const char *path)
+{
+	FstBuilder fb = {0};
+	FstHeader header;
+	memset(&header, 0, sizeof(header));
+	uint64_t *counts = NULL;
+	RetStatus rst = builder_build(whtab, &fb, &counts, &header);
+	if(rst != SUCCESS)
+	{
+		builder_free(&fb);
+		free(counts);
+		return rst;
+	}
+
+	FILE *fp = NULL;
+	if(!file_open(&fp, path, "wb"))
+	{
+		fprintf(stderr, "Failed to create FST file: %s\n", path);
+		builder_free(&fb);
+		free(counts);
+		return GEN_FAIL;
+	}
+	static const uint8_t padding[8] = {0};
+	const size_t numArcs = header.numArcs;
+	if((fwrite(&header, sizeof(header), 1, fp) != 1) ||
+		(fwrite(fb.states, sizeof(FstState), fb.numStates, fp) != fb.numStates) ||
+		(fwrite(fb.targets, sizeof(uint32_t), numArcs, fp) != numArcs) ||
+		(fwrite(fb.outputs, sizeof(uint32_t), numArcs, fp) != numArcs) ||
+		(fwrite(fb.labels, 1, numArcs, fp) != numArcs) ||
+		(fwrite(padding, 1, labels_padding(&header), fp) != labels_padding(&header)) ||
+		(fwrite(counts, sizeof(uint64_t), header.numWords, fp) != header.numWords))
+	{
+		fprintf(stderr, "Failed to write FST file: %s\n", path);
+		rst = GEN_FAIL;
+	}
+	if((fclose(fp) != 0) && (rst == SUCCESS))
+	{
+		fprintf(stderr, "Failed to write FST file: %s\n", path);
+		rst = GEN_FAIL;
+	}
+#ifdef _STATS
+	printf("\nFST statistics:\n");
+	printf("\tWords: %ld\n", header.numWords);
+	printf("\tStates: %u\n", header.numStates);
+	printf("\tArcs: %u\n", header.numArcs);
+	printf("\tFile size: %ld bytes\n", sizeof(header) + header.numStates * sizeof(FstState) +
+			numArcs * (2 * sizeof(uint32_t) + 1) + labels_padding(&header) +
+			header.numWords * sizeof(uint64_t));
+#endif //_STATS
+	builder_free(&fb);
+	free(counts);
+
+	return rst;
+}
+
+bool WordFst_is_magic(const char *bytes, const size_t length)
+{
+	return (length >= sizeof(fstMagic)) && (memcmp(bytes, fstMagic, sizeof(fstMagic)) == 0);
+}
+
+WordFst* WordFst_open(const char *path)
+{
+	uint64_t fileLength = 0;
+	int64_t mtime = 0;
+	if(!file_stats(path, &fileLength, &mtime) || (fileLength < sizeof(FstHeader)) ||
+		(fileLength > SIZE_MAX))
+	{
+		fprintf(stderr, "Failed to read FST file: %s\n", path);
+		return NULL;
+	}
+	WordFst *fst = (WordFst*) calloc(1, sizeof(WordFst));
+	if(fst == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the FST.\n");
+		return NULL;
+	}
+	fst->mappingLength = (size_t)fileLength;
+	fst->mapping = file_map(path, fst->mappingLength);
+	if(fst->mapping == NULL)
+	{
+		fprintf(stderr, "Failed to map FST file: %s\n", path);
+		WordFst_destroy(&fst);
+		return NULL;
+	}
+
+	/// The sections are checked to fill the file exactly.
+	FstHeader *header = &(fst->header);
+	memcpy(header, fst->mapping, sizeof(FstHeader));
+	const uint64_t expected = sizeof(FstHeader) + (uint64_t)header->numStates * sizeof(FstState) +
+			(uint64_t)header->numArcs * (2 * sizeof(uint32_t) + 1) + labels_padding(header) +
+			header->numWords * sizeof(uint64_t);
+	if((memcmp(header->magic, fstMagic, sizeof(fstMagic)) != 0) ||
+		(header->numWords >= UINT32_MAX) || (header->root >= header->numStates) ||
+		(expected != fileLength))
+	{
+		fprintf(stderr, "Invalid FST file: %s\n", path);
+		WordFst_destroy(&fst);
+		return NULL;
+	}
+	const uint8_t *data = (const uint8_t*) fst->mapping + sizeof(FstHeader);
+	fst->states = (const FstState*) data;
+	data += (size_t)header->numStates * sizeof(FstState);
+	fst->targets = (const uint32_t*) data;
+	data += (size_t)header->numArcs * sizeof(uint32_t);
+	fst->outputs = (const uint32_t*) data;
+	data += (size_t)header->numArcs * sizeof(uint32_t);
+	fst->labels = data;
+	data += (size_t)header->numArcs + labels_padding(header);
+	fst->counts = (const uint64_t*) data;
+
+	/// The arcs are checked to stay within the file, while the positions
+	/// and the depth of the words are checked as they are enumerated.
+	for(uint32_t s = 0; s < header->numStates; s++)
+	{
+		const FstState *state = &(fst->states[s]);
+		if((state->firstArc > header->numArcs) ||
+			(state->numArcs > header->numArcs - state->firstArc))
+		{
+			fprintf(stderr, "Invalid FST file: %s\n", path);
+			WordFst_destroy(&fst);
+			return NULL;
+		}
+	}
+	for(uint32_t a = 0; a < header->numArcs; a++)
+	{
+		if(fst->targets[a] >= header->numStates)
+		{
+			fprintf(stderr, "Invalid FST file: %s\n", path);
+			WordFst_destroy(&fst);
+			return NULL;
+		}
+	}
+
+	return fst;
+}
+
+/**
+ * @brief Orders a word against a bound, like strcmp orders them.
+ *
+ * @param[in]	word		Pointer to the characters of the word.
+ * @param[in]	length		The length of the word.
+ * @param[in]	bound		Pointer to the characters of the bound.
+ * @param[in]	boundLength	The length of the bound.
+ * @return	Returns a negative number, 0 or a positive number if the word
+ * sorts before, equal to or after the bound.
+ */
+static int bound_compare(const uint8_t *word, const uint32_t length,
+		const char *bound, const size_t boundLength)
+{
+	const size_t shorter = (length < boundLength) ? length : boundLength;
+	const int cmp = memcmp(word, bound, shorter);
+	if(cmp != 0) return cmp;
+	return (length < boundLength) ? -1 : ((length > boundLength) ? 1 : 0);
+}
+
+WordFstCursor* WordFstCursor_create(const WordFst *fst, const char *from, const char *to)
+{
+	WordFstCursor *cursor = (WordFstCursor*) calloc(1, sizeof(WordFstCursor));
+	if(cursor == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the FST cursor.\n");
+		return NULL;
+	}
+	const uint32_t maxLength = fst->header.maxLength;
+	cursor->fst = fst;
+	cursor->frames = (FstFrame*) malloc(((size_t)maxLength + 1) * sizeof(FstFrame));
+	cursor->key = (uint8_t*) malloc((size_t)maxLength + 1);
+	if(to != NULL)
+	{
+		cursor->toLength = strlen(to);
+		cursor->to = (char*) malloc(cursor->toLength + 1);
+		if(cursor->to != NULL) memcpy(cursor->to, to, cursor->toLength + 1);
+	}
+	if((cursor->frames == NULL) || (cursor->key == NULL) || ((to != NULL) && (cursor->to == NULL)))
+	{
+		fprintf(stderr, "Failed to allocate the FST cursor.\n");
+		WordFstCursor_destroy(&cursor);
+		return NULL;
+	}
+
+	/// The traversal starts from the arcs following the path of the first
+	/// word, the words ending on the path before it sorting before it.
+	const size_t fromLength = strlen(from);
+	FstFrame *frames = cursor->frames;
+	uint32_t depth = 0;
+	frames[0].state = fst->header.root;
+	frames[0].nextArc = 0;
+	frames[0].rank = 0;
+	cursor->visiting = true;
+	for(; depth < fromLength; depth++)
+	{
+		FstFrame *frame = &(frames[depth]);
+		const FstState *state = &(fst->states[frame->state]);
+		const uint8_t *labels = &(fst->labels[state->firstArc]);
+		const uint8_t label = (uint8_t)from[depth];
+		uint32_t arc = 0;
+		while((arc < state->numArcs) && (labels[arc] < label)) arc++;
+		frame->nextArc = arc;
+		if((arc == state->numArcs) || (labels[arc] != label) || (depth == maxLength))
+		{
+			cursor->visiting = false;
+			break;
+		}
+		frame->nextArc++;
+		cursor->key[depth] = labels[arc];
+		frames[depth + 1].state = fst->targets[state->firstArc + arc];
+		frames[depth + 1].nextArc = 0;
+		frames[depth + 1].rank = frame->rank + fst->outputs[state->firstArc + arc];
+	}
+	cursor->depth = depth;
+
+	return cursor;
+}
+
+bool WordFstCursor_next(WordFstCursor *cursor, const char **word, uint32_t *length,
+		uint64_t *count)
+{
+	const WordFst *fst = cursor->fst;
+	while(!cursor->done)
+	{
+		FstFrame *frame = &(cursor->frames[cursor->depth]);
+		const FstState *state = &(fst->states[frame->state]);
+		if(cursor->visiting && (state->final != 0))
+		{
+			/// The arcs of the state are followed on the next call.
+			cursor->visiting = false;
+			if((cursor->to != NULL) && (bound_compare(cursor->key, cursor->depth,
+					cursor->to, cursor->toLength) >= 0))
+			{
+				cursor->done = true;
+				break;
+			}
+			if(frame->rank >= fst->header.numWords)
+			{
+				cursor->failed = true;
+				break;
+			}
+			*word = (const char*) cursor->key;
+			*length = cursor->depth;
+			*count = fst->counts[frame->rank];
+			return true;
+		}
+		if(frame->nextArc < state->numArcs)
+		{
+			/// Paths longer than the longest word can only be part of a cycle.
+			if(cursor->depth == fst->header.maxLength)
+			{
+				cursor->failed = true;
+				break;
+			}
+			const uint32_t arc = state->firstArc + frame->nextArc++;
+			cursor->key[cursor->depth] = fst->labels[arc];
+			FstFrame *child = &(cursor->frames[cursor->depth + 1]);
+			child->state = fst->targets[arc];
+			child->nextArc = 0;
+			child->rank = frame->rank + fst->outputs[arc];
+			cursor->depth++;
+			cursor->visiting = true;
+		}
+		else if(cursor->depth == 0) cursor->done = true;
+		else
+		{
+			cursor->depth--;
+			cursor->visiting = false;
+		}
+	}
+	if(cursor->failed)
+	{
+		fprintf(stderr, "Invalid path in the FST.\n");
+		cursor->done = true;
+	}
+	return false;
+}
+
+bool WordFstCursor_failed(const WordFstCursor *cursor)
+{
+	return cursor->failed;
+}
+
+void WordFstCursor_destroy(WordFstCursor **cursor)
+{
+	free((*cursor)->frames);
+	free((*cursor)->key);
+	free((*cursor)->to);
+	free(*cursor);
+	*cursor = NULL;
+}
+
+size_t WordFst_totals(const WordFst *fst, uint64_t *total, uint64_t *maxCount,
+		uint32_t *maxLength)
+{
+	*total = 0;
+	*maxCount = 0;
+	for(uint64_t i = 0; i < fst->header.numWords; i++)
+	{
+		*total += fst->counts[i];
+		if(fst->counts[i] > *maxCount) *maxCount = fst->counts[i];
+	}
+	*maxLength = fst->header.maxLength;
+
+	return (size_t)fst->header.numWords;
+}
+
+/**
+ * @brief Gets the next word of a cursor being printed.
+ *
+ * @param[in, out]	iter	Pointer to the cursor.
+ * @param[out]		word	Pointer to the bytes of the word, or NULL past the last word.
+ * @param[out]		length	Pointer to the length of the word.
+ * @param[out]		count	Pointer to the count of the word.
+ * @return	Return the status of the routine.
+ */
+static RetStatus cursor_next(void *iter, const char **word, uint32_t *length, size_t *count)
+{
+	WordFstCursor *cursor = (WordFstCursor*)iter;
+	uint64_t wordCount = 0;
+	if(!WordFstCursor_next(cursor, word, length, &wordCount))
+	{
+		*word = NULL;
+		return WordFstCursor_failed(cursor) ? GEN_FAIL : SUCCESS;
+	}
+	*count = (size_t)wordCount;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Prints the words of a range along with their counts, enumerating
+ * them once to size the columns and once more to print them.
+ *
+ * @param[in]	fst		Pointer to the transducer.
+ * @param[in]	from	Pointer to the null terminated string of the first word.
+ * @param[in]	to		Pointer to the null terminated string of the word ending
+ * 						the range, NULL for no end.
+ * @return	Return the status of the routine.
+ */
+static RetStatus fst_print(const WordFst *fst, const char *from, const char *to)
+{
+	WordFstCursor *cursor = WordFstCursor_create(fst, from, to);
+	if(cursor == NULL) return GEN_FAIL;
+	const char *word = NULL;
+	uint32_t length = 0;
+	uint64_t count = 0;
+	size_t numFound = 0;
+	uint32_t maxLength = 0;
+	uint64_t maxCount = 0;
+	while(WordFstCursor_next(cursor, &word, &length, &count))
+	{
+		numFound++;
+		if(length > maxLength) maxLength = length;
+		if(count > maxCount) maxCount = count;
+	}
+	const bool failed = WordFstCursor_failed(cursor);
+	WordFstCursor_destroy(&cursor);
+	if(failed) return GEN_FAIL;
+	if(numFound == 0) return SUCCESS;
+
+	cursor = WordFstCursor_create(fst, from, to);
+	if(cursor == NULL) return GEN_FAIL;
+	const RetStatus rst = CountTable_print("word", "Word", maxLength, (size_t)maxCount,
+			cursor_next, cursor);
+	WordFstCursor_destroy(&cursor);
+
+	return rst;
+}
+
+RetStatus WordFst_print_prefix(const WordFst *fst, const char *prefix)
+{
+	/// The words starting with the prefix sort before the shortest string
+	/// following all of them, made by incrementing the last character of
+	/// the prefix which is not the highest one.
+	const size_t length = strlen(prefix);
+	char *end = (char*) malloc(length + 1);
+	if(end == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the end of the prefix.\n");
+		return GEN_FAIL;
+	}
+	memcpy(end, prefix, length);
+	size_t endLength = length;
+	while((endLength > 0) && ((uint8_t)end[endLength - 1] == UINT8_MAX)) endLength--;
+	if(endLength > 0) end[endLength - 1] = (char)((uint8_t)end[endLength - 1] + 1);
+	end[endLength] = '\0';
+
+	const RetStatus rst = fst_print(fst, prefix, (endLength > 0) ? end : NULL);
+	free(end);
+
+	return rst;
+}
+
+RetStatus WordFst_print_range(const WordFst *fst, const char *from, const char *to)
+{
+	return fst_print(fst, from, to);
+}
+
+void WordFst_destroy(WordFst **fst)
+{
+	if((*fst)->mapping != NULL) file_unmap((*fst)->mapping, (*fst)->mappingLength);
+	free(*fst);
+	*fst = NULL;
+}
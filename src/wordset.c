@@ -0,0 +1,608 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "wordset.h"
+#include "inputstream.h"
+#include "utils.h"
+#include <string.h>
+
+/// The average number of words hashed to a bucket.
+#define WORDS_PER_BUCKET 4
+/// The number of seeds tried for a bucket before giving up.
+#define MAX_BUCKET_SEEDS (1u << 24)
+/// Marks the seed of a bucket holding a single word, which instead
+/// of a seed holds the slot of the word.
+#define SINGLE_WORD_SEED (1u << 31)
+/// The initial number of words of the vector reading the file.
+#define INITIAL_SET_WORDS 256
+
+/// Identifies the compiled word set file format.
+static const char wordSetMagic[8] = {'W', 'C', 'W', 'S', 'E', 'T', '0', '1'};
+
+/// @brief A slot of the table, holding one of the words.
+typedef struct
+{
+	/// The first 8 bytes of the word, padded with zeros.
+	uint64_t packed;
+	/// The offset of the word in the pool of characters.
+	uint32_t offset;
+	/// The length of the word.
+	uint32_t length;
+}WordSlot;
+
+struct WordSet
+{
+	/// The slot of each word.
+	WordSlot *slots;
+	/// The number of words, equal to the number of slots.
+	uint32_t numWords;
+	/// The seed of each bucket.
+	uint32_t *seeds;
+	/// The number of buckets.
+	uint32_t numBuckets;
+	/// The characters of all the words.
+	char *pool;
+	/// The number of characters of the pool.
+	uint64_t poolLength;
+	/// Bit i is set if a word is i bytes long, the last bit for any longer word.
+	uint64_t lengths;
+	/// The hash of all the words, 0 if there are none.
+	uint64_t signature;
+	/// The contents of the compiled file the set is read from,
+	/// NULL if the set was built from the words of a text file.
+	void *mapping;
+	/// The number of bytes of the compiled file.
+	size_t mappingLength;
+};
+
+/// @brief The header of a compiled word set file, followed by the slots,
+/// the seeds of the buckets and the pool of the set.
+typedef struct
+{
+	/// The magic number of the format.
+	char magic[8];
+	/// The signature of the token rules the words were read with.
+	uint64_t rules;
+	/// The mask of the lengths of the words.
+	uint64_t lengths;
+	/// The hash of all the words.
+	uint64_t signature;
+	/// The number of characters of the pool.
+	uint64_t poolLength;
+	/// The number of words.
+	uint32_t numWords;
+	/// The number of buckets.
+	uint32_t numBuckets;
+}WordSetHeader;
+
+/// @brief A word read from the file, along with its hash.
+typedef struct
+{
+	/// Pointer to the characters of the word.
+	const char *letters;
+	/// The length of the word.
+	uint32_t length;
+	/// The hash of the word.
+	uint64_t hash;
+}WordKey;
+
+/**
+ * @brief Scrambles the bits of a 64-bit value, so that close values
+ * are hashed to unrelated ones.
+ *
+ * @param[in]	val	The value.
+ * @return	The scrambled value.
+ */
+static uint64_t mix64(uint64_t val)
+{
+	val ^= val >> 30;
+	val *= 0xBF58476D1CE4E5B9ULL;
+	val ^= val >> 27;
+	val *= 0x94D049BB133111EBULL;
+	val ^= val >> 31;
+	return val;
+}
+
+/**
+ * @brief Gets the slot a hash is placed in with the seed of its bucket.
+ *
+ * @param[in]	hash		The hash of the word.
+ * @param[in]	seed		The seed of the bucket.
+ * @param[in]	numSlots	The number of slots.
+ * @return	The index of the slot.
+ */
+static uint32_t seed_slot(const uint64_t hash, const uint32_t seed, const uint32_t numSlots)
+{
+	if(seed & SINGLE_WORD_SEED) return seed & ~SINGLE_WORD_SEED;
+	return (uint32_t)(mix64(hash + seed * 0x9E3779B97F4A7C15ULL) % numSlots);
+}
+
+/**
+ * @brief Packs the first 8 bytes of a word to a single integer.
+ *
+ * @param[in]	letters	Pointer to the characters of the word.
+ * @param[in]	length	The length of the word.
+ * @return	The packed bytes, padded with zeros.
+ */
+static uint64_t word_pack(const char *letters, const uint32_t length)
+{
+	uint64_t packed = 0;
+	memcpy(&packed, letters, (length < sizeof(packed)) ? length : sizeof(packed));
+	return packed;
+}
+
+/**
+ * @brief Gets the bit of the mask of lengths standing for a length.
+ *
+ * @param[in]	length	The length of a word.
+ * @return	The bit of the length.
+ */
+static uint64_t length_bit(const uint32_t length)
+{
+	return 1ULL << ((length < 63) ? length : 63);
+}
+
+/**
+ * @brief Orders two words by length and then by their characters.
+ *
+ * @param[in]	a	Pointer to the first word.
+ * @param[in]	b	Pointer to the second word.
+ * @return	Negative, zero or positive if the first word precedes, equals
+ * or follows the second.
+ */
+static int key_compare(const void *a, const void *b)
+{
+	const WordKey *ka = (const WordKey*) a;
+	const WordKey *kb = (const WordKey*) b;
+	if(ka->length != kb->length) return (ka->length < kb->length) ? -1 : 1;
+	return memcmp(ka->letters, kb->letters, ka->length);
+}
+
+/**
+ * @brief Orders two buckets by decreasing number of words.
+ *
+ * @param[in]	a	Pointer to the first bucket, its number of words
+ * 					in the upper 32 bits and its index in the lower ones.
+ * @param[in]	b	Pointer to the second bucket.
+ * @return	Negative, zero or positive if the first bucket precedes, equals
+ * or follows the second.
+ */
+static int bucket_compare(const void *a, const void *b)
+{
+	const uint64_t ba = *(const uint64_t*) a;
+	const uint64_t bb = *(const uint64_t*) b;
+	return (ba > bb) ? -1 : (ba < bb);
+}
+
+/**
+ * @brief Finds the seed of each bucket, so that every word gets a slot
+ * of its own, and places the words in their slots.
+ * @details The buckets holding the most words are placed first, while
+ * the table is still empty. Buckets of a single word take any free slot.
+ *
+ * @param[in, out]	set		Pointer to the set, with its buckets allocated.
+ * @param[in]		keys	Pointer to the distinct words.
+ * @param[in]		name	Pointer to the string naming the words in error messages.
+ * @return	Return the status of the routine.
+ */
+static RetStatus WordSet_place(WordSet *set, const WordKey *keys, const char *name)
+{
+	const uint32_t numWords = set->numWords;
+	const uint32_t numBuckets = set->numBuckets;
+	if(numWords == 0) return SUCCESS;
+
+	uint32_t *sizes = (uint32_t*) calloc(numBuckets, sizeof(uint32_t));
+	uint32_t *starts = (uint32_t*) calloc((size_t)numBuckets + 1, sizeof(uint32_t));
+	uint64_t *order = (uint64_t*) malloc(numBuckets * sizeof(uint64_t));
+	uint32_t *members = (uint32_t*) malloc(numWords * sizeof(uint32_t));
+	uint32_t *bucketSlots = (uint32_t*) malloc(numWords * sizeof(uint32_t));
+	bool *taken = (bool*) calloc(numWords, sizeof(bool));
+	RetStatus rst = SUCCESS;
+	if((sizes == NULL) || (starts == NULL) || (order == NULL) || (members == NULL) ||
+		(bucketSlots == NULL) || (taken == NULL))
+	{
+		fprintf(stderr, "Failed to allocate the buckets of the %s.\n", name);
+		rst = GEN_FAIL;
+	}
+
+	if(rst == SUCCESS)
+	{
+		/// Groups the words by bucket, the words of bucket b
+		/// being members[starts[b]] to members[starts[b + 1] - 1].
+		for(uint32_t i = 0; i < numWords; i++) sizes[(keys[i].hash >> 32) % numBuckets]++;
+		for(uint32_t b = 0; b < numBuckets; b++)
+		{
+			starts[b + 1] = starts[b] + sizes[b];
+			order[b] = ((uint64_t)sizes[b] << 32) | b;
+		}
+		for(uint32_t i = 0; i < numWords; i++)
+		{
+			const uint32_t b = (uint32_t)((keys[i].hash >> 32) % numBuckets);
+			members[starts[b + 1] - sizes[b]] = i;
+			sizes[b]--;
+		}
+		for(uint32_t b = 0; b < numBuckets; b++) sizes[b] = starts[b + 1] - starts[b];
+		qsort(order, numBuckets, sizeof(uint64_t), bucket_compare);
+	}
+
+	uint32_t freeSlot = 0;
+	for(uint32_t o = 0; (rst == SUCCESS) && (o < numBuckets); o++)
+	{
+		const uint32_t b = (uint32_t)order[o];
+		const uint32_t *bucket = members + starts[b];
+		if(sizes[b] == 0) break;
+		if(sizes[b] == 1)
+		{
+			while(taken[freeSlot]) freeSlot++;
+			set->seeds[b] = SINGLE_WORD_SEED | freeSlot;
+			taken[freeSlot] = true;
+			continue;
+		}
+
+		uint32_t seed = 0;
+		for(; seed < MAX_BUCKET_SEEDS; seed++)
+		{
+			uint32_t placed = 0;
+			for(; placed < sizes[b]; placed++)
+			{
+				const uint32_t slot = seed_slot(keys[bucket[placed]].hash, seed, numWords);
+				if(taken[slot]) break;
+				taken[slot] = true;
+				bucketSlots[placed] = slot;
+			}
+			if(placed == sizes[b]) break;
+			/// Frees the slots taken by the words placed with this seed.
+			for(uint32_t j = 0; j < placed; j++) taken[bucketSlots[j]] = false;
+		}
+		if(seed == MAX_BUCKET_SEEDS)
+		{
+			fprintf(stderr, "Failed to find a perfect hash for the %s.\n", name);
+			rst = GEN_FAIL;
+			break;
+		}
+		set->seeds[b] = seed;
+	}
+
+	/// Each word is copied to its slot.
+	for(uint32_t i = 0; (rst == SUCCESS) && (i < numWords); i++)
+	{
+		const uint32_t slot = seed_slot(keys[i].hash,
+				set->seeds[(keys[i].hash >> 32) % numBuckets], numWords);
+		set->slots[slot].packed = word_pack(keys[i].letters, keys[i].length);
+		set->slots[slot].offset = (uint32_t)(keys[i].letters - set->pool);
+		set->slots[slot].length = keys[i].length;
+	}
+
+	free(sizes);
+	free(starts);
+	free(order);
+	free(members);
+	free(bucketSlots);
+	free(taken);
+
+	return rst;
+}
+
+/**
+ * @brief Reads the words of a file, tokenized with the rules of the input.
+ *
+ * @param[in]	path	Pointer to the string containing the path of the file.
+ * @param[in]	rules	Pointer to the rules splitting the input into words.
+ * @param[in]	name	Pointer to the string naming the words in error messages.
+ * @param[out]	vec		Pointer to the Word Buffer Vector to be filled.
+ * @return	Return the status of the routine.
+ */
+static RetStatus set_words_read(const char *path, const TokenRules *rules, const char *name,
+		WordBufferVector *vec)
+{
+	FILE *fp = NULL;
+	if(!file_open(&fp, path, "rb"))
+	{
+		fprintf(stderr, "Failed to open %s file: %s\n", name, path);
+		return GEN_FAIL;
+	}
+	InputStream *stream = InputStream_open(fp);
+	InputReader *inp = (stream != NULL) ? InputReader_create(stream, false, rules, NULL) : NULL;
+	RetStatus rst = (inp != NULL) ? SUCCESS : GEN_FAIL;
+	while((rst == SUCCESS) && !InputReader_eof(inp))
+	{
+		rst = InputReader_read(inp, vec, 0);
+	}
+	if(rst != SUCCESS) fprintf(stderr, "Failed to read %s file: %s\n", name, path);
+	if(inp != NULL) InputReader_destroy(&inp);
+	if(stream != NULL) InputStream_close(&stream);
+	fclose(fp);
+
+	return rst;
+}
+
+/**
+ * @brief Builds a Word Set from the words of a text file.
+ *
+ * @param[in]	path	Pointer to the string containing the path of the file.
+ * @param[in]	rules	Pointer to the rules splitting the input into words.
+ * @param[in]	name	Pointer to the string naming the words in error messages.
+ * @return	Return a pointer to the allocated set.
+ */
+static WordSet* WordSet_build(const char *path, const TokenRules *rules, const char *name)
+{
+	WordBufferVector *vec = WordBufferVector_create(INITIAL_SET_WORDS);
+	if(vec == NULL) return NULL;
+	if(set_words_read(path, rules, name, vec) != SUCCESS)
+	{
+		WordBufferVector_destroy(&vec);
+		return NULL;
+	}
+
+	WordSet *set = (WordSet*) calloc(1, sizeof(WordSet));
+	const size_t numRead = WordBufferVector_get_size(vec);
+	WordKey *keys = (WordKey*) malloc((numRead + 1) * sizeof(WordKey));
+	size_t poolLen = 0;
+	for(size_t i = 0; i < numRead; i++)
+		poolLen += WordBuffer_get_length(WordBufferVector_at(vec, i));
+	if((set == NULL) || (keys == NULL) || (numRead >= SINGLE_WORD_SEED) ||
+		(poolLen > UINT32_MAX) || ((set->pool = (char*) malloc(poolLen + 1)) == NULL))
+	{
+		fprintf(stderr, "Failed to allocate the %s.\n", name);
+		free(keys);
+		if(set != NULL) WordSet_destroy(&set);
+		WordBufferVector_destroy(&vec);
+		return NULL;
+	}
+	set->poolLength = poolLen;
+
+	/// The words are copied to the pool, sorted and deduplicated,
+	/// as each of them must get a slot of its own.
+	char *letters = set->pool;
+	for(size_t i = 0; i < numRead; i++)
+	{
+		const WordBuffer *wbuf = WordBufferVector_at(vec, i);
+		keys[i].length = WordBuffer_get_length(wbuf);
+		keys[i].letters = letters;
+		memcpy(letters, WordBuffer_get_word(wbuf), keys[i].length);
+		letters += keys[i].length;
+	}
+	WordBufferVector_destroy(&vec);
+	qsort(keys, numRead, sizeof(WordKey), key_compare);
+	uint32_t numWords = 0;
+	for(size_t i = 0; i < numRead; i++)
+	{
+		if((numWords != 0) && (key_compare(&keys[numWords - 1], &keys[i]) == 0)) continue;
+		keys[numWords] = keys[i];
+		keys[numWords].hash = fnvhash((const uint8_t*) keys[i].letters, keys[i].length);
+		set->lengths |= length_bit(keys[i].length);
+		set->signature = mix64(set->signature ^ keys[numWords].hash);
+		numWords++;
+	}
+
+	set->numWords = numWords;
+	set->numBuckets = numWords / WORDS_PER_BUCKET + 1;
+	set->slots = (WordSlot*) calloc((size_t)numWords + 1, sizeof(WordSlot));
+	set->seeds = (uint32_t*) calloc(set->numBuckets, sizeof(uint32_t));
+	if((set->slots == NULL) || (set->seeds == NULL) ||
+		(WordSet_place(set, keys, name) != SUCCESS))
+	{
+		if((set->slots == NULL) || (set->seeds == NULL))
+			fprintf(stderr, "Failed to allocate the %s.\n", name);
+		free(keys);
+		WordSet_destroy(&set);
+		return NULL;
+	}
+	free(keys);
+
+	return set;
+}
+
+/**
+ * @brief Checks whether a file holds a compiled Word Set.
+ *
+ * @param[in]	path	Pointer to the string containing the path of the file.
+ * @return	Returns true if the file starts with the magic number of the format.
+ */
+static bool set_file_compiled(const char *path)
+{
+	FILE *fp = NULL;
+	if(!file_open(&fp, path, "rb")) return false;
+	char magic[sizeof(wordSetMagic)];
+	const bool compiled = (fread(magic, sizeof(magic), 1, fp) == 1) &&
+			(memcmp(magic, wordSetMagic, sizeof(magic)) == 0);
+	fclose(fp);
+
+	return compiled;
+}
+
+/**
+ * @brief Loads a compiled Word Set, pointing the set to the file
+ * mapped to memory instead of copying it.
+ *
+ * @param[in]	path	Pointer to the string containing the path of the file.
+ * @param[in]	rules	Pointer to the rules splitting the input into words.
+ * @param[in]	name	Pointer to the string naming the words in error messages.
+ * @return	Return a pointer to the allocated set.
+ */
+static WordSet* WordSet_load(const char *path, const TokenRules *rules, const char *name)
+{
+	uint64_t fileLength = 0;
+	int64_t mtime = 0;
+	if(!file_stats(path, &fileLength, &mtime) || (fileLength < sizeof(WordSetHeader)) ||
+		(fileLength > SIZE_MAX))
+	{
+		fprintf(stderr, "Failed to read compiled %s file: %s\n", name, path);
+		return NULL;
+	}
+	WordSet *set = (WordSet*) calloc(1, sizeof(WordSet));
+	if(set == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the %s.\n", name);
+		return NULL;
+	}
+	set->mappingLength = (size_t)fileLength;
+	set->mapping = file_map(path, set->mappingLength);
+	if(set->mapping == NULL)
+	{
+		fprintf(stderr, "Failed to map compiled %s file: %s\n", name, path);
+		WordSet_destroy(&set);
+		return NULL;
+	}
+
+	/// The sections are checked to fill the file exactly.
+	WordSetHeader header;
+	memcpy(&header, set->mapping, sizeof(header));
+	const uint64_t expected = sizeof(header) + (uint64_t)header.numWords * sizeof(WordSlot) +
+			(uint64_t)header.numBuckets * sizeof(uint32_t) + header.poolLength;
+	bool valid = (header.numWords != 0) && (header.numBuckets != 0) &&
+		(header.numWords < SINGLE_WORD_SEED) && (header.poolLength <= UINT32_MAX) &&
+		(expected == fileLength);
+	/// The words of the slots are checked to lie within the pool, as they are
+	/// read without bounds checks, while the slots the seeds lead to are
+	/// checked on each lookup.
+	const WordSlot *slots = (const WordSlot*) ((char*) set->mapping + sizeof(header));
+	for(uint32_t i = 0; valid && (i < header.numWords); i++)
+	{
+		valid = ((uint64_t)slots[i].offset + slots[i].length <= header.poolLength);
+	}
+	if(!valid)
+	{
+		fprintf(stderr, "Invalid compiled %s file: %s\n", name, path);
+		WordSet_destroy(&set);
+		return NULL;
+	}
+	if(header.rules != TokenRules_signature(rules))
+	{
+		fprintf(stderr, "Compiled %s file %s was built with other token rules.\n",
+				name, path);
+		WordSet_destroy(&set);
+		return NULL;
+	}
+
+	char *sections = (char*) set->mapping + sizeof(header);
+	set->slots = (WordSlot*) sections;
+	set->seeds = (uint32_t*) (sections + (size_t)header.numWords * sizeof(WordSlot));
+	set->pool = (char*) set->seeds + (size_t)header.numBuckets * sizeof(uint32_t);
+	set->numWords = header.numWords;
+	set->numBuckets = header.numBuckets;
+	set->poolLength = header.poolLength;
+	set->lengths = header.lengths;
+	set->signature = header.signature;
+
+	return set;
+}
+
+WordSet* WordSet_create(const char *path, const TokenRules *rules, const char *name)
+{
+	if(set_file_compiled(path)) return WordSet_load(path, rules, name);
+	return WordSet_build(path, rules, name);
+}
+
+RetStatus WordSet_save(const WordSet *set, const TokenRules *rules, const char *path)
+{
+	FILE *fp = NULL;
+	if(!file_open(&fp, path, "wb"))
+	{
+		fprintf(stderr, "Failed to open compiled file: %s\n", path);
+		return GEN_FAIL;
+	}
+
+	WordSetHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, wordSetMagic, sizeof(wordSetMagic));
+	header.rules = TokenRules_signature(rules);
+	header.lengths = set->lengths;
+	header.signature = set->signature;
+	header.poolLength = set->poolLength;
+	header.numWords = set->numWords;
+	header.numBuckets = set->numBuckets;
+	if((fwrite(&header, sizeof(header), 1, fp) != 1) ||
+		(fwrite(set->slots, sizeof(WordSlot), set->numWords, fp) != set->numWords) ||
+		(fwrite(set->seeds, sizeof(uint32_t), set->numBuckets, fp) != set->numBuckets) ||
+		(fwrite(set->pool, sizeof(char), (size_t)set->poolLength, fp) != set->poolLength))
+	{
+		fprintf(stderr, "Failed to write compiled file: %s\n", path);
+		fclose(fp);
+		remove(path);
+		return GEN_FAIL;
+	}
+	if(fclose(fp) != 0)
+	{
+		fprintf(stderr, "Failed to write compiled file: %s\n", path);
+		remove(path);
+		return GEN_FAIL;
+	}
+
+	return SUCCESS;
+}
+
+uint32_t WordSet_find(const WordSet *set, const WordBuffer *wbuf)
+{
+	const uint32_t length = WordBuffer_get_length(wbuf);
+	/// Words of lengths no word of the set has are missing without hashing them.
+	if((set->lengths & length_bit(length)) == 0) return WORD_SET_MISSING;
+
+	const char *letters = WordBuffer_get_word(wbuf);
+	const uint64_t hash = fnvhash((const uint8_t*) letters, length);
+	const uint32_t slot = seed_slot(hash, set->seeds[(hash >> 32) % set->numBuckets],
+			set->numWords);
+	/// The seeds of a compiled set may lead anywhere if its file is corrupt.
+	if(slot >= set->numWords) return WORD_SET_MISSING;
+	/// Any word is hashed to a slot, so the slot is compared to the word,
+	/// its first 8 bytes at once.
+	const WordSlot *entry = &(set->slots[slot]);
+	if((entry->length != length) || (entry->packed != word_pack(letters, length)))
+		return WORD_SET_MISSING;
+	if((length > sizeof(entry->packed)) &&
+		(memcmp(set->pool + entry->offset + sizeof(entry->packed),
+				letters + sizeof(entry->packed), length - sizeof(entry->packed)) != 0))
+		return WORD_SET_MISSING;
+
+	return slot;
+}
+
+uint32_t WordSet_size(const WordSet *set)
+{
+	return set->numWords;
+}
+
+const char* WordSet_word(const WordSet *set, const uint32_t index, uint32_t *length)
+{
+	if(index >= set->numWords)
+	{
+		*length = 0;
+		return NULL;
+	}
+	*length = set->slots[index].length;
+	return set->pool + set->slots[index].offset;
+}
+
+uint64_t WordSet_signature(const WordSet *set)
+{
+	return set->signature;
+}
+
+void WordSet_destroy(WordSet **set)
+{
+	/// The arrays of a compiled set point into its file.
+	if((*set)->mapping != NULL) file_unmap((*set)->mapping, (*set)->mappingLength);
+	else
+	{
+		free((*set)->slots);
+		free((*set)->seeds);
+		free((*set)->pool);
+	}
+	free(*set);
+	*set = NULL;
+}
@@ -0,0 +1,854 @@
+/**
+ * This file is part of WordCounter.
+ * Copyright (C) 2019  Konstantinos Metaxas (konpmetaxas@gmail.com)
+ *
+ * WordCounter is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * WordCounter is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with WordCounter.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "wordtree.h"
+#include "utils.h"
+#include <string.h>
+
+/// Marks the children which are leaves rather than inner nodes.
+#define LEAF_TAG ((uintptr_t)1)
+/// The initial capacity of the buffer of the word being printed.
+#define INITIAL_KEY_LENGTH 64
+/// The initial capacity of the stack of the nodes being traversed.
+#define INITIAL_STACK_DEPTH 64
+
+/// @brief The types of the inner nodes, by the number of children they fit.
+typedef enum
+{
+	NODE4,
+	NODE16,
+	NODE48,
+	NODE256,
+	NUM_NODE_TYPES
+}NodeType;
+
+/// @brief The header of the inner nodes, followed by their children
+/// and then by the bytes of their prefix.
+typedef struct
+{
+	/// The number of occurrences of the word ending at the node, 0 if none.
+	size_t count;
+	/// The number of bytes shared by all the words below the node.
+	uint32_t prefixLen;
+	/// The number of children of the node.
+	uint16_t numChildren;
+	/// The NodeType of the node.
+	uint8_t type;
+}TreeNode;
+
+/// @brief A node of up to 4 children, sorted by their byte.
+typedef struct
+{
+	TreeNode hdr;
+	uint8_t keys[4];
+	void *children[4];
+}Node4;
+
+/// @brief A node of up to 16 children, sorted by their byte.
+typedef struct
+{
+	TreeNode hdr;
+	uint8_t keys[16];
+	void *children[16];
+}Node16;
+
+/// @brief A node of up to 48 children, indexed by their byte.
+typedef struct
+{
+	TreeNode hdr;
+	/// The position of the child of each byte plus 1, 0 if none.
+	uint8_t index[256];
+	void *children[48];
+}Node48;
+
+/// @brief A node with a child for each byte.
+typedef struct
+{
+	TreeNode hdr;
+	void *children[256];
+}Node256;
+
+/// @brief A word below the last node of its path, holding the bytes
+/// following the byte of the node leading to it.
+typedef struct
+{
+	/// The number of occurrences of the word.
+	size_t count;
+	/// The number of bytes of the suffix.
+	uint32_t length;
+	/// The bytes of the suffix.
+	uint8_t suffix[];
+}TreeLeaf;
+
+/// @brief A node being traversed.
+typedef struct
+{
+	/// Pointer to the node.
+	TreeNode *node;
+	/// The length of the word up to the end of the prefix of the node.
+	uint32_t keyLen;
+	/// The position of the next child of the node to be traversed.
+	uint32_t next;
+}TreeFrame;
+
+static const size_t nodeSizes[NUM_NODE_TYPES] =
+		{sizeof(Node4), sizeof(Node16), sizeof(Node48), sizeof(Node256)};
+static const uint16_t nodeCapacities[NUM_NODE_TYPES] = {4, 16, 48, 256};
+
+struct WordTree
+{
+	/// The root of the tree, either a node or a tagged leaf, NULL if empty.
+	void *root;
+	/// The number of distinct words of the tree.
+	size_t numWords;
+	/// The number of inner nodes of each type.
+	size_t numNodes[NUM_NODE_TYPES];
+	/// The number of leaves.
+	size_t numLeaves;
+	/// The number of bytes used by the nodes and the leaves.
+	size_t memory;
+	/// The length of the longest word.
+	uint32_t maxLength;
+	/// The count of the most common word.
+	size_t maxCount;
+#ifdef _STATS
+	/// The most common word.
+	WordBuffer *maxCountWord;
+#endif //_STATS
+	/// The buffer of the word being printed.
+	char *key;
+	/// The capacity of the buffer of the word being printed.
+	size_t keyCapacity;
+	/// The stack of the nodes being traversed.
+	TreeFrame *stack;
+	/// The capacity of the stack.
+	size_t stackCapacity;
+};
+
+WordTree* WordTree_create(void)
+{
+	WordTree *tree = (WordTree*) calloc(1, sizeof(WordTree));
+	if(tree == NULL)
+	{
+		fprintf(stderr, "Failed to allocate the word tree.\n");
+		return NULL;
+	}
+
+	tree->keyCapacity = INITIAL_KEY_LENGTH;
+	tree->key = (char*) malloc(tree->keyCapacity);
+	tree->stackCapacity = INITIAL_STACK_DEPTH;
+	tree->stack = (TreeFrame*) malloc(tree->stackCapacity * sizeof(TreeFrame));
+#ifdef _STATS
+	tree->maxCountWord = WordBuffer_create(INITIAL_KEY_LENGTH);
+	if(tree->maxCountWord == NULL)
+	{
+		WordTree_destroy(&tree);
+		return NULL;
+	}
+#endif //_STATS
+	if((tree->key == NULL) || (tree->stack == NULL))
+	{
+		fprintf(stderr, "Failed to allocate the word tree.\n");
+		WordTree_destroy(&tree);
+		return NULL;
+	}
+
+	return tree;
+}
+
+static inline bool is_leaf(const void *child)
+{
+	return ((uintptr_t)child & LEAF_TAG) != 0;
+}
+
+static inline TreeLeaf* leaf_of(const void *child)
+{
+	return (TreeLeaf*)((uintptr_t)child & ~LEAF_TAG);
+}
+
+static inline uint8_t* node_prefix(TreeNode *node)
+{
+	return (uint8_t*)node + nodeSizes[node->type];
+}
+
+/**
+ * @brief Allocates a new leaf.
+ *
+ * @param[in, out]	tree	Pointer to the tree.
+ * @param[in]		suffix	Pointer to the bytes of the suffix.
+ * @param[in]		length	The number of bytes of the suffix.
+ * @param[in]		count	The number of occurrences of the word.
+ * @return	Return the tagged pointer to the leaf, NULL on failure.
+ */
+static void* leaf_create(WordTree *tree, const uint8_t *suffix, const uint32_t length,
+		const size_t count)
+{
+	TreeLeaf *leaf = (TreeLeaf*) malloc(sizeof(TreeLeaf) + length);
+	if(leaf == NULL)
+	{
+		fprintf(stderr, "Failed to allocate a leaf of the word tree.\n");
+		return NULL;
+	}
+	leaf->count = count;
+	leaf->length = length;
+	memcpy(leaf->suffix, suffix, length);
+	tree->numLeaves++;
+	tree->memory += sizeof(TreeLeaf) + length;
+
+	return (void*)((uintptr_t)leaf | LEAF_TAG);
+}
+
+/**
+ * @brief Allocates a new inner node without children.
+ *
+ * @param[in, out]	tree		Pointer to the tree.
+ * @param[in]		type		The NodeType of the node.
+ * @param[in]		prefix		Pointer to the bytes of the prefix.
+ * @param[in]		prefixLen	The number of bytes of the prefix.
+ * @return	Return a pointer to the node, NULL on failure.
+ */
+static TreeNode* node_create(WordTree *tree, const NodeType type, const uint8_t *prefix,
+		const uint32_t prefixLen)
+{
+	TreeNode *node = (TreeNode*) calloc(1, nodeSizes[type] + prefixLen);
+	if(node == NULL)
+	{
+		fprintf(stderr, "Failed to allocate a node of the word tree.\n");
+		return NULL;
+	}
+	node->type = (uint8_t)type;
+	node->prefixLen = prefixLen;
+	memcpy(node_prefix(node), prefix, prefixLen);
+	tree->numNodes[type]++;
+	tree->memory += nodeSizes[type] + prefixLen;
+
+	return node;
+}
+
+/**
+ * @brief Frees an inner node, which no longer holds any children.
+ *
+ * @param[in, out]	tree	Pointer to the tree.
+ * @param[in]		node	Pointer to the node.
+ * @return	Void
+ */
+static void node_free(WordTree *tree, TreeNode *node)
+{
+	tree->numNodes[node->type]--;
+	tree->memory -= nodeSizes[node->type] + node->prefixLen;
+	free(node);
+}
+
+/**
+ * @brief Finds the child of a node for a byte.
+ *
+ * @param[in]	node	Pointer to the node.
+ * @param[in]	byte	The byte of the child.
+ * @return	Pointer to the reference to the child, NULL if there is none.
+ */
+static inline void** node_find_child(TreeNode *node, const uint8_t byte)
+{
+	switch(node->type)
+	{
+		case NODE4:
+		{
+			Node4 *n4 = (Node4*)node;
+			for(uint32_t i = 0; i < node->numChildren; i++)
+			{
+				if(n4->keys[i] == byte) return &(n4->children[i]);
+			}
+			return NULL;
+		}
+		case NODE16:
+		{
+			Node16 *n16 = (Node16*)node;
+			for(uint32_t i = 0; i < node->numChildren; i++)
+			{
+				if(n16->keys[i] == byte) return &(n16->children[i]);
+			}
+			return NULL;
+		}
+		case NODE48:
+		{
+			Node48 *n48 = (Node48*)node;
+			return (n48->index[byte] != 0) ? &(n48->children[n48->index[byte] - 1]) : NULL;
+		}
+		default:
+		{
+			Node256 *n256 = (Node256*)node;
+			return (n256->children[byte] != NULL) ? &(n256->children[byte]) : NULL;
+		}
+	}
+}
+
+/**
+ * @brief Replaces a full node by a node of the next type holding its children.
+ *
+ * @param[in, out]	tree	Pointer to the tree.
+ * @param[in, out]	ref		Pointer to the reference to the node.
+ * @return	Return the status of the routine.
+ */
+static RetStatus node_grow(WordTree *tree, void **ref)
+{
+	TreeNode *node = (TreeNode*)*ref;
+	TreeNode *grown = node_create(tree, (NodeType)(node->type + 1), node_prefix(node),
+			node->prefixLen);
+	if(grown == NULL) return GEN_FAIL;
+	grown->count = node->count;
+	grown->numChildren = node->numChildren;
+
+	switch(node->type)
+	{
+		case NODE4:
+		{
+			Node4 *n4 = (Node4*)node;
+			Node16 *n16 = (Node16*)grown;
+			memcpy(n16->keys, n4->keys, sizeof(n4->keys));
+			memcpy(n16->children, n4->children, sizeof(n4->children));
+			break;
+		}
+		case NODE16:
+		{
+			Node16 *n16 = (Node16*)node;
+			Node48 *n48 = (Node48*)grown;
+			for(uint32_t i = 0; i < node->numChildren; i++)
+			{
+				n48->index[n16->keys[i]] = (uint8_t)(i + 1);
+				n48->children[i] = n16->children[i];
+			}
+			break;
+		}
+		default:
+		{
+			Node48 *n48 = (Node48*)node;
+			Node256 *n256 = (Node256*)grown;
+			for(uint32_t b = 0; b < 256; b++)
+			{
+				if(n48->index[b] != 0) n256->children[b] = n48->children[n48->index[b] - 1];
+			}
+			break;
+		}
+	}
+
+	node_free(tree, node);
+	*ref = grown;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Adds a child to a node, growing the node if it is full.
+ * @details The children of the smaller nodes are kept sorted by their byte,
+ * so that the tree is traversed in alphabetical order.
+ *
+ * @param[in, out]	tree	Pointer to the tree.
+ * @param[in, out]	ref		Pointer to the reference to the node.
+ * @param[in]		byte	The byte of the child.
+ * @param[in]		child	Pointer to the child, either a node or a tagged leaf.
+ * @return	Return the status of the routine.
+ */
+static RetStatus node_add_child(WordTree *tree, void **ref, const uint8_t byte, void *child)
+{
+	TreeNode *node = (TreeNode*)*ref;
+	if(node->numChildren == nodeCapacities[node->type])
+	{
+		if(node_grow(tree, ref) != SUCCESS) return GEN_FAIL;
+		node = (TreeNode*)*ref;
+	}
+
+	switch(node->type)
+	{
+		case NODE4:
+		case NODE16:
+		{
+			uint8_t *keys = (node->type == NODE4) ? ((Node4*)node)->keys : ((Node16*)node)->keys;
+			void **children = (node->type == NODE4) ? ((Node4*)node)->children
+					: ((Node16*)node)->children;
+			uint32_t pos = 0;
+			while((pos < node->numChildren) && (keys[pos] < byte)) pos++;
+			memmove(keys + pos + 1, keys + pos, node->numChildren - pos);
+			memmove(children + pos + 1, children + pos, (node->numChildren - pos) * sizeof(void*));
+			keys[pos] = byte;
+			children[pos] = child;
+			break;
+		}
+		case NODE48:
+		{
+			/// Children are never removed, so the positions are filled in order.
+			Node48 *n48 = (Node48*)node;
+			n48->children[node->numChildren] = child;
+			n48->index[byte] = (uint8_t)(node->numChildren + 1);
+			break;
+		}
+		default:
+		{
+			((Node256*)node)->children[byte] = child;
+			break;
+		}
+	}
+	node->numChildren++;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Counts the length of the common prefix of two byte strings.
+ *
+ * @param[in]	a		Pointer to the first string.
+ * @param[in]	aLen	The length of the first string.
+ * @param[in]	b		Pointer to the second string.
+ * @param[in]	bLen	The length of the second string.
+ * @return	The number of bytes both strings start with.
+ */
+static inline uint32_t common_prefix(const uint8_t *a, const uint32_t aLen, const uint8_t *b,
+		const uint32_t bLen)
+{
+	const uint32_t len = (aLen < bLen) ? aLen : bLen;
+	uint32_t i = 0;
+	while((i < len) && (a[i] == b[i])) i++;
+
+	return i;
+}
+
+/**
+ * @brief Updates the longest and the most common word after a word is counted.
+ *
+ * @param[in, out]	tree	Pointer to the tree.
+ * @param[in]		wbuf	Pointer to the buffer of the word.
+ * @param[in]		count	The count of the word.
+ * @return	Return the status of the routine.
+ */
+static inline RetStatus word_counted(WordTree *tree, const WordBuffer *wbuf, const size_t count)
+{
+	const uint32_t length = WordBuffer_get_length(wbuf);
+	if(length > tree->maxLength) tree->maxLength = length;
+	if(count > tree->maxCount)
+	{
+		tree->maxCount = count;
+#ifdef _STATS
+		return WordBuffer_set(tree->maxCountWord, WordBuffer_get_word(wbuf), length);
+#endif //_STATS
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Replaces a leaf by a node holding both its word and a new word,
+ * which differ after their common prefix.
+ *
+ * @param[in, out]	tree	Pointer to the tree.
+ * @param[in, out]	ref		Pointer to the reference to the leaf.
+ * @param[in]		rest	Pointer to the bytes of the new word below the leaf.
+ * @param[in]		restLen	The number of bytes of the new word below the leaf.
+ * @param[in]		common	The length of the common prefix.
+ * @param[in]		count	The number of occurrences of the new word.
+ * @return	Return the status of the routine.
+ */
+static RetStatus leaf_split(WordTree *tree, void **ref, const uint8_t *rest,
+		const uint32_t restLen, const uint32_t common, const size_t count)
+{
+	TreeLeaf *leaf = leaf_of(*ref);
+	void *node = node_create(tree, NODE4, rest, common);
+	if(node == NULL) return GEN_FAIL;
+
+	/// The word of the leaf either ends at the node or continues below it,
+	/// keeping the rest of its suffix.
+	if(common == leaf->length)
+	{
+		((TreeNode*)node)->count = leaf->count;
+		tree->numLeaves--;
+		tree->memory -= sizeof(TreeLeaf) + leaf->length;
+		free(leaf);
+	}
+	else
+	{
+		const uint8_t byte = leaf->suffix[common];
+		memmove(leaf->suffix, leaf->suffix + common + 1, leaf->length - common - 1);
+		tree->memory -= common + 1;
+		leaf->length -= common + 1;
+		if(node_add_child(tree, &node, byte, *ref) != SUCCESS) return GEN_FAIL;
+	}
+
+	if(common == restLen) ((TreeNode*)node)->count = count;
+	else
+	{
+		void *newLeaf = leaf_create(tree, rest + common + 1, restLen - common - 1, count);
+		if((newLeaf == NULL) || (node_add_child(tree, &node, rest[common], newLeaf) != SUCCESS))
+			return GEN_FAIL;
+	}
+	*ref = node;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Places a new node above a node whose prefix differs from a new word,
+ * holding their common prefix.
+ *
+ * @param[in, out]	tree	Pointer to the tree.
+ * @param[in, out]	ref		Pointer to the reference to the node.
+ * @param[in]		rest	Pointer to the bytes of the new word below the node.
+ * @param[in]		restLen	The number of bytes of the new word below the node.
+ * @param[in]		common	The length of the common prefix.
+ * @param[in]		count	The number of occurrences of the new word.
+ * @return	Return the status of the routine.
+ */
+static RetStatus prefix_split(WordTree *tree, void **ref, const uint8_t *rest,
+		const uint32_t restLen, const uint32_t common, const size_t count)
+{
+	TreeNode *node = (TreeNode*)*ref;
+	void *parent = node_create(tree, NODE4, rest, common);
+	if(parent == NULL) return GEN_FAIL;
+
+	/// The node keeps the bytes of its prefix after the one leading to it.
+	uint8_t *prefix = node_prefix(node);
+	const uint8_t byte = prefix[common];
+	memmove(prefix, prefix + common + 1, node->prefixLen - common - 1);
+	tree->memory -= common + 1;
+	node->prefixLen -= common + 1;
+	if(node_add_child(tree, &parent, byte, node) != SUCCESS) return GEN_FAIL;
+
+	if(common == restLen) ((TreeNode*)parent)->count = count;
+	else
+	{
+		void *newLeaf = leaf_create(tree, rest + common + 1, restLen - common - 1, count);
+		if((newLeaf == NULL) ||
+			(node_add_child(tree, &parent, rest[common], newLeaf) != SUCCESS))
+			return GEN_FAIL;
+	}
+	*ref = parent;
+
+	return SUCCESS;
+}
+
+RetStatus WordTree_count_word(WordTree *tree, const WordBuffer *wbuf, const size_t count)
+{
+	const uint8_t *key = (const uint8_t*) WordBuffer_get_word(wbuf);
+	const uint32_t length = WordBuffer_get_length(wbuf);
+	void **ref = &(tree->root);
+	uint32_t depth = 0;
+
+	for(;;)
+	{
+		const uint8_t *rest = key + depth;
+		const uint32_t restLen = length - depth;
+		if(*ref == NULL)
+		{
+			*ref = leaf_create(tree, rest, restLen, count);
+			if(*ref == NULL) return GEN_FAIL;
+			tree->numWords++;
+			return word_counted(tree, wbuf, count);
+		}
+
+		if(is_leaf(*ref))
+		{
+			TreeLeaf *leaf = leaf_of(*ref);
+			const uint32_t common = common_prefix(leaf->suffix, leaf->length, rest, restLen);
+			if((common == leaf->length) && (common == restLen))
+			{
+				leaf->count += count;
+				return word_counted(tree, wbuf, leaf->count);
+			}
+			if(leaf_split(tree, ref, rest, restLen, common, count) != SUCCESS) return GEN_FAIL;
+			tree->numWords++;
+			return word_counted(tree, wbuf, count);
+		}
+
+		TreeNode *node = (TreeNode*)*ref;
+		const uint32_t common = common_prefix(node_prefix(node), node->prefixLen, rest, restLen);
+		if(common < node->prefixLen)
+		{
+			if(prefix_split(tree, ref, rest, restLen, common, count) != SUCCESS)
+				return GEN_FAIL;
+			tree->numWords++;
+			return word_counted(tree, wbuf, count);
+		}
+
+		depth += node->prefixLen;
+		if(depth == length)
+		{
+			if(node->count == 0) tree->numWords++;
+			node->count += count;
+			return word_counted(tree, wbuf, node->count);
+		}
+
+		void **next = node_find_child(node, key[depth]);
+		if(next == NULL)
+		{
+			void *leaf = leaf_create(tree, key + depth + 1, length - depth - 1, count);
+			if((leaf == NULL) || (node_add_child(tree, ref, key[depth], leaf) != SUCCESS))
+				return GEN_FAIL;
+			tree->numWords++;
+			return word_counted(tree, wbuf, count);
+		}
+		ref = next;
+		depth++;
+	}
+}
+
+/**
+ * @brief Gets the next child of a node being traversed, in the order of their bytes.
+ *
+ * @param[in, out]	frame	Pointer to the frame of the node.
+ * @param[out]		byte	Pointer to the byte of the child.
+ * @return	Pointer to the child, NULL once all the children are traversed.
+ */
+static void* frame_next_child(TreeFrame *frame, uint8_t *byte)
+{
+	TreeNode *node = frame->node;
+	switch(node->type)
+	{
+		case NODE4:
+		case NODE16:
+		{
+			if(frame->next >= node->numChildren) return NULL;
+			const uint32_t pos = frame->next++;
+			if(node->type == NODE4)
+			{
+				*byte = ((Node4*)node)->keys[pos];
+				return ((Node4*)node)->children[pos];
+			}
+			*byte = ((Node16*)node)->keys[pos];
+			return ((Node16*)node)->children[pos];
+		}
+		case NODE48:
+		{
+			Node48 *n48 = (Node48*)node;
+			while(frame->next < 256)
+			{
+				const uint32_t b = frame->next++;
+				if(n48->index[b] == 0) continue;
+				*byte = (uint8_t)b;
+				return n48->children[n48->index[b] - 1];
+			}
+			return NULL;
+		}
+		default:
+		{
+			Node256 *n256 = (Node256*)node;
+			while(frame->next < 256)
+			{
+				const uint32_t b = frame->next++;
+				if(n256->children[b] == NULL) continue;
+				*byte = (uint8_t)b;
+				return n256->children[b];
+			}
+			return NULL;
+		}
+	}
+}
+
+/**
+ * @brief Pushes a node to the stack of the traversal.
+ *
+ * @param[in, out]	tree	Pointer to the tree.
+ * @param[in, out]	depth	Pointer to the number of frames of the stack.
+ * @param[in]		node	Pointer to the node.
+ * @param[in]		keyLen	The length of the word up to the end of the prefix of the node.
+ * @return	Return the status of the routine.
+ */
+static RetStatus frame_push(WordTree *tree, size_t *depth, TreeNode *node, const uint32_t keyLen)
+{
+	if(*depth == tree->stackCapacity)
+	{
+		TreeFrame *stack = (TreeFrame*) realloc(tree->stack,
+				2 * tree->stackCapacity * sizeof(TreeFrame));
+		if(stack == NULL)
+		{
+			fprintf(stderr, "Failed to grow the stack of the word tree.\n");
+			return GEN_FAIL;
+		}
+		tree->stack = stack;
+		tree->stackCapacity *= 2;
+	}
+	tree->stack[*depth].node = node;
+	tree->stack[*depth].keyLen = keyLen;
+	tree->stack[*depth].next = 0;
+	(*depth)++;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Writes bytes to the buffer of the word being printed.
+ *
+ * @param[in, out]	tree	Pointer to the tree.
+ * @param[in]		at		The position of the first byte in the word.
+ * @param[in]		bytes	Pointer to the bytes.
+ * @param[in]		len		The number of bytes.
+ * @return	Return the status of the routine.
+ */
+static RetStatus key_write(WordTree *tree, const uint32_t at, const uint8_t *bytes,
+		const uint32_t len)
+{
+	/// One more byte is kept for the null terminator.
+	if((size_t)at + len + 1 > tree->keyCapacity)
+	{
+		const size_t newCapacity = next_2power((size_t)at + len + 1);
+		char *key = (char*) realloc(tree->key, newCapacity);
+		if(key == NULL)
+		{
+			fprintf(stderr, "Failed to grow the buffer of the word tree.\n");
+			return GEN_FAIL;
+		}
+		tree->key = key;
+		tree->keyCapacity = newCapacity;
+	}
+	memcpy(tree->key + at, bytes, len);
+	tree->key[at + len] = '\0';
+
+	return SUCCESS;
+}
+
+/// @brief The state of a traversal printing the words of a tree.
+typedef struct
+{
+	/// Pointer to the tree.
+	WordTree *tree;
+	/// The number of frames of the stack.
+	size_t depth;
+	/// Pointer to the child visited next.
+	void *child;
+	/// The length of the word up to the child.
+	uint32_t keyLen;
+	/// Whether the traversal moves to the next child before visiting it.
+	bool advance;
+}TreePrintIter;
+
+/**
+ * @brief Gets the next word of a tree in byte order.
+ * @details The words are visited depth first, each node before its children,
+ * so a word comes before the longer words it is a prefix of. The next child
+ * is only found on the following call, as writing its byte overwrites the word.
+ *
+ * @param[in, out]	iter	Pointer to the state of the traversal.
+ * @param[out]		word	Pointer to the bytes of the word, or NULL past the last word.
+ * @param[out]		length	Pointer to the length of the word.
+ * @param[out]		count	Pointer to the count of the word.
+ * @return	Return the status of the routine.
+ */
+static RetStatus tree_next(void *iter, const char **word, uint32_t *length, size_t *count)
+{
+	TreePrintIter *it = (TreePrintIter*)iter;
+	WordTree *tree = it->tree;
+	for(;;)
+	{
+		if(it->advance)
+		{
+			/// Moves to the next child of the deepest node with children left.
+			uint8_t byte = 0;
+			it->child = NULL;
+			while((it->depth != 0) &&
+				((it->child = frame_next_child(&(tree->stack[it->depth - 1]), &byte)) == NULL))
+				it->depth--;
+			if(it->child == NULL)
+			{
+				*word = NULL;
+				return SUCCESS;
+			}
+			it->keyLen = tree->stack[it->depth - 1].keyLen;
+			if(key_write(tree, it->keyLen, &byte, 1) != SUCCESS) return GEN_FAIL;
+			it->keyLen++;
+		}
+		it->advance = true;
+
+		if(is_leaf(it->child))
+		{
+			const TreeLeaf *leaf = leaf_of(it->child);
+			if(key_write(tree, it->keyLen, leaf->suffix, leaf->length) != SUCCESS)
+				return GEN_FAIL;
+			*word = tree->key;
+			*length = it->keyLen + leaf->length;
+			*count = leaf->count;
+			return SUCCESS;
+		}
+		TreeNode *node = (TreeNode*)it->child;
+		if(key_write(tree, it->keyLen, node_prefix(node), node->prefixLen) != SUCCESS)
+			return GEN_FAIL;
+		if(frame_push(tree, &(it->depth), node, it->keyLen + node->prefixLen) != SUCCESS)
+			return GEN_FAIL;
+		if(node->count != 0)
+		{
+			*word = tree->key;
+			*length = it->keyLen + node->prefixLen;
+			*count = node->count;
+			return SUCCESS;
+		}
+	}
+}
+
+RetStatus WordTree_count_print(WordTree *tree)
+{
+	if(tree->numWords == 0) return SUCCESS;
+
+	TreePrintIter iter = {tree, 0, tree->root, 0, false};
+	if(CountTable_print("word", "Word", tree->maxLength, tree->maxCount, tree_next, &iter)
+			!= SUCCESS) return GEN_FAIL;
+
+#ifdef _STATS
+	printf("Most common word: \"%s\", appearing %ld time(s)",
+		WordBuffer_get_word(tree->maxCountWord), tree->maxCount);
+#endif //_STATS
+
+	return SUCCESS;
+}
+
+void WordTree_stats_print(const WordTree *tree)
+{
+	size_t numNodes = 0;
+	for(uint32_t t = 0; t < NUM_NODE_TYPES; t++) numNodes += tree->numNodes[t];
+
+	printf("\nWord Tree statistics:\n");
+	printf("\tWords: %ld in %ld leaves and %ld nodes\n", tree->numWords, tree->numLeaves,
+			numNodes);
+	printf("\tNodes of 4, 16, 48 and 256 children: %ld, %ld, %ld and %ld\n",
+			tree->numNodes[NODE4], tree->numNodes[NODE16], tree->numNodes[NODE48],
+			tree->numNodes[NODE256]);
+	printf("\tMemory used: %ld bytes\n", tree->memory);
+}
+
+void WordTree_destroy(WordTree **tree)
+{
+	/// The nodes are freed after their children, walking the tree
+	/// with the stack of the traversal.
+	WordTree *wtree = *tree;
+	size_t depth = 0;
+	void *child = wtree->root;
+	while((child != NULL) && (wtree->stack != NULL))
+	{
+		if(is_leaf(child)) free(leaf_of(child));
+		else if(frame_push(wtree, &depth, (TreeNode*)child, 0) != SUCCESS) break;
+
+		uint8_t byte = 0;
+		child = NULL;
+		while((depth != 0) &&
+			((child = frame_next_child(&(wtree->stack[depth - 1]), &byte)) == NULL))
+		{
+			free(wtree->stack[--depth].node);
+		}
+	}
+
+#ifdef _STATS
+	if(wtree->maxCountWord != NULL) WordBuffer_destroy(&(wtree->maxCountWord));
+#endif //_STATS
+	free(wtree->key);
+	free(wtree->stack);
+	free(wtree);
+	*tree = NULL;
+}
@@ -0,0 +1,49 @@
+# Compares the printed counts of two known runs, which must list only
+# the words whose log2 ratio of frequencies reaches the threshold,
+# with their counts and ratio, a word missing from one side counting 0.5.
+# Expects WORD_COUNTER, the path of the program, and WORK_DIR.
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+file(WRITE ${WORK_DIR}/old.txt "the cat sat on the mat\n")
+file(WRITE ${WORK_DIR}/new.txt "the dog sat on the log the dog\n")
+
+foreach(run old new)
+	execute_process(COMMAND ${WORD_COUNTER} ${run}.txt
+		WORKING_DIRECTORY ${WORK_DIR}
+		RESULT_VARIABLE status
+		OUTPUT_FILE ${WORK_DIR}/${run}.out
+		ERROR_VARIABLE errors)
+	if(NOT status EQUAL 0)
+		message(FATAL_ERROR "Counting ${run}.txt failed with status ${status}:\n${errors}")
+	endif()
+endforeach()
+
+execute_process(COMMAND ${WORD_COUNTER} diff old.out new.out
+	WORKING_DIRECTORY ${WORK_DIR}
+	RESULT_VARIABLE status
+	OUTPUT_VARIABLE output
+	ERROR_VARIABLE errors)
+
+if(NOT status EQUAL 0)
+	message(FATAL_ERROR "Expected exit status 0, got ${status}:\n${errors}")
+endif()
+if(NOT output MATCHES "\n    cat +1 +0 +-1\\.42\n    dog +0 +2 +\\+1\\.58\n    mat +1 +0 +-1\\.42\n-")
+	message(FATAL_ERROR "Wrong rows for the default threshold:\n${output}")
+endif()
+
+# A lower threshold adds the words which changed less.
+execute_process(COMMAND ${WORD_COUNTER} diff --threshold 0.5 old.out new.out
+	WORKING_DIRECTORY ${WORK_DIR}
+	RESULT_VARIABLE status
+	OUTPUT_VARIABLE output
+	ERROR_VARIABLE errors)
+if(NOT status EQUAL 0)
+	message(FATAL_ERROR "Expected exit status 0, got ${status}:\n${errors}")
+endif()
+if(NOT output MATCHES "\n    dog +0 +2 +\\+1\\.58\n    log +0 +1 +\\+0\\.58\n    mat ")
+	message(FATAL_ERROR "Missing \"log\" for the threshold 0.5:\n${output}")
+endif()
+if(output MATCHES "\n    (the|sat|on) ")
+	message(FATAL_ERROR "A word which barely changed was printed:\n${output}")
+endif()
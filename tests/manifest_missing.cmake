@@ -0,0 +1,47 @@
+# Counts a manifest listing a missing document between two readable ones.
+# The readable documents must still be printed, the missing one reported
+# on the standard error and the run must exit with status 2.
+# Expects WORD_COUNTER, the path of the program, and WORK_DIR.
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+file(WRITE ${WORK_DIR}/first.txt "apple banana apple\n")
+file(WRITE ${WORK_DIR}/second.txt "cherry\n")
+file(WRITE ${WORK_DIR}/list "first.txt\nmissing.txt\nsecond.txt\n")
+
+execute_process(COMMAND ${WORD_COUNTER} --manifest list
+	WORKING_DIRECTORY ${WORK_DIR}
+	RESULT_VARIABLE status
+	OUTPUT_VARIABLE output
+	ERROR_VARIABLE errors)
+
+if(NOT status EQUAL 2)
+	message(FATAL_ERROR "Expected exit status 2, got ${status}:\n${errors}")
+endif()
+foreach(expected
+		"Document first.txt \\(3 words\\):\n"
+		"\n    apple +2\n"
+		"\n    banana +1\n"
+		"Document second.txt \\(1 words\\):\n"
+		"\n    cherry +1\n")
+	if(NOT output MATCHES "${expected}")
+		message(FATAL_ERROR "Missing \"${expected}\" in the output:\n${output}")
+	endif()
+endforeach()
+if(output MATCHES "missing.txt")
+	message(FATAL_ERROR "The missing document was printed:\n${output}")
+endif()
+if(NOT errors MATCHES "Failed to open document: missing.txt\n")
+	message(FATAL_ERROR "The missing document was not reported:\n${errors}")
+endif()
+
+# Without the missing document the run succeeds.
+file(WRITE ${WORK_DIR}/list "first.txt\nsecond.txt\n")
+execute_process(COMMAND ${WORD_COUNTER} --manifest list
+	WORKING_DIRECTORY ${WORK_DIR}
+	RESULT_VARIABLE status
+	OUTPUT_QUIET
+	ERROR_VARIABLE errors)
+if(NOT status EQUAL 0)
+	message(FATAL_ERROR "Expected exit status 0, got ${status}:\n${errors}")
+endif()
@@ -0,0 +1,56 @@
+# Exports the counts of a known vocabulary as an FST and queries it
+# by prefix and by range, which must print only the words requested
+# along with their counts.
+# Expects WORD_COUNTER, the path of the program, and WORK_DIR.
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+file(WRITE ${WORK_DIR}/input.txt
+	"apple banana cherry apple apricot\nbanana blueberry avocado apple\n")
+
+execute_process(COMMAND ${WORD_COUNTER} --export-fst counts.fst input.txt
+	WORKING_DIRECTORY ${WORK_DIR}
+	RESULT_VARIABLE status
+	OUTPUT_QUIET
+	ERROR_VARIABLE errors)
+if(NOT status EQUAL 0)
+	message(FATAL_ERROR "Exporting the FST failed with status ${status}:\n${errors}")
+endif()
+
+execute_process(COMMAND ${WORD_COUNTER} query-fst --prefix ap counts.fst
+	WORKING_DIRECTORY ${WORK_DIR}
+	RESULT_VARIABLE status
+	OUTPUT_VARIABLE output
+	ERROR_VARIABLE errors)
+if(NOT status EQUAL 0)
+	message(FATAL_ERROR "Expected exit status 0, got ${status}:\n${errors}")
+endif()
+if(NOT output MATCHES "\n    apple +3\n    apricot +1\n-")
+	message(FATAL_ERROR "Wrong words for the prefix \"ap\":\n${output}")
+endif()
+
+# The range excludes its end, so no word starting with "c" is printed.
+execute_process(COMMAND ${WORD_COUNTER} query-fst --range b c counts.fst
+	WORKING_DIRECTORY ${WORK_DIR}
+	RESULT_VARIABLE status
+	OUTPUT_VARIABLE output
+	ERROR_VARIABLE errors)
+if(NOT status EQUAL 0)
+	message(FATAL_ERROR "Expected exit status 0, got ${status}:\n${errors}")
+endif()
+if(NOT output MATCHES "\n    banana +2\n    blueberry +1\n-")
+	message(FATAL_ERROR "Wrong words for the range from \"b\" to \"c\":\n${output}")
+endif()
+
+# Without a query every word is printed in order.
+execute_process(COMMAND ${WORD_COUNTER} query-fst counts.fst
+	WORKING_DIRECTORY ${WORK_DIR}
+	RESULT_VARIABLE status
+	OUTPUT_VARIABLE output
+	ERROR_VARIABLE errors)
+if(NOT status EQUAL 0)
+	message(FATAL_ERROR "Expected exit status 0, got ${status}:\n${errors}")
+endif()
+if(NOT output MATCHES "\n    apple +3\n    apricot +1\n    avocado +1\n    banana +2\n    blueberry +1\n    cherry +1\n-")
+	message(FATAL_ERROR "Wrong words for the whole FST:\n${output}")
+endif()
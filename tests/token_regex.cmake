@@ -0,0 +1,62 @@
+# Counts the longest matches of a token expression in mixed case input.
+# Letters are case folded unless --case-sensitive is given, so the
+# expression matches both cases of its letters by default.
+# Expects WORD_COUNTER, the path of the program, and WORK_DIR.
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+file(WRITE ${WORK_DIR}/input.txt "AAA aaa Aa bcB xaA\nab12 AB12 12ab\n")
+
+execute_process(COMMAND ${WORD_COUNTER} --token-regex "a+" input.txt
+	WORKING_DIRECTORY ${WORK_DIR}
+	RESULT_VARIABLE status
+	OUTPUT_VARIABLE output
+	ERROR_VARIABLE errors)
+
+if(NOT status EQUAL 0)
+	message(FATAL_ERROR "Expected exit status 0, got ${status}:\n${errors}")
+endif()
+foreach(expected
+		"\n    a +3\n"
+		"\n    aa +2\n"
+		"\n    aaa +2\n")
+	if(NOT output MATCHES "${expected}")
+		message(FATAL_ERROR "Missing \"${expected}\" in the output:\n${output}")
+	endif()
+endforeach()
+if(output MATCHES "\n    (bcb|xaa|ab12) ")
+	message(FATAL_ERROR "A word not matching the expression was printed:\n${output}")
+endif()
+
+# Kept in their case, only the lowercase letters match.
+execute_process(COMMAND ${WORD_COUNTER} --case-sensitive --token-regex "a+" input.txt
+	WORKING_DIRECTORY ${WORK_DIR}
+	RESULT_VARIABLE status
+	OUTPUT_VARIABLE output
+	ERROR_VARIABLE errors)
+if(NOT status EQUAL 0)
+	message(FATAL_ERROR "Expected exit status 0, got ${status}:\n${errors}")
+endif()
+foreach(expected
+		"\n    a +4\n"
+		"\n    aaa +1\n")
+	if(NOT output MATCHES "${expected}")
+		message(FATAL_ERROR "Missing \"${expected}\" in the output:\n${output}")
+	endif()
+endforeach()
+if(output MATCHES "\n    aa ")
+	message(FATAL_ERROR "A match of both cases was printed:\n${output}")
+endif()
+
+# A word is the longest match, letters followed by digits here.
+execute_process(COMMAND ${WORD_COUNTER} --token-regex "[a-z]+[0-9]+" input.txt
+	WORKING_DIRECTORY ${WORK_DIR}
+	RESULT_VARIABLE status
+	OUTPUT_VARIABLE output
+	ERROR_VARIABLE errors)
+if(NOT status EQUAL 0)
+	message(FATAL_ERROR "Expected exit status 0, got ${status}:\n${errors}")
+endif()
+if(NOT output MATCHES "\n    ab12 +2\n")
+	message(FATAL_ERROR "Missing \"ab12\" in the output:\n${output}")
+endif()
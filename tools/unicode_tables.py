@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+#
+# Generates the Unicode character class and case folding tables of
+# WordCounter's tokenizer. The classes come from the Unicode Character
+# Database bundled with Python and the foldings from the CaseFolding.txt
+# pinned next to this script, which must be of the same version. The build
+# runs it when such a Python is available, falling back to the copy
+# committed in src/ otherwise.
+#
+# Usage: python3 tools/unicode_tables.py [OUTFILE]
+
+import os
+import re
+import sys
+import unicodedata
+
+# The case foldings, pinned to the version of the tables.
+CASE_FOLDING = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                            'CaseFolding.txt')
+
+# The classes of the code points, as in include/unicode.h.
+OTHER, LETTER, NUMBER = 0, 1, 2
+# Code points below this limit are looked up directly, 2 bits each.
+SMALL_LIMIT = 0x800
+# The longest range fitting the 16-bit length field.
+MAX_RANGE_LENGTH = 0x10000
+# The number of code points of each block of the case folding table.
+FOLD_BLOCK_SHIFT = 8
+FOLD_BLOCK_LENGTH = 1 << FOLD_BLOCK_SHIFT
+
+
+def code_point_class(cp):
+    category = unicodedata.category(chr(cp))
+    # Combining marks are part of the letters they modify.
+    if category[0] in 'LM':
+        return LETTER
+    if category[0] == 'N':
+        return NUMBER
+    return OTHER
+
+
+def read_case_folding(path):
+    # Returns the Unicode version of the file and the simple case folding,
+    # the statuses C and S, of the code points which have one.
+    with open(path, encoding='utf-8') as data:
+        match = re.match(r'# CaseFolding-(\d+\.\d+\.\d+)\.txt', data.readline())
+        if match is None:
+            sys.exit('%s is not a CaseFolding.txt file' % path)
+        foldings = {}
+        for line in data:
+            fields = [field.strip() for field in line.split('#', 1)[0].split(';')]
+            if (len(fields) >= 3) and (fields[1] in ('C', 'S')):
+                foldings[int(fields[0], 16)] = int(fields[2], 16)
+    return match.group(1), foldings
+
+
+def write_fold_tables(out, foldings):
+    # The first level maps each block of code points to a block of the
+    # second, which holds the distance of each code point from its folding.
+    # Identical blocks, most of them all zeroes, are only stored once.
+    blocks = {}
+    index = []
+    for block in range(0x110000 >> FOLD_BLOCK_SHIFT):
+        first = block << FOLD_BLOCK_SHIFT
+        deltas = tuple(foldings.get(cp, cp) - cp
+                       for cp in range(first, first + FOLD_BLOCK_LENGTH))
+        index.append(blocks.setdefault(deltas, len(blocks)))
+    assert len(blocks) <= 256
+
+    out.write('const uint8_t unicodeFoldIndex[%d] =\n{\n' % len(index))
+    for row in range(0, len(index), 16):
+        out.write('\t' + ', '.join('%d' % b for b in index[row:row + 16]) + ',\n')
+    out.write('};\n\n')
+
+    out.write('const int32_t unicodeFoldBlocks[%d][%d] =\n{\n' %
+              (len(blocks), FOLD_BLOCK_LENGTH))
+    for deltas in sorted(blocks, key=blocks.get):
+        out.write('\t{\n')
+        for row in range(0, FOLD_BLOCK_LENGTH, 16):
+            out.write('\t\t' + ', '.join('%d' % d for d in deltas[row:row + 16]) + ',\n')
+        out.write('\t},\n')
+    out.write('};\n')
+
+
+def main():
+    version, foldings = read_case_folding(CASE_FOLDING)
+    if version != unicodedata.unidata_version:
+        sys.exit('The Unicode Character Database of Python is version %s, '
+                 'CaseFolding.txt is version %s' % (unicodedata.unidata_version, version))
+    out = open(sys.argv[1], 'w') if len(sys.argv) > 1 else sys.stdout
+    classes = [code_point_class(cp) for cp in range(0x110000)]
+
+    out.write('/**\n'
+              ' * Generated by tools/unicode_tables.py from the Unicode Character\n'
+              ' * Database version %s and its CaseFolding.txt. Do not edit.\n'
+              ' */\n\n' % version)
+    out.write('#include "unicode.h"\n\n')
+    out.write('const char unicodeVersion[] = "%s";\n\n' % version)
+
+    out.write('const uint8_t unicodeSmallClasses[%d] =\n{\n' % (SMALL_LIMIT // 4))
+    packed = []
+    for base in range(0, SMALL_LIMIT, 4):
+        packed.append(sum(classes[base + i] << (2 * i) for i in range(4)))
+    for row in range(0, len(packed), 16):
+        out.write('\t' + ', '.join('0x%02x' % b for b in packed[row:row + 16]) + ',\n')
+    out.write('};\n\n')
+
+    ranges = []
+    for cp in range(SMALL_LIMIT, 0x110000):
+        cls = classes[cp]
+        if cls == OTHER:
+            continue
+        if ranges and (ranges[-1][0] + ranges[-1][1] == cp) and \
+                (ranges[-1][2] == cls) and (ranges[-1][1] < MAX_RANGE_LENGTH):
+            ranges[-1][1] += 1
+        else:
+            ranges.append([cp, 1, cls])
+
+    out.write('const UnicodeRange unicodeRanges[%d] =\n{\n' % len(ranges))
+    for first, length, cls in ranges:
+        out.write('\t{0x%05x, 0x%04x, %s},\n' % (first, length - 1,
+                  'UNICODE_LETTER' if cls == LETTER else 'UNICODE_NUMBER'))
+    out.write('};\n\n')
+    out.write('const size_t unicodeNumRanges = %d;\n\n' % len(ranges))
+
+    write_fold_tables(out, foldings)
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()